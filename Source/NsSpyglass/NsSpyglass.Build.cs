@@ -40,10 +40,18 @@ public class NsSpyglass : ModuleRules
                 "ToolMenus",
                 "Projects",
                 "InputCore",
-                "DeveloperSettings"
+                "DeveloperSettings",
+                "Json",
+                "AssetRegistry",
+                "ApplicationCore",
+                "DesktopPlatform",
+                "EditorSubsystem"
             }
         );
 
+        // Git objects are zlib streams of unknown compressed size, read by NsSpyglassGitHistory
+        AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+
         DynamicallyLoadedModuleNames.AddRange(
             new string[]
             {
@@ -0,0 +1,273 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassBudgetEvaluator.h"
+#include "Graph/NsSpyglassReachability.h"
+#include "Serialization/JsonWriter.h"
+#include "Settings/NsSpyglassBudgetSettings.h"
+
+namespace
+{
+    /** Whether a module ships in cooked runtime builds. */
+    bool IsRuntimeHost(const EHostType::Type Type)
+    {
+        switch (Type)
+        {
+        case EHostType::Runtime:
+        case EHostType::RuntimeNoCommandlet:
+        case EHostType::RuntimeAndProgram:
+        case EHostType::CookedOnly:
+        case EHostType::ServerOnly:
+        case EHostType::ClientOnly:
+        case EHostType::ClientOnlyNoCommandlet:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    /** Whether a module only exists in editor or developer builds. */
+    bool IsEditorHost(const EHostType::Type Type)
+    {
+        switch (Type)
+        {
+        case EHostType::Editor:
+        case EHostType::EditorNoCommandlet:
+        case EHostType::EditorAndProgram:
+        case EHostType::Developer:
+        case EHostType::DeveloperTool:
+        case EHostType::UncookedOnly:
+            return true;
+        default:
+            return false;
+        }
+    }
+}
+
+bool FNsSpyglassBudgetEvaluator::MatchesGroup(const FPluginNode& Node, const FNsSpyglassBudgetGroup& Group)
+{
+    if (Group.bProjectPluginsOnly && Node.bIsEngine)
+    {
+        return false;
+    }
+
+    if (Group.PluginPatterns.Num() > 0)
+    {
+        const bool bNameMatch = Group.PluginPatterns.ContainsByPredicate([&Node](const FString& Pattern)
+        {
+            return Node.Name.MatchesWildcard(Pattern);
+        });
+
+        if (!bNameMatch)
+        {
+            return false;
+        }
+    }
+
+    if (Group.ModuleFilter == ENsSpyglassGroupModuleFilter::Any)
+    {
+        return true;
+    }
+
+    if (!Node.Plugin.IsValid())
+    {
+        return false;
+    }
+
+    const TArray<FModuleDescriptor>& Modules = Node.Plugin->GetDescriptor().Modules;
+    if (Group.ModuleFilter == ENsSpyglassGroupModuleFilter::Runtime)
+    {
+        return Modules.ContainsByPredicate([](const FModuleDescriptor& Module) { return IsRuntimeHost(Module.Type); });
+    }
+
+    return Modules.Num() > 0 && !Modules.ContainsByPredicate([](const FModuleDescriptor& Module) { return !IsEditorHost(Module.Type); });
+}
+
+void FNsSpyglassBudgetEvaluator::Evaluate(const TArray<FPluginNode>& Nodes, const UNsSpyglassBudgetSettings& Settings, FNsSpyglassBudgetReport& OutReport)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    const int32 Num = Nodes.Num();
+
+    OutReport = FNsSpyglassBudgetReport();
+    OutReport.NumPlugins = Num;
+
+    FNsSpyglassReachability Reachability;
+    FNsSpyglassReachability::Compute(Nodes, Reachability);
+
+    OutReport.MaxDepth = Reachability.GetMaxDepth();
+    OutReport.NumCycles = Reachability.Components.Cycles.Num();
+    OutReport.TransitiveDependencies = Reachability.TransitiveDependencies;
+    OutReport.PluginNames.Reserve(Num);
+
+    for (const FPluginNode& Node : Nodes)
+    {
+        OutReport.PluginNames.Add(Node.Name);
+        if (Node.Plugin.IsValid())
+        {
+            OutReport.NumEnabledModules += Node.Plugin->GetDescriptor().Modules.Num();
+        }
+    }
+
+    // Transitive dependency count per plugin
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const int32* Override = Settings.TransitiveDependencyOverrides.Find(Nodes[i].Name);
+        const int32 Limit = Override ? *Override : Settings.MaxTransitiveDependencies;
+        const int32 Actual = Reachability.TransitiveDependencies[i];
+
+        if (Limit > 0 && Actual > Limit)
+        {
+            FNsSpyglassBudgetViolation& Violation = OutReport.Violations.AddDefaulted_GetRef();
+            Violation.Rule = TEXT("MaxTransitiveDependencies");
+            Violation.Plugin = Nodes[i].Name;
+            Violation.Actual = Actual;
+            Violation.Limit = Limit;
+            Violation.Detail = FString::Printf(TEXT("%s depends on %d plugins, budget is %d"), *Nodes[i].Name, Actual, Limit);
+        }
+    }
+
+    // Depth
+    if (Settings.MaxDepth > 0)
+    {
+        for (int32 i = 0; i < Num; ++i)
+        {
+            if (Reachability.Depth[i] > Settings.MaxDepth)
+            {
+                FNsSpyglassBudgetViolation& Violation = OutReport.Violations.AddDefaulted_GetRef();
+                Violation.Rule = TEXT("MaxDepth");
+                Violation.Plugin = Nodes[i].Name;
+                Violation.Actual = Reachability.Depth[i];
+                Violation.Limit = Settings.MaxDepth;
+                Violation.Detail = FString::Printf(TEXT("%s heads a dependency chain of length %d, budget is %d"), *Nodes[i].Name, Violation.Actual, Violation.Limit);
+            }
+        }
+    }
+
+    // Module count
+    if (Settings.MaxEnabledModules > 0 && OutReport.NumEnabledModules > Settings.MaxEnabledModules)
+    {
+        FNsSpyglassBudgetViolation& Violation = OutReport.Violations.AddDefaulted_GetRef();
+        Violation.Rule = TEXT("MaxEnabledModules");
+        Violation.Actual = OutReport.NumEnabledModules;
+        Violation.Limit = Settings.MaxEnabledModules;
+        Violation.Detail = FString::Printf(TEXT("%d modules are enabled, budget is %d"), Violation.Actual, Violation.Limit);
+    }
+
+    // Cycles
+    if (Settings.bForbidCycles)
+    {
+        for (const TArray<int32>& Cycle : Reachability.Components.Cycles)
+        {
+            TArray<FString> Names;
+            for (int32 Member : Cycle)
+            {
+                Names.Add(Nodes[Member].Name);
+            }
+
+            FNsSpyglassBudgetViolation& Violation = OutReport.Violations.AddDefaulted_GetRef();
+            Violation.Rule = TEXT("Cycle");
+            Violation.Plugin = Nodes[Cycle[0]].Name;
+            Violation.Actual = Cycle.Num();
+            Violation.Detail = FString::Printf(TEXT("Circular dependency between %s"), *FString::Join(Names, TEXT(", ")));
+        }
+    }
+
+    // Forbidden edges between groups
+    TMap<FName, TBitArray<>> GroupMasks;
+    for (const FNsSpyglassBudgetGroup& Group : Settings.Groups)
+    {
+        TBitArray<>& Mask = GroupMasks.Add(Group.Name, TBitArray<>(false, Num));
+        for (int32 i = 0; i < Num; ++i)
+        {
+            Mask[i] = MatchesGroup(Nodes[i], Group);
+        }
+    }
+
+    for (const FNsSpyglassForbiddenEdge& Forbidden : Settings.ForbiddenEdges)
+    {
+        const TBitArray<>* FromMask = GroupMasks.Find(Forbidden.FromGroup);
+        const TBitArray<>* ToMask = GroupMasks.Find(Forbidden.ToGroup);
+        if (!FromMask || !ToMask)
+        {
+            FNsSpyglassBudgetViolation& Violation = OutReport.Violations.AddDefaulted_GetRef();
+            Violation.Rule = TEXT("Config");
+            Violation.Detail = FString::Printf(TEXT("Forbidden edge %s -> %s references an unknown group"), *Forbidden.FromGroup.ToString(), *Forbidden.ToGroup.ToString());
+            continue;
+        }
+
+        for (TConstSetBitIterator<> FromIt(*FromMask); FromIt; ++FromIt)
+        {
+            const int32 From = FromIt.GetIndex();
+            const auto AddViolation = [&](const int32 To, const TCHAR* Kind)
+            {
+                FNsSpyglassBudgetViolation& Violation = OutReport.Violations.AddDefaulted_GetRef();
+                Violation.Rule = TEXT("ForbiddenEdge");
+                Violation.Plugin = Nodes[From].Name;
+                Violation.Detail = FString::Printf(TEXT("%s (%s) %s depends on %s (%s)"),
+                    *Nodes[From].Name, *Forbidden.FromGroup.ToString(), Kind, *Nodes[To].Name, *Forbidden.ToGroup.ToString());
+            };
+
+            if (Forbidden.bTransitive)
+            {
+                const TBitArray<>& Reach = Reachability.ComponentReach[Reachability.Components.ComponentOf[From]];
+                for (TConstSetBitIterator<> ToIt(Reach); ToIt; ++ToIt)
+                {
+                    if (ToIt.GetIndex() != From && (*ToMask)[ToIt.GetIndex()])
+                    {
+                        AddViolation(ToIt.GetIndex(), Nodes[From].Dependencies.Contains(ToIt.GetIndex()) ? TEXT("directly") : TEXT("transitively"));
+                    }
+                }
+            }
+            else
+            {
+                for (int32 Dep : Nodes[From].Dependencies)
+                {
+                    if (Nodes.IsValidIndex(Dep) && Dep != From && (*ToMask)[Dep])
+                    {
+                        AddViolation(Dep, TEXT("directly"));
+                    }
+                }
+            }
+        }
+    }
+
+    OutReport.EvaluationSeconds = FPlatformTime::Seconds() - StartTime;
+}
+
+FString FNsSpyglassBudgetReport::ToJson() const
+{
+    FString Output;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+
+    Writer->WriteObjectStart();
+    Writer->WriteValue(TEXT("passed"), Passed());
+    Writer->WriteValue(TEXT("plugins"), NumPlugins);
+    Writer->WriteValue(TEXT("enabledModules"), NumEnabledModules);
+    Writer->WriteValue(TEXT("maxDepth"), MaxDepth);
+    Writer->WriteValue(TEXT("cycles"), NumCycles);
+    Writer->WriteValue(TEXT("evaluationSeconds"), EvaluationSeconds);
+
+    Writer->WriteArrayStart(TEXT("violations"));
+    for (const FNsSpyglassBudgetViolation& Violation : Violations)
+    {
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("rule"), Violation.Rule);
+        Writer->WriteValue(TEXT("plugin"), Violation.Plugin);
+        Writer->WriteValue(TEXT("actual"), Violation.Actual);
+        Writer->WriteValue(TEXT("limit"), Violation.Limit);
+        Writer->WriteValue(TEXT("detail"), Violation.Detail);
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+
+    Writer->WriteObjectStart(TEXT("transitiveDependencies"));
+    for (int32 i = 0; i < PluginNames.Num(); ++i)
+    {
+        Writer->WriteValue(PluginNames[i], TransitiveDependencies[i]);
+    }
+    Writer->WriteObjectEnd();
+
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return Output;
+}
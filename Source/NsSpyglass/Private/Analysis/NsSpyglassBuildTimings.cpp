@@ -0,0 +1,438 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassBuildTimings.h"
+#include "Analysis/NsSpyglassContentRollup.h"
+#include "Async/ParallelFor.h"
+#include "Graph/NsSpyglassReachability.h"
+#include "HAL/PlatformFileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/PathViews.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    /** Cache file header. */
+    constexpr uint32 CacheMagic = 0x54425353; // 'SSBT'
+    constexpr uint32 CacheVersion = 1;
+
+    /** Bytes read from a trace at a time. */
+    constexpr int64 ReadChunkSize = 256 * 1024;
+
+    /** Whether a file in an Intermediate directory looks like a time trace of a translation unit, e.g. Module.Foo.cpp.json. */
+    bool IsTraceFile(const FStringView FileName)
+    {
+        return FileName.EndsWith(TEXT(".cpp.json"), ESearchCase::IgnoreCase)
+            || FileName.EndsWith(TEXT(".c.json"), ESearchCase::IgnoreCase);
+    }
+
+    /**
+     * Pulls event names and durations out of a Chrome trace as it streams by, without building a document.
+     * Only the members of objects directly inside an array are looked at, which are the trace events both for
+     * the {"traceEvents":[...]} layout clang writes and for a bare event array.
+     */
+    class FTraceScanner
+    {
+    public:
+
+        /** Scan the next bytes of the file. */
+        void Feed(const ANSICHAR* Data, const int64 Num)
+        {
+            for (int64 i = 0; i < Num; ++i)
+            {
+                Step(Data[i]);
+            }
+        }
+
+        /** Whether any trace event was seen. */
+        bool HasEvents() const { return NumEvents > 0; }
+
+        /** Time spent in the compiler, or the longest event when the trace has no ExecuteCompiler event. */
+        double GetCompileSeconds() const { return (CompilerMicros > 0.0 ? CompilerMicros : LongestMicros) / 1000000.0; }
+
+    private:
+
+        static constexpr int32 MaxDepth = 32;
+        static constexpr int32 MaxToken = 64;
+
+        bool IsEventLevel() const
+        {
+            return Depth >= 2 && Depth <= MaxDepth && Containers[Depth - 1] == '{' && Containers[Depth - 2] == '[';
+        }
+
+        void Append(const ANSICHAR Char)
+        {
+            if (TokenLen < MaxToken - 1)
+            {
+                Token[TokenLen++] = Char;
+            }
+        }
+
+        bool TokenIs(const ANSICHAR* Text) const
+        {
+            return FCStringAnsi::Strlen(Text) == TokenLen && FCStringAnsi::Strncmp(Token, Text, TokenLen) == 0;
+        }
+
+        void Step(const ANSICHAR Char)
+        {
+            if (bInString)
+            {
+                if (bEscape)
+                {
+                    bEscape = false;
+                    Append(Char);
+                }
+                else if (Char == '\\')
+                {
+                    bEscape = true;
+                }
+                else if (Char == '"')
+                {
+                    bInString = false;
+                    EndString();
+                }
+                else
+                {
+                    Append(Char);
+                }
+                return;
+            }
+
+            switch (Char)
+            {
+            case '"':
+                bInString = true;
+                TokenLen = 0;
+                break;
+            case '{':
+            case '[':
+                if (Depth < MaxDepth)
+                {
+                    Containers[Depth] = Char;
+                }
+                ++Depth;
+                break;
+            case '}':
+            case ']':
+                if (Char == '}' && IsEventLevel())
+                {
+                    EndValue();
+                    EndEvent();
+                }
+                Depth = FMath::Max(0, Depth - 1);
+                break;
+            case ':':
+                if (IsEventLevel())
+                {
+                    bInValue = true;
+                    TokenLen = 0;
+                }
+                break;
+            case ',':
+                if (IsEventLevel())
+                {
+                    EndValue();
+                }
+                break;
+            default:
+                if (bInValue && IsEventLevel() && (FChar::IsDigit(Char) || Char == '.' || Char == '-' || Char == '+' || Char == 'e' || Char == 'E'))
+                {
+                    Append(Char);
+                }
+                break;
+            }
+        }
+
+        void EndString()
+        {
+            if (!IsEventLevel())
+            {
+                return;
+            }
+
+            if (!bInValue)
+            {
+                bKeyIsName = TokenIs("name");
+                bKeyIsDur = TokenIs("dur");
+            }
+            else if (bKeyIsName)
+            {
+                bNameIsCompiler = TokenIs("ExecuteCompiler");
+                bHasName = true;
+            }
+            TokenLen = 0;
+        }
+
+        void EndValue()
+        {
+            if (bInValue && bKeyIsDur && TokenLen > 0)
+            {
+                Token[TokenLen] = '\0';
+                Duration = FCStringAnsi::Atod(Token);
+            }
+            bInValue = false;
+            bKeyIsName = false;
+            bKeyIsDur = false;
+            TokenLen = 0;
+        }
+
+        void EndEvent()
+        {
+            if (bHasName)
+            {
+                ++NumEvents;
+                LongestMicros = FMath::Max(LongestMicros, Duration);
+                if (bNameIsCompiler)
+                {
+                    CompilerMicros = FMath::Max(CompilerMicros, Duration);
+                }
+            }
+            bHasName = false;
+            bNameIsCompiler = false;
+            Duration = 0.0;
+        }
+
+        /** Open containers, '{' or '[', innermost last. */
+        ANSICHAR Containers[MaxDepth] = {};
+        int32 Depth = 0;
+
+        /** String or number being read, truncated to MaxToken. */
+        ANSICHAR Token[MaxToken] = {};
+        int32 TokenLen = 0;
+
+        bool bInString = false;
+        bool bEscape = false;
+        bool bInValue = false;
+
+        /** Member of the current event being read, and what was read so far. */
+        bool bKeyIsName = false;
+        bool bKeyIsDur = false;
+        bool bHasName = false;
+        bool bNameIsCompiler = false;
+        double Duration = 0.0;
+
+        int32 NumEvents = 0;
+        double CompilerMicros = 0.0;
+        double LongestMicros = 0.0;
+    };
+
+    /** Scan one trace. Returns the compile seconds, or a negative value when the file is not a trace. */
+    double ParseTrace(const FString& Path, const std::atomic<bool>& Cancel)
+    {
+        TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Path));
+        if (!Handle.IsValid())
+        {
+            return -1.0;
+        }
+
+        FTraceScanner Scanner;
+        TArray<ANSICHAR> Buffer;
+        Buffer.SetNumUninitialized(ReadChunkSize);
+        for (int64 Remaining = Handle->Size(); Remaining > 0 && !Cancel.load(std::memory_order_relaxed); )
+        {
+            const int64 ChunkSize = FMath::Min(Remaining, ReadChunkSize);
+            if (!Handle->Read(reinterpret_cast<uint8*>(Buffer.GetData()), ChunkSize))
+            {
+                return -1.0;
+            }
+            Scanner.Feed(Buffer.GetData(), ChunkSize);
+            Remaining -= ChunkSize;
+        }
+
+        return Scanner.HasEvents() ? Scanner.GetCompileSeconds() : -1.0;
+    }
+}
+
+FNsSpyglassBuildTimings::FNsSpyglassBuildTimings()
+    : Job([this](const FGatherInput& Input, FNsSpyglassBuildTimingResult& OutResult, FNsSpyglassGatherProgress& Progress)
+    {
+        Gather(Input, OutResult, Progress);
+    })
+    , TraceCache(TEXT("BuildTimings.cache"), CacheMagic, CacheVersion)
+{
+}
+
+FNsSpyglassBuildTimings& FNsSpyglassBuildTimings::Get()
+{
+    static FNsSpyglassBuildTimings Instance;
+    return Instance;
+}
+
+void FNsSpyglassBuildTimings::MakeInput(const TArray<FPluginNode>& Nodes, FGatherInput& OutInput)
+{
+    OutInput.Nodes = Nodes;
+    OutInput.PluginSetHash = FNsSpyglassContentRollup::ComputePluginSetHash(Nodes);
+
+    // Engine and project modules are traced too, they just have no node to land on
+    OutInput.Directories.Add(FPaths::ProjectIntermediateDir() / TEXT("Build"));
+    OutInput.Directories.Add(FPaths::EngineIntermediateDir() / TEXT("Build"));
+
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        if (!Nodes[i].Plugin.IsValid())
+        {
+            continue;
+        }
+
+        for (const FModuleDescriptor& Module : Nodes[i].Plugin->GetDescriptor().Modules)
+        {
+            OutInput.ModuleToNode.Add(Module.Name, i);
+        }
+        if (Nodes[i].Plugin->GetDescriptor().Modules.Num() > 0)
+        {
+            OutInput.Directories.AddUnique(Nodes[i].Plugin->GetBaseDir() / TEXT("Intermediate") / TEXT("Build"));
+        }
+    }
+}
+
+void FNsSpyglassBuildTimings::Gather(const FGatherInput& Input, FNsSpyglassBuildTimingResult& OutResult, FNsSpyglassGatherProgress& Progress)
+{
+    TraceCache.LoadOnce();
+
+    // Listing only stats the files, traces whose size and timestamp match the cache are not opened
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    TArray<FTraceEntry> Entries;
+    TArray<int32> ToParse;
+    for (const FString& Directory : Input.Directories)
+    {
+        if (Progress.IsCancelled() || !PlatformFile.DirectoryExists(*Directory))
+        {
+            continue;
+        }
+
+        PlatformFile.IterateDirectoryStatRecursively(*Directory, [this, &Entries, &ToParse, &Progress](const TCHAR* FilePath, const FFileStatData& Stat)
+        {
+            if (Stat.bIsDirectory || !IsTraceFile(FPathViews::GetCleanFilename(FilePath)))
+            {
+                return true;
+            }
+
+            FTraceEntry& Entry = Entries.AddDefaulted_GetRef();
+            Entry.Path = FilePath;
+            Entry.Timestamp = Stat.ModificationTime;
+            Entry.Size = Stat.FileSize;
+
+            if (const FTraceEntry* Cached = TraceCache.Find(Entry.Path, Entry.Timestamp, Entry.Size))
+            {
+                Entry.Module = Cached->Module;
+                Entry.Seconds = Cached->Seconds;
+            }
+            else
+            {
+                // UBT writes objects and their traces into a directory named after the module
+                Entry.Module = FPaths::GetCleanFilename(FPaths::GetPath(Entry.Path));
+                ToParse.Add(Entries.Num() - 1);
+            }
+            return !Progress.IsCancelled();
+        });
+    }
+
+    Progress.Total = ToParse.Num();
+    ParallelFor(ToParse.Num(), [&Entries, &ToParse, &Progress](const int32 Index)
+    {
+        if (!Progress.IsCancelled())
+        {
+            FTraceEntry& Entry = Entries[ToParse[Index]];
+            Entry.Seconds = ParseTrace(Entry.Path, Progress.bCancel);
+            Progress.Done.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    if (Progress.IsCancelled())
+    {
+        return;
+    }
+
+    // Traces of other plugin sets stay cached, only those of deleted files drop out
+    for (const FTraceEntry& Entry : Entries)
+    {
+        TraceCache.Add(Entry);
+    }
+    TraceCache.RemoveMissing();
+    TraceCache.Save();
+
+    // Several targets and configurations compile the same file, the newest trace of it counts
+    TMap<FString, int32> Newest;
+    for (int32 i = 0; i < Entries.Num(); ++i)
+    {
+        if (Entries[i].Seconds < 0.0)
+        {
+            continue;
+        }
+
+        const FString Key = Entries[i].Module / FPaths::GetCleanFilename(Entries[i].Path);
+        int32& Existing = Newest.FindOrAdd(Key, i);
+        if (Entries[Existing].Timestamp < Entries[i].Timestamp)
+        {
+            Existing = i;
+        }
+    }
+
+    TMap<FName, FNsSpyglassModuleTiming> Modules;
+    for (const TPair<FString, int32>& Pair : Newest)
+    {
+        const FTraceEntry& Entry = Entries[Pair.Value];
+        const FName ModuleName(*Entry.Module);
+        FNsSpyglassModuleTiming& Timing = Modules.FindOrAdd(ModuleName);
+        Timing.Module = ModuleName;
+        Timing.Seconds += Entry.Seconds;
+        ++Timing.NumFiles;
+    }
+
+    OutResult.PluginSetHash = Input.PluginSetHash;
+    OutResult.NumTraces = Entries.Num();
+    OutResult.NumParsed = ToParse.Num();
+    Modules.GenerateValueArray(OutResult.Modules);
+    OutResult.Modules.Sort([](const FNsSpyglassModuleTiming& A, const FNsSpyglassModuleTiming& B)
+    {
+        return A.Seconds > B.Seconds;
+    });
+
+    const int32 NumNodes = Input.Nodes.Num();
+    OutResult.ExclusiveSeconds.Init(0.0, NumNodes);
+    for (const FNsSpyglassModuleTiming& Timing : OutResult.Modules)
+    {
+        if (const int32* Node = Input.ModuleToNode.Find(Timing.Module))
+        {
+            OutResult.ExclusiveSeconds[*Node] += Timing.Seconds;
+        }
+    }
+
+    // Inclusive time is the cost of building a plugin together with everything it pulls in
+    FNsSpyglassReachability Reachability;
+    FNsSpyglassReachability::Compute(Input.Nodes, Reachability);
+    OutResult.InclusiveSeconds.Init(0.0, NumNodes);
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        double Total = OutResult.ExclusiveSeconds[Node];
+        for (TConstSetBitIterator<> It(Reachability.ComponentReach[Reachability.Components.ComponentOf[Node]]); It; ++It)
+        {
+            Total += It.GetIndex() != Node ? OutResult.ExclusiveSeconds[It.GetIndex()] : 0.0;
+        }
+        OutResult.InclusiveSeconds[Node] = Total;
+
+        if (OutResult.ExclusiveSeconds[Node] > OutResult.MaxExclusive)
+        {
+            OutResult.MaxExclusive = OutResult.ExclusiveSeconds[Node];
+            OutResult.HottestNode = Node;
+        }
+        OutResult.MaxInclusive = FMath::Max(OutResult.MaxInclusive, Total);
+    }
+}
+
+void FNsSpyglassBuildTimings::Request(const TArray<FPluginNode>& Nodes, bool bForce)
+{
+    check(IsInGameThread());
+
+    if (Job.Covers(FNsSpyglassContentRollup::ComputePluginSetHash(Nodes), bForce))
+    {
+        return;
+    }
+
+    TSharedPtr<FGatherInput, ESPMode::ThreadSafe> Input = MakeShared<FGatherInput, ESPMode::ThreadSafe>();
+    MakeInput(Nodes, *Input);
+    Job.Request(MoveTemp(Input));
+}
+
+void FNsSpyglassBuildTimings::Shutdown()
+{
+    Job.Shutdown();
+}
@@ -0,0 +1,340 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassContentRollup.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+    /** Pack a directed plugin pair into a single key. */
+    uint64 PackPair(int32 From, int32 To)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(From)) << 32) | static_cast<uint32>(To);
+    }
+
+    /** Find the plugin owning a package from its mount root, e.g. /MyPlugin/Maps/Level. */
+    int32 ResolveOwner(const TMap<FName, int32>& RootToNode, FName PackageName)
+    {
+        const FNameBuilder Builder(PackageName);
+        FStringView View = Builder.ToView();
+        if (View.Len() < 2 || View[0] != TEXT('/'))
+        {
+            return INDEX_NONE;
+        }
+
+        View.RightChopInline(1);
+        int32 Slash = INDEX_NONE;
+        if (!View.FindChar(TEXT('/'), Slash))
+        {
+            return INDEX_NONE;
+        }
+
+        // Only look up names that already exist so unknown roots do not grow the name table
+        const FName Root(View.Left(Slash), FNAME_Find);
+        if (Root.IsNone())
+        {
+            return INDEX_NONE;
+        }
+
+        const int32* Found = RootToNode.Find(Root);
+        return Found ? *Found : INDEX_NONE;
+    }
+}
+
+int32 FNsSpyglassContentResult::NumUndeclared() const
+{
+    int32 Count = 0;
+    for (const FNsSpyglassContentEdge& Edge : Edges)
+    {
+        Count += Edge.bDeclared ? 0 : 1;
+    }
+    return Count;
+}
+
+FNsSpyglassContentRollup::FNsSpyglassContentRollup()
+    : Job([](const FGatherInput& Input, FNsSpyglassContentResult& OutResult, FNsSpyglassGatherProgress& Progress)
+        {
+            Gather(Input, OutResult, &Progress.Done, &Progress.Total, &Progress.bCancel);
+        },
+        [this]()
+        {
+            return CanStartGather();
+        })
+{
+}
+
+FNsSpyglassContentRollup& FNsSpyglassContentRollup::Get()
+{
+    static FNsSpyglassContentRollup Instance;
+    return Instance;
+}
+
+uint32 FNsSpyglassContentRollup::ComputePluginSetHash(const TArray<FPluginNode>& Nodes)
+{
+    uint32 Hash = GetTypeHash(Nodes.Num());
+    for (const FPluginNode& Node : Nodes)
+    {
+        Hash = HashCombine(Hash, GetTypeHash(Node.Name));
+    }
+    return Hash;
+}
+
+void FNsSpyglassContentRollup::MakeInput(const TArray<FPluginNode>& Nodes, FGatherInput& OutInput)
+{
+    OutInput.PluginSetHash = ComputePluginSetHash(Nodes);
+    OutInput.NumNodes = Nodes.Num();
+
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        const FPluginNode& Node = Nodes[i];
+        if (Node.Plugin.IsValid() && Node.Plugin->CanContainContent())
+        {
+            OutInput.RootToNode.Add(FName(*Node.Plugin->GetName()), i);
+        }
+
+        for (int32 Dep : Node.Dependencies)
+        {
+            OutInput.Declared.Add(PackPair(i, Dep));
+        }
+    }
+}
+
+void FNsSpyglassContentRollup::GatherBlocking(const TArray<FPluginNode>& Nodes, FNsSpyglassContentResult& OutResult)
+{
+    FGatherInput Input;
+    MakeInput(Nodes, Input);
+
+    const double StartTime = FPlatformTime::Seconds();
+    Gather(Input, OutResult, nullptr, nullptr, nullptr);
+    OutResult.GatherSeconds = FPlatformTime::Seconds() - StartTime;
+}
+
+void FNsSpyglassContentRollup::Gather(const FGatherInput& Input, FNsSpyglassContentResult& OutResult, std::atomic<int32>* Processed, std::atomic<int32>* Total, const std::atomic<bool>* Cancel)
+{
+    IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+
+    OutResult.PluginSetHash = Input.PluginSetHash;
+    OutResult.Edges.Reset();
+    OutResult.ProjectReferences.Init(0, Input.NumNodes);
+
+    // Project content is gathered under a virtual owner past the last node so it can count references into plugins
+    TArray<TPair<FName, int32>> Roots;
+    Roots.Reserve(Input.RootToNode.Num() + 1);
+    for (const TPair<FName, int32>& Root : Input.RootToNode)
+    {
+        Roots.Emplace(Root.Key, Root.Value);
+    }
+    Roots.Emplace(FName(TEXT("Game")), Input.NumNodes);
+
+    // Enumerate on-disk packages per mount root. On-disk data is safe to read off the game thread.
+    TArray<FName> Packages;
+    TArray<int32> Owners;
+    for (const TPair<FName, int32>& Root : Roots)
+    {
+        if (Cancel && Cancel->load())
+        {
+            return;
+        }
+
+        TArray<FAssetData> Assets;
+        AssetRegistry.GetAssetsByPath(FName(*FString::Printf(TEXT("/%s"), *Root.Key.ToString())), Assets, true, true);
+
+        TSet<FName> Unique;
+        Unique.Reserve(Assets.Num());
+        for (const FAssetData& Asset : Assets)
+        {
+            bool bAlreadyInSet = false;
+            Unique.Add(Asset.PackageName, &bAlreadyInSet);
+            if (!bAlreadyInSet)
+            {
+                Packages.Add(Asset.PackageName);
+                Owners.Add(Root.Value);
+            }
+        }
+    }
+
+    OutResult.NumPackages = Packages.Num();
+    if (Total)
+    {
+        Total->store(Packages.Num());
+    }
+
+    // Every chunk aggregates into its own map so workers never contend
+    const int32 NumWorkers = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads());
+    const int32 NumChunks = FMath::Clamp(Packages.Num() / 512, 1, NumWorkers * 4);
+
+    TArray<TMap<uint64, FIntPoint>> ChunkCounts;
+    ChunkCounts.SetNum(NumChunks);
+
+    ParallelFor(NumChunks, [&](int32 Chunk)
+    {
+        const int32 Begin = static_cast<int32>(static_cast<int64>(Packages.Num()) * Chunk / NumChunks);
+        const int32 End = static_cast<int32>(static_cast<int64>(Packages.Num()) * (Chunk + 1) / NumChunks);
+
+        TMap<uint64, FIntPoint>& Counts = ChunkCounts[Chunk];
+        TArray<FName> Dependencies;
+        int32 SinceReport = 0;
+
+        for (int32 i = Begin; i < End; ++i)
+        {
+            if (Cancel && Cancel->load(std::memory_order_relaxed))
+            {
+                break;
+            }
+
+            const int32 Owner = Owners[i];
+            for (int32 Pass = 0; Pass < 2; ++Pass)
+            {
+                const bool bHard = Pass == 0;
+                Dependencies.Reset();
+                AssetRegistry.GetDependencies(Packages[i], Dependencies, UE::AssetRegistry::EDependencyCategory::Package,
+                    bHard ? UE::AssetRegistry::EDependencyQuery::Hard : UE::AssetRegistry::EDependencyQuery::Soft);
+
+                for (const FName Dependency : Dependencies)
+                {
+                    const int32 Target = ResolveOwner(Input.RootToNode, Dependency);
+                    if (Target == INDEX_NONE || Target == Owner)
+                    {
+                        continue;
+                    }
+
+                    FIntPoint& Count = Counts.FindOrAdd(PackPair(Owner, Target), FIntPoint::ZeroValue);
+                    ++(bHard ? Count.X : Count.Y);
+                }
+            }
+
+            if (Processed && ++SinceReport == 64)
+            {
+                Processed->fetch_add(SinceReport, std::memory_order_relaxed);
+                SinceReport = 0;
+            }
+        }
+
+        if (Processed)
+        {
+            Processed->fetch_add(SinceReport, std::memory_order_relaxed);
+        }
+    });
+
+    TMap<uint64, FIntPoint> Merged;
+    for (const TMap<uint64, FIntPoint>& Counts : ChunkCounts)
+    {
+        for (const TPair<uint64, FIntPoint>& Pair : Counts)
+        {
+            Merged.FindOrAdd(Pair.Key, FIntPoint::ZeroValue) += Pair.Value;
+        }
+    }
+
+    OutResult.Edges.Reserve(Merged.Num());
+    for (const TPair<uint64, FIntPoint>& Pair : Merged)
+    {
+        const int32 From = static_cast<int32>(Pair.Key >> 32);
+        const int32 To = static_cast<int32>(Pair.Key & 0xffffffff);
+        if (From == Input.NumNodes)
+        {
+            OutResult.ProjectReferences[To] += Pair.Value.X + Pair.Value.Y;
+            continue;
+        }
+
+        FNsSpyglassContentEdge& Edge = OutResult.Edges.AddDefaulted_GetRef();
+        Edge.From = From;
+        Edge.To = To;
+        Edge.HardReferences = Pair.Value.X;
+        Edge.SoftReferences = Pair.Value.Y;
+        Edge.bDeclared = Input.Declared.Contains(Pair.Key);
+    }
+
+    OutResult.Edges.Sort([](const FNsSpyglassContentEdge& A, const FNsSpyglassContentEdge& B)
+    {
+        return A.HardReferences + A.SoftReferences > B.HardReferences + B.SoftReferences;
+    });
+}
+
+void FNsSpyglassContentRollup::Request(const TArray<FPluginNode>& Nodes, bool bForce)
+{
+    check(IsInGameThread());
+
+    BindRegistryEvents();
+
+    if (!bDirty && Job.Covers(ComputePluginSetHash(Nodes), bForce))
+    {
+        return;
+    }
+
+    // Changes from here on are picked up by this gather at the earliest
+    bDirty = false;
+    TSharedPtr<FGatherInput, ESPMode::ThreadSafe> Input = MakeShared<FGatherInput, ESPMode::ThreadSafe>();
+    MakeInput(Nodes, *Input);
+    Job.Request(MoveTemp(Input));
+}
+
+bool FNsSpyglassContentRollup::CanStartGather()
+{
+    // Dependencies are incomplete until the initial scan is done, wait for it instead of blocking
+    IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+    if (!AssetRegistry.IsLoadingAssets())
+    {
+        return true;
+    }
+
+    if (!bWaitingForRegistry)
+    {
+        bWaitingForRegistry = true;
+        AssetRegistry.OnFilesLoaded().AddRaw(this, &FNsSpyglassContentRollup::OnRegistryFilesLoaded);
+    }
+    return false;
+}
+
+void FNsSpyglassContentRollup::Shutdown()
+{
+    Job.Shutdown();
+
+    if (bBoundToRegistry)
+    {
+        if (IAssetRegistry* AssetRegistry = IAssetRegistry::Get())
+        {
+            AssetRegistry->OnAssetAdded().RemoveAll(this);
+            AssetRegistry->OnAssetRemoved().RemoveAll(this);
+            AssetRegistry->OnAssetRenamed().RemoveAll(this);
+            AssetRegistry->OnAssetUpdated().RemoveAll(this);
+            AssetRegistry->OnFilesLoaded().RemoveAll(this);
+        }
+        bBoundToRegistry = false;
+    }
+
+    bWaitingForRegistry = false;
+}
+
+void FNsSpyglassContentRollup::OnRegistryFilesLoaded()
+{
+    IAssetRegistry::GetChecked().OnFilesLoaded().RemoveAll(this);
+    bWaitingForRegistry = false;
+
+    // Does nothing after a shutdown, which drops the waiting input
+    Job.Start();
+}
+
+void FNsSpyglassContentRollup::OnAssetChanged(const FAssetData& AssetData)
+{
+    bDirty = true;
+}
+
+void FNsSpyglassContentRollup::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    bDirty = true;
+}
+
+void FNsSpyglassContentRollup::BindRegistryEvents()
+{
+    if (bBoundToRegistry)
+    {
+        return;
+    }
+
+    IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+    AssetRegistry.OnAssetAdded().AddRaw(this, &FNsSpyglassContentRollup::OnAssetChanged);
+    AssetRegistry.OnAssetRemoved().AddRaw(this, &FNsSpyglassContentRollup::OnAssetChanged);
+    AssetRegistry.OnAssetUpdated().AddRaw(this, &FNsSpyglassContentRollup::OnAssetChanged);
+    AssetRegistry.OnAssetRenamed().AddRaw(this, &FNsSpyglassContentRollup::OnAssetRenamed);
+    bBoundToRegistry = true;
+}
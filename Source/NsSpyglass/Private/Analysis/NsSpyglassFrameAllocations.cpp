@@ -0,0 +1,191 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassFrameAllocations.h"
+#include "Containers/Ticker.h"
+#include "HAL/MemoryBase.h"
+#include "Stats/Stats.h"
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("Spyglass"), STATGROUP_NsSpyglass, STATCAT_Advanced);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Frame Allocations"), STAT_NsSpyglassFrameAllocations, STATGROUP_NsSpyglass);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Slate Element Allocations"), STAT_NsSpyglassSlateElementAllocations, STATGROUP_NsSpyglass);
+
+namespace
+{
+    /** Whether counting is on, and the allocations counted since the last frame. */
+    std::atomic<bool> bCounting{ false };
+    std::atomic<uint32> PendingCount{ 0 };
+    std::atomic<uint32> PendingSlateAllocations{ 0 };
+
+    /** Counts of the last finished frame. */
+    uint32 LastFrameCount = 0;
+    uint32 LastFrameSlateAllocations = 0;
+
+    /** Nesting of count and Slate scopes on this thread. Plain integers, so reading them never allocates. */
+    thread_local int32 CountDepth = 0;
+    thread_local int32 SlateDepth = 0;
+
+    /** Frame boundary registration. */
+    FTSTicker::FDelegateHandle TickerHandle;
+
+    void CountAllocation()
+    {
+        if (CountDepth > 0 && bCounting.load(std::memory_order_relaxed))
+        {
+            (SlateDepth > 0 ? PendingSlateAllocations : PendingCount).fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /** Forwards everything to the allocator it wraps and counts what the current thread allocates in a scope. */
+    class FCountingMalloc final : public FMalloc
+    {
+    public:
+
+        /** Allocator the proxy forwards to, set while installed. */
+        FMalloc* Inner = nullptr;
+
+        virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+        {
+            CountAllocation();
+            return Inner->Malloc(Count, Alignment);
+        }
+
+        virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+        {
+            CountAllocation();
+            return Inner->TryMalloc(Count, Alignment);
+        }
+
+        virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+        {
+            // Shrinking to nothing frees, anything else may move the block
+            if (Count > 0)
+            {
+                CountAllocation();
+            }
+            return Inner->Realloc(Original, Count, Alignment);
+        }
+
+        virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+        {
+            if (Count > 0)
+            {
+                CountAllocation();
+            }
+            return Inner->TryRealloc(Original, Count, Alignment);
+        }
+
+        virtual void Free(void* Original) override { Inner->Free(Original); }
+        virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+        virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+        virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+        virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+        virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+        virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+        virtual void UpdateStats() override { Inner->UpdateStats(); }
+        virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+        virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+        virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+        virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+        virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+    };
+
+    /**
+     * The one proxy. Never destroyed, so a thread that read GMalloc just before the swap back can still call
+     * through it, and Inner stays set after removal for the same reason.
+     */
+    FCountingMalloc& GetProxy()
+    {
+        static FCountingMalloc* Proxy = new FCountingMalloc();
+        return *Proxy;
+    }
+
+    /** The core ticker runs before Slate, so the pending counts are the whole last frame. */
+    bool TickEndFrame(float)
+    {
+        FNsSpyglassFrameAllocations::EndFrame();
+        return true;
+    }
+}
+
+void FNsSpyglassFrameAllocations::SetEnabled(const bool bEnable)
+{
+    check(IsInGameThread());
+    if (bEnable == IsEnabled())
+    {
+        return;
+    }
+
+    FCountingMalloc& Proxy = GetProxy();
+    if (bEnable)
+    {
+        // Still installed when another proxy wrapped it after the last enable
+        if (GMalloc != &Proxy)
+        {
+            Proxy.Inner = GMalloc;
+            GMalloc = &Proxy;
+        }
+
+        PendingCount = 0;
+        PendingSlateAllocations = 0;
+        LastFrameCount = 0;
+        LastFrameSlateAllocations = 0;
+        TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickEndFrame));
+        bCounting = true;
+    }
+    else
+    {
+        bCounting = false;
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+        TickerHandle.Reset();
+
+        // Only unwrap if nothing wrapped the proxy in turn, it then stays installed and just forwards
+        if (GMalloc == &Proxy)
+        {
+            GMalloc = Proxy.Inner;
+        }
+    }
+}
+
+bool FNsSpyglassFrameAllocations::IsEnabled()
+{
+    return bCounting.load(std::memory_order_relaxed);
+}
+
+void FNsSpyglassFrameAllocations::EndFrame()
+{
+    LastFrameCount = PendingCount.exchange(0, std::memory_order_relaxed);
+    LastFrameSlateAllocations = PendingSlateAllocations.exchange(0, std::memory_order_relaxed);
+    SET_DWORD_STAT(STAT_NsSpyglassFrameAllocations, LastFrameCount);
+    SET_DWORD_STAT(STAT_NsSpyglassSlateElementAllocations, LastFrameSlateAllocations);
+}
+
+uint32 FNsSpyglassFrameAllocations::GetLastFrameCount()
+{
+    return LastFrameCount;
+}
+
+uint32 FNsSpyglassFrameAllocations::GetLastFrameSlateAllocations()
+{
+    return LastFrameSlateAllocations;
+}
+
+FNsSpyglassFrameAllocations::FCountScope::FCountScope()
+{
+    ++CountDepth;
+}
+
+FNsSpyglassFrameAllocations::FCountScope::~FCountScope()
+{
+    --CountDepth;
+}
+
+FNsSpyglassFrameAllocations::FSlateScope::FSlateScope()
+{
+    ++SlateDepth;
+}
+
+FNsSpyglassFrameAllocations::FSlateScope::~FSlateScope()
+{
+    --SlateDepth;
+}
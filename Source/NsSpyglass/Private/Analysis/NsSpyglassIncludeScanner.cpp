@@ -0,0 +1,461 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassIncludeScanner.h"
+#include "Analysis/NsSpyglassContentRollup.h"
+#include "Async/MappedFileHandle.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformFileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/PathViews.h"
+#include "Misc/Paths.h"
+
+namespace
+{
+    /** Cache file header. */
+    constexpr uint32 CacheMagic = 0x49535353; // 'SSSI'
+    constexpr uint32 CacheVersion = 1;
+
+    /** Owner recorded for include paths that headers of more than one plugin answer to. */
+    constexpr int32 AmbiguousOwner = -2;
+
+    /** Module directories UBT puts on the include path of the modules depending on it. */
+    const TCHAR* const PublicIncludeDirs[] = { TEXT("Public/"), TEXT("Classes/"), TEXT("Internal/") };
+
+    /** Masks of the word at a time '#' test. */
+    constexpr uint64 ByteOnes = 0x0101010101010101ULL;
+    constexpr uint64 ByteHighs = 0x8080808080808080ULL;
+    constexpr uint64 HashBytes = ByteOnes * static_cast<uint64>('#');
+
+    /** A module of a plugin, found by its .Build.cs. */
+    struct FModuleDir
+    {
+        /** Directory holding the .Build.cs, with a trailing slash. */
+        FString Dir;
+
+        FName Name;
+    };
+
+    /** Pack a directed plugin pair into a single key. */
+    uint64 PackPair(const int32 From, const int32 To)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(From)) << 32) | static_cast<uint32>(To);
+    }
+
+    bool IsHeaderFile(const FStringView FileName)
+    {
+        return FileName.EndsWith(TEXT(".h"), ESearchCase::IgnoreCase)
+            || FileName.EndsWith(TEXT(".hpp"), ESearchCase::IgnoreCase)
+            || FileName.EndsWith(TEXT(".inl"), ESearchCase::IgnoreCase);
+    }
+
+    bool IsSourceFile(const FStringView FileName)
+    {
+        return IsHeaderFile(FileName)
+            || FileName.EndsWith(TEXT(".cpp"), ESearchCase::IgnoreCase)
+            || FileName.EndsWith(TEXT(".cc"), ESearchCase::IgnoreCase)
+            || FileName.EndsWith(TEXT(".c"), ESearchCase::IgnoreCase);
+    }
+
+    /** Lookup key of an include path: forward slashes, lower case. */
+    FString MakeIncludeKey(const FStringView Path)
+    {
+        FString Key(Path);
+        Key.ReplaceCharInline(TEXT('\\'), TEXT('/'));
+        Key.ToLowerInline();
+        return Key;
+    }
+
+    /** Innermost module around a file. Modules are sorted deepest first. */
+    const FModuleDir* FindModule(const TArray<FModuleDir>& Modules, const FString& Path)
+    {
+        return Modules.FindByPredicate([&Path](const FModuleDir& Module) { return Path.StartsWith(Module.Dir); });
+    }
+
+    /** Whether any of the eight bytes of a word is '#': the zero byte test applied to the word xor '#'. */
+    bool HasHashByte(const uint64 Word)
+    {
+        const uint64 Diff = Word ^ HashBytes;
+        return ((Diff - ByteOnes) & ~Diff & ByteHighs) != 0;
+    }
+
+    bool IsBlank(const ANSICHAR Char)
+    {
+        return Char == ' ' || Char == '\t';
+    }
+
+    /** Whether only blanks stand between the start of the line and Pos. */
+    bool StartsLine(const ANSICHAR* Data, int64 Pos)
+    {
+        while (Pos > 0)
+        {
+            const ANSICHAR Char = Data[--Pos];
+            if (Char == '\n' || Char == '\r')
+            {
+                return true;
+            }
+            if (!IsBlank(Char))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Read an include directive following a '#', leaving Pos behind what was read. */
+    void ReadDirective(const ANSICHAR* Data, const int64 Num, int64& Pos, TArray<FString>& OutIncludes)
+    {
+        static constexpr ANSICHAR Keyword[] = "include";
+        constexpr int64 KeywordLen = UE_ARRAY_COUNT(Keyword) - 1;
+
+        while (Pos < Num && IsBlank(Data[Pos]))
+        {
+            ++Pos;
+        }
+        if (Num - Pos < KeywordLen || FCStringAnsi::Strncmp(Data + Pos, Keyword, KeywordLen) != 0)
+        {
+            return;
+        }
+        Pos += KeywordLen;
+        while (Pos < Num && IsBlank(Data[Pos]))
+        {
+            ++Pos;
+        }
+
+        // Macro includes and #include_next stop here
+        if (Pos >= Num || (Data[Pos] != '"' && Data[Pos] != '<'))
+        {
+            return;
+        }
+
+        const ANSICHAR Close = Data[Pos] == '"' ? '"' : '>';
+        const int64 Start = ++Pos;
+        while (Pos < Num && Data[Pos] != Close && Data[Pos] != '\n')
+        {
+            ++Pos;
+        }
+        if (Pos < Num && Data[Pos] == Close && Pos > Start)
+        {
+            OutIncludes.Emplace(static_cast<int32>(Pos - Start), Data + Start);
+        }
+    }
+
+    /** Collect the include directives of a source file held in memory. */
+    void ExtractIncludes(const ANSICHAR* Data, const int64 Num, TArray<FString>& OutIncludes)
+    {
+        int64 Pos = 0;
+        while (Pos < Num)
+        {
+            // Most of a file holds no '#', skip it a word at a time
+            while (Pos + 8 <= Num)
+            {
+                uint64 Word;
+                FMemory::Memcpy(&Word, Data + Pos, sizeof(Word));
+                if (HasHashByte(Word))
+                {
+                    break;
+                }
+                Pos += 8;
+            }
+            while (Pos < Num && Data[Pos] != '#')
+            {
+                ++Pos;
+            }
+            if (Pos >= Num)
+            {
+                return;
+            }
+
+            const int64 Hash = Pos++;
+            if (StartsLine(Data, Hash))
+            {
+                ReadDirective(Data, Num, Pos, OutIncludes);
+            }
+        }
+    }
+
+    /** Scan one source file, mapped into memory where the platform supports it. */
+    void ScanFile(const FString& Path, TArray<FString>& OutIncludes)
+    {
+        OutIncludes.Reset();
+
+        TUniquePtr<IMappedFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+        if (Handle.IsValid() && Handle->GetFileSize() > 0)
+        {
+            TUniquePtr<IMappedFileRegion> Region(Handle->MapRegion(0, Handle->GetFileSize()));
+            if (Region.IsValid())
+            {
+                ExtractIncludes(reinterpret_cast<const ANSICHAR*>(Region->GetMappedPtr()), Region->GetMappedSize(), OutIncludes);
+                return;
+            }
+        }
+
+        TArray<uint8> Bytes;
+        if (FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent))
+        {
+            ExtractIncludes(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num(), OutIncludes);
+        }
+    }
+}
+
+int32 FNsSpyglassIncludeResult::NumUndeclared() const
+{
+    int32 Count = 0;
+    for (const FNsSpyglassIncludeEdge& Edge : Edges)
+    {
+        Count += Edge.bDeclared ? 0 : 1;
+    }
+    return Count;
+}
+
+FNsSpyglassIncludeScanner::FNsSpyglassIncludeScanner()
+    : Job([this](const FGatherInput& Input, FNsSpyglassIncludeResult& OutResult, FNsSpyglassGatherProgress& Progress)
+    {
+        Gather(Input, OutResult, Progress);
+    })
+    , SourceCache(TEXT("Includes.cache"), CacheMagic, CacheVersion)
+{
+}
+
+FNsSpyglassIncludeScanner& FNsSpyglassIncludeScanner::Get()
+{
+    static FNsSpyglassIncludeScanner Instance;
+    return Instance;
+}
+
+void FNsSpyglassIncludeScanner::MakeInput(const TArray<FPluginNode>& Nodes, FGatherInput& OutInput)
+{
+    OutInput.PluginSetHash = FNsSpyglassContentRollup::ComputePluginSetHash(Nodes);
+    OutInput.SourceDirs.SetNum(Nodes.Num());
+
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        const FPluginNode& Node = Nodes[i];
+        if (Node.Plugin.IsValid() && Node.Plugin->GetDescriptor().Modules.Num() > 0)
+        {
+            OutInput.SourceDirs[i] = FPaths::ConvertRelativePathToFull(Node.Plugin->GetBaseDir() / TEXT("Source"));
+        }
+
+        for (const int32 Dep : Node.Dependencies)
+        {
+            OutInput.Declared.Add(PackPair(i, Dep));
+        }
+    }
+}
+
+void FNsSpyglassIncludeScanner::Gather(const FGatherInput& Input, FNsSpyglassIncludeResult& OutResult, FNsSpyglassGatherProgress& Progress)
+{
+    SourceCache.LoadOnce();
+
+    /** What the walk found under one plugin. */
+    struct FPluginSources
+    {
+        TArray<FSourceEntry> Files;
+        TArray<int32> ToScan;
+        TArray<FModuleDir> Modules;
+    };
+
+    const int32 NumNodes = Input.SourceDirs.Num();
+    TArray<FPluginSources> Plugins;
+    Plugins.SetNum(NumNodes);
+
+    // Plugins are walked in parallel. Walking only stats files, sources matching the cache are not opened
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    ParallelFor(NumNodes, [this, &Input, &Plugins, &PlatformFile, &Progress](const int32 Node)
+    {
+        const FString& SourceDir = Input.SourceDirs[Node];
+        if (SourceDir.IsEmpty() || Progress.IsCancelled() || !PlatformFile.DirectoryExists(*SourceDir))
+        {
+            return;
+        }
+
+        FPluginSources& Sources = Plugins[Node];
+        PlatformFile.IterateDirectoryStatRecursively(*SourceDir, [this, &Sources, &Progress](const TCHAR* FilePath, const FFileStatData& Stat)
+        {
+            if (Stat.bIsDirectory)
+            {
+                return true;
+            }
+
+            const FStringView FileName = FPathViews::GetCleanFilename(FilePath);
+            if (FileName.EndsWith(TEXT(".Build.cs"), ESearchCase::IgnoreCase))
+            {
+                FModuleDir& Module = Sources.Modules.AddDefaulted_GetRef();
+                Module.Dir = FString(FPathViews::GetPath(FilePath)) + TEXT("/");
+                Module.Name = FName(FileName.LeftChop(9));
+                return true;
+            }
+            if (!IsSourceFile(FileName))
+            {
+                return true;
+            }
+
+            FSourceEntry& Entry = Sources.Files.AddDefaulted_GetRef();
+            Entry.Path = FilePath;
+            Entry.Timestamp = Stat.ModificationTime;
+            Entry.Size = Stat.FileSize;
+
+            if (const FSourceEntry* Cached = SourceCache.Find(Entry.Path, Entry.Timestamp, Entry.Size))
+            {
+                Entry.Includes = Cached->Includes;
+            }
+            else
+            {
+                Sources.ToScan.Add(Sources.Files.Num() - 1);
+            }
+            return !Progress.IsCancelled();
+        });
+
+        // Nested modules go before the modules around them
+        Sources.Modules.Sort([](const FModuleDir& A, const FModuleDir& B) { return A.Dir.Len() > B.Dir.Len(); });
+    });
+
+    TArray<FIntPoint> ToScan;
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        for (const int32 File : Plugins[Node].ToScan)
+        {
+            ToScan.Emplace(Node, File);
+        }
+    }
+
+    Progress.Total = ToScan.Num();
+    ParallelFor(ToScan.Num(), [&Plugins, &ToScan, &Progress](const int32 Index)
+    {
+        if (!Progress.IsCancelled())
+        {
+            FSourceEntry& Entry = Plugins[ToScan[Index].X].Files[ToScan[Index].Y];
+            ScanFile(Entry.Path, Entry.Includes);
+            Progress.Done.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+    if (Progress.IsCancelled())
+    {
+        return;
+    }
+
+    // Sources of other plugin sets stay cached, only those of deleted files drop out
+    for (const FPluginSources& Sources : Plugins)
+    {
+        for (const FSourceEntry& Entry : Sources.Files)
+        {
+            SourceCache.Add(Entry);
+        }
+    }
+    SourceCache.RemoveMissing();
+    SourceCache.Save();
+
+    /** Plugin and module providing a header. */
+    struct FHeaderOwner
+    {
+        int32 Node = INDEX_NONE;
+        FName Module;
+    };
+
+    // Every public header answers to its path below the include directory of its module
+    TMap<FString, FHeaderOwner> Headers;
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        const FPluginSources& Sources = Plugins[Node];
+        for (const FSourceEntry& Entry : Sources.Files)
+        {
+            const FModuleDir* Module = IsHeaderFile(FPathViews::GetCleanFilename(Entry.Path)) ? FindModule(Sources.Modules, Entry.Path) : nullptr;
+            if (!Module)
+            {
+                continue;
+            }
+
+            const FStringView Relative = FStringView(Entry.Path).RightChop(Module->Dir.Len());
+            for (const TCHAR* IncludeDir : PublicIncludeDirs)
+            {
+                if (!Relative.StartsWith(IncludeDir, ESearchCase::IgnoreCase))
+                {
+                    continue;
+                }
+
+                const FString Key = MakeIncludeKey(Relative.RightChop(FCString::Strlen(IncludeDir)));
+                if (FHeaderOwner* Existing = Headers.Find(Key))
+                {
+                    Existing->Node = Existing->Node == Node ? Node : AmbiguousOwner;
+                }
+                else
+                {
+                    Headers.Add(Key, FHeaderOwner{ Node, Module->Name });
+                }
+                break;
+            }
+        }
+    }
+
+    // Resolve per including plugin in parallel, each into its own map
+    TArray<TMap<int32, FNsSpyglassIncludeEdge>> NodeEdges;
+    NodeEdges.SetNum(NumNodes);
+    TArray<FIntPoint> NodeCounts;
+    NodeCounts.Init(FIntPoint::ZeroValue, NumNodes);
+    ParallelFor(NumNodes, [&Input, &Plugins, &Headers, &NodeEdges, &NodeCounts](const int32 Node)
+    {
+        const FPluginSources& Sources = Plugins[Node];
+        for (const FSourceEntry& Entry : Sources.Files)
+        {
+            for (const FString& Include : Entry.Includes)
+            {
+                ++NodeCounts[Node].X;
+                const FHeaderOwner* Owner = Headers.Find(MakeIncludeKey(Include));
+                if (!Owner || Owner->Node == AmbiguousOwner || Owner->Node == Node)
+                {
+                    continue;
+                }
+
+                ++NodeCounts[Node].Y;
+                FNsSpyglassIncludeEdge& Edge = NodeEdges[Node].FindOrAdd(Owner->Node);
+                if (Edge.NumIncludes++ == 0)
+                {
+                    const FModuleDir* Module = FindModule(Sources.Modules, Entry.Path);
+                    Edge.From = Node;
+                    Edge.To = Owner->Node;
+                    Edge.FromModule = Module ? Module->Name : NAME_None;
+                    Edge.ToModule = Owner->Module;
+                    Edge.ExampleFile = Entry.Path;
+                    Edge.ExampleInclude = Include;
+                    Edge.bDeclared = Input.Declared.Contains(PackPair(Node, Owner->Node));
+                }
+            }
+        }
+    });
+
+    OutResult.PluginSetHash = Input.PluginSetHash;
+    OutResult.NumScanned = ToScan.Num();
+    for (int32 Node = 0; Node < NumNodes; ++Node)
+    {
+        OutResult.NumFiles += Plugins[Node].Files.Num();
+        OutResult.NumIncludes += NodeCounts[Node].X;
+        OutResult.NumResolved += NodeCounts[Node].Y;
+        for (TPair<int32, FNsSpyglassIncludeEdge>& Pair : NodeEdges[Node])
+        {
+            OutResult.Edges.Add(MoveTemp(Pair.Value));
+        }
+    }
+
+    OutResult.Edges.Sort([](const FNsSpyglassIncludeEdge& A, const FNsSpyglassIncludeEdge& B)
+    {
+        return A.NumIncludes > B.NumIncludes;
+    });
+}
+
+void FNsSpyglassIncludeScanner::Request(const TArray<FPluginNode>& Nodes, bool bForce)
+{
+    check(IsInGameThread());
+
+    if (Job.Covers(FNsSpyglassContentRollup::ComputePluginSetHash(Nodes), bForce))
+    {
+        return;
+    }
+
+    TSharedPtr<FGatherInput, ESPMode::ThreadSafe> Input = MakeShared<FGatherInput, ESPMode::ThreadSafe>();
+    MakeInput(Nodes, *Input);
+    Job.Request(MoveTemp(Input));
+}
+
+void FNsSpyglassIncludeScanner::Shutdown()
+{
+    Job.Shutdown();
+}
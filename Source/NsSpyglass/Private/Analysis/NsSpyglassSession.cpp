@@ -0,0 +1,115 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassSession.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Settings/NsSpyglassSettings.h"
+
+FNsSpyglassSessionSettings FNsSpyglassSessionSettings::Capture()
+{
+    const UNsSpyglassSettings* Source = UNsSpyglassSettings::GetSettings();
+
+    FNsSpyglassSessionSettings Result;
+    Result.Repulsion = Source->Repulsion;
+    Result.CenterForce = Source->CenterForce;
+    Result.AttractionScale = Source->AttractionScale;
+    Result.FocusHops = Source->FocusHops;
+    Result.FocusDirection = static_cast<uint8>(Source->FocusDirection);
+    Result.bBundleEdges = Source->bBundleEdges;
+    return Result;
+}
+
+void FNsSpyglassSessionSettings::Apply() const
+{
+    UNsSpyglassSettings* Target = GetMutableDefault<UNsSpyglassSettings>();
+    check(Target);
+
+    Target->Repulsion = Repulsion;
+    Target->CenterForce = CenterForce;
+    Target->AttractionScale = AttractionScale;
+    Target->FocusHops = FocusHops;
+    Target->FocusDirection = static_cast<ENsSpyglassFocusDirection>(FocusDirection);
+    Target->bBundleEdges = bBundleEdges;
+}
+
+bool FNsSpyglassSessionSettings::operator==(const FNsSpyglassSessionSettings& Other) const
+{
+    return Repulsion == Other.Repulsion
+        && CenterForce == Other.CenterForce
+        && AttractionScale == Other.AttractionScale
+        && FocusHops == Other.FocusHops
+        && FocusDirection == Other.FocusDirection
+        && bBundleEdges == Other.bBundleEdges;
+}
+
+FArchive& operator<<(FArchive& Ar, FNsSpyglassSessionSettings& Settings)
+{
+    return Ar << Settings.Repulsion << Settings.CenterForce << Settings.AttractionScale << Settings.FocusHops << Settings.FocusDirection << Settings.bBundleEdges;
+}
+
+FArchive& operator<<(FArchive& Ar, FNsSpyglassSessionEvent& Event)
+{
+    uint8 Type = static_cast<uint8>(Event.Type);
+    Ar << Event.Frame << Type << Event.Position << Event.Button << Event.WheelDelta << Event.Text << Event.Settings;
+    Event.Type = static_cast<ENsSpyglassSessionEventType>(Type);
+    return Ar;
+}
+
+bool FNsSpyglassSession::Save(const FString& FilePath) const
+{
+    TArray<uint8> Buffer;
+    FMemoryWriter Writer(Buffer);
+
+    uint32 FileMagic = Magic;
+    uint32 FileVersion = Version;
+    Writer << FileMagic << FileVersion;
+
+    // The archive operators are symmetric, so write through a mutable copy
+    FNsSpyglassSession& Self = const_cast<FNsSpyglassSession&>(*this);
+    Writer << Self.Seed << Self.Settings << Self.ViewSize << Self.ViewScale << Self.ViewOffset << Self.ZoomAmount << Self.LayoutMode << Self.FilterText;
+    Writer << Self.Snapshot << Self.FrameDeltas << Self.Events;
+
+    return FFileHelper::SaveArrayToFile(Buffer, *FilePath);
+}
+
+bool FNsSpyglassSession::Load(const FString& FilePath, FString& OutError)
+{
+    TArray<uint8> Buffer;
+    if (!FFileHelper::LoadFileToArray(Buffer, *FilePath))
+    {
+        OutError = FString::Printf(TEXT("Could not read %s"), *FilePath);
+        return false;
+    }
+
+    FMemoryReader Reader(Buffer);
+    uint32 FileMagic = 0;
+    uint32 FileVersion = 0;
+    Reader << FileMagic << FileVersion;
+    if (FileMagic != Magic)
+    {
+        OutError = TEXT("Not a Spyglass session");
+        return false;
+    }
+    if (FileVersion != Version)
+    {
+        OutError = FString::Printf(TEXT("Unsupported session version %u"), FileVersion);
+        return false;
+    }
+
+    Reader << Seed << Settings << ViewSize << ViewScale << ViewOffset << ZoomAmount << LayoutMode << FilterText;
+    Reader << Snapshot << FrameDeltas << Events;
+    if (Reader.IsError())
+    {
+        OutError = TEXT("Session is truncated");
+        return false;
+    }
+
+    return true;
+}
+
+FString FNsSpyglassSession::GetDefaultDirectory()
+{
+    return FPaths::ProjectSavedDir() / TEXT("Spyglass") / TEXT("Sessions");
+}
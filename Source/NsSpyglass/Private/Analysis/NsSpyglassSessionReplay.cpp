@@ -0,0 +1,195 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassSessionReplay.h"
+#include "Async/Async.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Rendering/DrawElements.h"
+#include "Types/PaintArgs.h"
+#include "Widgets/SNsSpyglassGraphWidget.h"
+#include "Widgets/SWindow.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogNsSpyglassReplay, Log, All);
+
+namespace
+{
+    /** The running replay. */
+    TUniquePtr<FNsSpyglassSessionReplay> ActiveReplay;
+
+    /** Mean, 95th percentile and maximum of one timing column. */
+    FString Summarize(const TArray<FNsSpyglassReplayFrame>& Frames, double FNsSpyglassReplayFrame::* Column)
+    {
+        TArray<double> Values;
+        Values.Reserve(Frames.Num());
+        double Sum = 0.0;
+        for (const FNsSpyglassReplayFrame& Frame : Frames)
+        {
+            Values.Add(Frame.*Column);
+            Sum += Frame.*Column;
+        }
+        if (Values.Num() == 0)
+        {
+            return FString();
+        }
+
+        Values.Sort();
+        const double P95 = Values[FMath::Min(Values.Num() - 1, FMath::FloorToInt(Values.Num() * 0.95))];
+        return FString::Printf(TEXT("mean %.3f ms, p95 %.3f ms, max %.3f ms"), Sum / Values.Num(), P95, Values.Last());
+    }
+}
+
+bool FNsSpyglassSessionReplay::Start(const FString& SessionPath, FString& OutError)
+{
+    if (ActiveReplay.IsValid())
+    {
+        OutError = TEXT("A replay is already running");
+        return false;
+    }
+
+    TUniquePtr<FNsSpyglassSessionReplay> Replay = MakeUnique<FNsSpyglassSessionReplay>();
+    if (!Replay->Session.Load(SessionPath, OutError))
+    {
+        return false;
+    }
+    if (Replay->Session.FrameDeltas.Num() == 0)
+    {
+        OutError = TEXT("Session has no frames");
+        return false;
+    }
+
+    // The solver reads the editor settings, run it with the recorded ones
+    Replay->SessionPath = SessionPath;
+    Replay->SavedSettings = FNsSpyglassSessionSettings::Capture();
+    Replay->Session.Settings.Apply();
+
+    Replay->Widget = SNew(SNsSpyglassGraphWidget);
+    if (!Replay->Widget->BeginReplay(Replay->Session, OutError))
+    {
+        Replay->SavedSettings.Apply();
+        return false;
+    }
+
+    Replay->Window = SNew(SWindow).ClientSize(Replay->Session.ViewSize * Replay->Session.ViewScale);
+    Replay->Elements = MakeUnique<FSlateWindowElementList>(Replay->Window);
+    Replay->Frames.Reserve(Replay->Session.FrameDeltas.Num());
+    Replay->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(Replay.Get(), &FNsSpyglassSessionReplay::Step));
+
+    UE_LOG(LogNsSpyglassReplay, Display, TEXT("Replaying %d frames and %d events of %s"), Replay->Session.FrameDeltas.Num(), Replay->Session.Events.Num(), *SessionPath);
+    ActiveReplay = MoveTemp(Replay);
+    return true;
+}
+
+bool FNsSpyglassSessionReplay::IsRunning()
+{
+    return ActiveReplay.IsValid();
+}
+
+FNsSpyglassSessionReplay::~FNsSpyglassSessionReplay()
+{
+    if (TickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+    }
+}
+
+void FNsSpyglassSessionReplay::Dispatch(const FNsSpyglassSessionEvent& Event)
+{
+    const FGeometry Geometry = FGeometry::MakeRoot(Session.ViewSize, FSlateLayoutTransform(Session.ViewScale));
+    const FVector2D ScreenPos = FVector2D(Event.Position) * Session.ViewScale;
+    const FKey Button = Event.Button == 1 ? EKeys::RightMouseButton : EKeys::LeftMouseButton;
+
+    switch (Event.Type)
+    {
+    case ENsSpyglassSessionEventType::MouseDown:
+        Widget->OnMouseButtonDown(Geometry, FPointerEvent(0, ScreenPos, ScreenPos, TSet<FKey>{ Button }, Button, 0.f, FModifierKeysState()));
+        break;
+    case ENsSpyglassSessionEventType::MouseUp:
+        Widget->OnMouseButtonUp(Geometry, FPointerEvent(0, ScreenPos, ScreenPos, TSet<FKey>(), Button, 0.f, FModifierKeysState()));
+        break;
+    case ENsSpyglassSessionEventType::DoubleClick:
+        Widget->OnMouseButtonDoubleClick(Geometry, FPointerEvent(0, ScreenPos, ScreenPos, TSet<FKey>{ Button }, Button, 0.f, FModifierKeysState()));
+        break;
+    case ENsSpyglassSessionEventType::MouseMove:
+        Widget->OnMouseMove(Geometry, FPointerEvent(0, ScreenPos, ScreenPos, TSet<FKey>(), EKeys::Invalid, 0.f, FModifierKeysState()));
+        break;
+    case ENsSpyglassSessionEventType::Wheel:
+        Widget->OnMouseWheel(Geometry, FPointerEvent(0, ScreenPos, ScreenPos, TSet<FKey>(), EKeys::Invalid, Event.WheelDelta, FModifierKeysState()));
+        break;
+    case ENsSpyglassSessionEventType::Filter:
+        Widget->SetFilter(Event.Text);
+        break;
+    case ENsSpyglassSessionEventType::LayoutMode:
+        Widget->SetLayoutMode(static_cast<ENsSpyglassLayoutMode>(Event.Button));
+        break;
+    case ENsSpyglassSessionEventType::Settings:
+        Event.Settings.Apply();
+        break;
+    }
+}
+
+bool FNsSpyglassSessionReplay::Step(float DeltaTime)
+{
+    while (Session.Events.IsValidIndex(NextEvent) && Session.Events[NextEvent].Frame <= static_cast<uint32>(Frame))
+    {
+        Dispatch(Session.Events[NextEvent++]);
+    }
+
+    const float Delta = Session.FrameDeltas[Frame];
+    CurrentTime += Delta;
+    const FGeometry Geometry = FGeometry::MakeRoot(Session.ViewSize, FSlateLayoutTransform(Session.ViewScale));
+
+    FNsSpyglassReplayFrame& Result = Frames.AddDefaulted_GetRef();
+    Result.DeltaTime = Delta;
+
+    double StartTime = FPlatformTime::Seconds();
+    Widget->Tick(Geometry, CurrentTime, Delta);
+    Result.TickMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    Result.SolverMs = Widget->GetLastSolverSeconds() * 1000.0;
+
+    // Elements are built like a visible frame, then dropped instead of rendered
+    Elements->ResetElementList();
+    const FPaintArgs Args(nullptr, HittestGrid, FVector2D::ZeroVector, CurrentTime, Delta);
+    const FSlateRect CullingRect(FVector2D::ZeroVector, Session.ViewSize * Session.ViewScale);
+    StartTime = FPlatformTime::Seconds();
+    Widget->OnPaint(Args, Geometry, CullingRect, *Elements, 0, FWidgetStyle(), true);
+    Result.PaintMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    if (++Frame < Session.FrameDeltas.Num())
+    {
+        return true;
+    }
+
+    Finish();
+    TickerHandle.Reset();
+
+    // Not from inside our own tick
+    AsyncTask(ENamedThreads::GameThread, []()
+    {
+        ActiveReplay.Reset();
+    });
+    return false;
+}
+
+void FNsSpyglassSessionReplay::Finish()
+{
+    SavedSettings.Apply();
+
+    FString Csv = TEXT("Frame,DeltaMs,TickMs,SolverMs,PaintMs\n");
+    for (int32 i = 0; i < Frames.Num(); ++i)
+    {
+        const FNsSpyglassReplayFrame& Result = Frames[i];
+        Csv += FString::Printf(TEXT("%d,%.3f,%.3f,%.3f,%.3f\n"), i, Result.DeltaTime * 1000.f, Result.TickMs, Result.SolverMs, Result.PaintMs);
+    }
+
+    const FString ReportPath = FPaths::GetPath(SessionPath) / FPaths::GetBaseFilename(SessionPath) + TEXT("-Replay.csv");
+    if (!FFileHelper::SaveStringToFile(Csv, *ReportPath))
+    {
+        UE_LOG(LogNsSpyglassReplay, Error, TEXT("Failed to write %s"), *ReportPath);
+    }
+
+    UE_LOG(LogNsSpyglassReplay, Display, TEXT("Replayed %d frames of %s"), Frames.Num(), *SessionPath);
+    UE_LOG(LogNsSpyglassReplay, Display, TEXT("Tick:   %s"), *Summarize(Frames, &FNsSpyglassReplayFrame::TickMs));
+    UE_LOG(LogNsSpyglassReplay, Display, TEXT("Solver: %s"), *Summarize(Frames, &FNsSpyglassReplayFrame::SolverMs));
+    UE_LOG(LogNsSpyglassReplay, Display, TEXT("Paint:  %s"), *Summarize(Frames, &FNsSpyglassReplayFrame::PaintMs));
+    UE_LOG(LogNsSpyglassReplay, Display, TEXT("Per frame timings written to %s"), *ReportPath);
+}
@@ -0,0 +1,258 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassUnusedPlugins.h"
+#include "Analysis/NsSpyglassContentRollup.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Interfaces/IProjectManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "ProjectDescriptor.h"
+#include "Serialization/JsonWriter.h"
+
+bool FNsSpyglassUnusedResult::Contains(int32 Node) const
+{
+    return Candidates.ContainsByPredicate([Node](const FNsSpyglassUnusedPlugin& Candidate)
+    {
+        return Candidate.Node == Node;
+    });
+}
+
+void FNsSpyglassUnusedPluginFinder::Find(const TArray<FPluginNode>& Nodes, const FNsSpyglassContentResult* Content, FNsSpyglassUnusedResult& OutResult)
+{
+    OutResult.PluginSetHash = FNsSpyglassContentRollup::ComputePluginSetHash(Nodes);
+    OutResult.Candidates.Reset();
+    OutResult.bCheckedContent = Content && Content->PluginSetHash == OutResult.PluginSetHash;
+
+    TBitArray<> Referenced(false, Nodes.Num());
+
+    // Plugins whose content is referenced by other plugins or the project
+    if (OutResult.bCheckedContent)
+    {
+        for (const FNsSpyglassContentEdge& Edge : Content->Edges)
+        {
+            if (Nodes.IsValidIndex(Edge.To))
+            {
+                Referenced[Edge.To] = true;
+            }
+        }
+        for (int32 i = 0; i < Content->ProjectReferences.Num() && i < Nodes.Num(); ++i)
+        {
+            if (Content->ProjectReferences[i] > 0)
+            {
+                Referenced[i] = true;
+            }
+        }
+    }
+
+    FindReferencedModules(Nodes, Referenced);
+
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        const FPluginNode& Node = Nodes[i];
+        if (Referenced[i] || Node.Dependents.Num() > 0 || !Node.Plugin.IsValid())
+        {
+            continue;
+        }
+
+        FNsSpyglassUnusedPlugin& Candidate = OutResult.Candidates.AddDefaulted_GetRef();
+        Candidate.Node = i;
+        Candidate.Name = Node.Name;
+        Candidate.NumModules = Node.Plugin->GetDescriptor().Modules.Num();
+        Candidate.BinaryBytes = GetBinarySize(*Node.Plugin);
+    }
+
+    OutResult.Candidates.Sort([](const FNsSpyglassUnusedPlugin& A, const FNsSpyglassUnusedPlugin& B)
+    {
+        if (A.BinaryBytes != B.BinaryBytes)
+        {
+            return A.BinaryBytes > B.BinaryBytes;
+        }
+        return A.NumModules > B.NumModules;
+    });
+}
+
+void FNsSpyglassUnusedPluginFinder::FindReferencedModules(const TArray<FPluginNode>& Nodes, TBitArray<>& OutReferenced)
+{
+    TMap<FName, int32> ModuleToNode;
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        if (Nodes[i].Plugin.IsValid())
+        {
+            for (const FModuleDescriptor& Module : Nodes[i].Plugin->GetDescriptor().Modules)
+            {
+                ModuleToNode.Add(Module.Name, i);
+            }
+        }
+    }
+
+    const auto MarkModule = [&ModuleToNode, &OutReferenced](const FName ModuleName, const int32 Owner)
+    {
+        if (const int32* Node = ModuleToNode.Find(ModuleName))
+        {
+            if (*Node != Owner)
+            {
+                OutReferenced[*Node] = true;
+            }
+        }
+    };
+
+    // Descriptor level module dependencies
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        if (Nodes[i].Plugin.IsValid())
+        {
+            for (const FModuleDescriptor& Module : Nodes[i].Plugin->GetDescriptor().Modules)
+            {
+                for (const FString& Dependency : Module.AdditionalDependencies)
+                {
+                    MarkModule(FName(*Dependency), i);
+                }
+            }
+        }
+    }
+
+    if (const FProjectDescriptor* Project = IProjectManager::Get().GetCurrentProject())
+    {
+        for (const FModuleDescriptor& Module : Project->Modules)
+        {
+            for (const FString& Dependency : Module.AdditionalDependencies)
+            {
+                MarkModule(FName(*Dependency), INDEX_NONE);
+            }
+        }
+    }
+
+    // Build rules of the project and every plugin that ships its source
+    TArray<FString> RuleFiles;
+    TArray<int32> RuleOwners;
+    const auto AddRules = [&RuleFiles, &RuleOwners](const FString& SourceDir, const int32 Owner)
+    {
+        if (!IFileManager::Get().DirectoryExists(*SourceDir))
+        {
+            return;
+        }
+
+        TArray<FString> Found;
+        IFileManager::Get().FindFilesRecursive(Found, *SourceDir, TEXT("*.Build.cs"), true, false);
+        IFileManager::Get().FindFilesRecursive(Found, *SourceDir, TEXT("*.Target.cs"), true, false, false);
+        for (FString& File : Found)
+        {
+            RuleFiles.Add(MoveTemp(File));
+            RuleOwners.Add(Owner);
+        }
+    };
+
+    AddRules(FPaths::GameSourceDir(), INDEX_NONE);
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        if (Nodes[i].Plugin.IsValid())
+        {
+            AddRules(Nodes[i].Plugin->GetBaseDir() / TEXT("Source"), i);
+        }
+    }
+
+    // Any quoted module name counts as a reference, which errs on the side of keeping plugins
+    TArray<TArray<FName>> FileReferences;
+    FileReferences.SetNum(RuleFiles.Num());
+    ParallelFor(RuleFiles.Num(), [&RuleFiles, &FileReferences](int32 FileIndex)
+    {
+        FString Text;
+        if (!FFileHelper::LoadFileToString(Text, *RuleFiles[FileIndex]))
+        {
+            return;
+        }
+
+        int32 Open = INDEX_NONE;
+        for (int32 Pos = 0; Pos < Text.Len(); ++Pos)
+        {
+            if (Text[Pos] != TEXT('"'))
+            {
+                continue;
+            }
+
+            if (Open == INDEX_NONE)
+            {
+                Open = Pos;
+                continue;
+            }
+
+            const FStringView Token = FStringView(Text).Mid(Open + 1, Pos - Open - 1);
+            if (Token.Len() > 0 && Token.Len() < NAME_SIZE)
+            {
+                const FName Name(Token, FNAME_Find);
+                if (!Name.IsNone())
+                {
+                    FileReferences[FileIndex].Add(Name);
+                }
+            }
+            Open = INDEX_NONE;
+        }
+    });
+
+    for (int32 FileIndex = 0; FileIndex < RuleFiles.Num(); ++FileIndex)
+    {
+        for (const FName ModuleName : FileReferences[FileIndex])
+        {
+            MarkModule(ModuleName, RuleOwners[FileIndex]);
+        }
+    }
+}
+
+int64 FNsSpyglassUnusedPluginFinder::GetBinarySize(const IPlugin& Plugin)
+{
+    const FString BinariesDir = Plugin.GetBaseDir() / TEXT("Binaries") / FPlatformProcess::GetBinariesSubdirectory();
+    const FString Extension = FPlatformProcess::GetModuleExtension();
+
+    int64 Total = 0;
+    for (const FModuleDescriptor& Module : Plugin.GetDescriptor().Modules)
+    {
+        FModuleStatus Status;
+        if (FModuleManager::Get().QueryModule(Module.Name, Status) && !Status.FilePath.IsEmpty())
+        {
+            Total += FMath::Max<int64>(IFileManager::Get().FileSize(*Status.FilePath), 0);
+            continue;
+        }
+
+        // Module not registered with the module manager, look for <Target>-<Module>[-Platform-Config].<ext>
+        const FString ModuleName = Module.Name.ToString();
+        const FString Patterns[] =
+        {
+            FString::Printf(TEXT("*-%s.%s"), *ModuleName, *Extension),
+            FString::Printf(TEXT("*-%s-*.%s"), *ModuleName, *Extension)
+        };
+
+        for (const FString& Pattern : Patterns)
+        {
+            TArray<FString> Found;
+            IFileManager::Get().FindFiles(Found, *(BinariesDir / Pattern), true, false);
+            for (const FString& File : Found)
+            {
+                Total += FMath::Max<int64>(IFileManager::Get().FileSize(*(BinariesDir / File)), 0);
+            }
+        }
+    }
+
+    return Total;
+}
+
+FString FNsSpyglassUnusedPluginFinder::MakeProjectPluginEntries(const FNsSpyglassUnusedResult& Result)
+{
+    FString Output;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+
+    Writer->WriteArrayStart();
+    for (const FNsSpyglassUnusedPlugin& Candidate : Result.Candidates)
+    {
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("Name"), Candidate.Name);
+        Writer->WriteValue(TEXT("Enabled"), false);
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+    Writer->Close();
+
+    return Output;
+}
@@ -0,0 +1,276 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassWhatIf.h"
+#include "Analysis/NsSpyglassUnusedPlugins.h"
+#include "Async/ParallelFor.h"
+#include "Graph/NsSpyglassCycleDetector.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+    /** Sort and drop repeated entries. */
+    void SortUnique(TArray<int32>& Values)
+    {
+        Values.Sort();
+        int32 Write = 0;
+        for (int32 Read = 0; Read < Values.Num(); ++Read)
+        {
+            if (Write == 0 || Values[Write - 1] != Values[Read])
+            {
+                Values[Write++] = Values[Read];
+            }
+        }
+        Values.SetNum(Write);
+    }
+}
+
+void FNsSpyglassWhatIf::Initialize(const TArray<FPluginNode>& Nodes)
+{
+    const int32 Num = Nodes.Num();
+
+    FNsSpyglassCycleInfo Info;
+    FNsSpyglassCycleDetector::Compute(Nodes, Info);
+    const int32 NumComponents = Info.NumComponents;
+
+    Names.Reset(Num);
+    NodeModules.Reset(Num);
+    for (const FPluginNode& Node : Nodes)
+    {
+        Names.Add(Node.Name);
+        NodeModules.Add(Node.Plugin.IsValid() ? Node.Plugin->GetDescriptor().Modules.Num() : 0);
+    }
+    ComponentOf = Info.ComponentOf;
+    NodeBytes.Init(0, Num);
+    Disabled.Init(false, Num);
+
+    Members.Reset();
+    Members.SetNum(NumComponents);
+    Dependencies.Reset();
+    Dependencies.SetNum(NumComponents);
+    Dependents.Reset();
+    Dependents.SetNum(NumComponents);
+    ComponentModules.Init(0, NumComponents);
+    ComponentBytes.Init(0, NumComponents);
+
+    for (int32 Node = 0; Node < Num; ++Node)
+    {
+        const int32 Component = ComponentOf[Node];
+        Members[Component].Add(Node);
+        ComponentModules[Component] += NodeModules[Node];
+
+        // Edges inside a cycle never change its state, only edges between components are counted
+        for (const int32 Dep : Nodes[Node].Dependencies)
+        {
+            const int32 DepComponent = ComponentOf[Dep];
+            if (DepComponent != Component)
+            {
+                Dependencies[Component].Add(DepComponent);
+                Dependents[DepComponent].Add(Component);
+            }
+        }
+    }
+
+    DisabledMembers.Init(0, NumComponents);
+    MissingDependencies.Init(0, NumComponents);
+    NeededBy.SetNumUninitialized(NumComponents);
+    for (int32 Component = 0; Component < NumComponents; ++Component)
+    {
+        SortUnique(Dependencies[Component]);
+        SortUnique(Dependents[Component]);
+        NeededBy[Component] = Dependents[Component].Num();
+    }
+
+    OffState.Init(false, NumComponents);
+    KeptState.Init(true, NumComponents);
+    OrphanState.Init(false, NumComponents);
+
+    NumDisabled = 0;
+    RemovedModules = 0;
+    RemovedBytes = 0;
+    OrphanedModules = 0;
+    OrphanedBytes = 0;
+    bSizesKnown = false;
+}
+
+void FNsSpyglassWhatIf::MeasureBinaries(const TArray<FPluginNode>& Nodes, TArray<int64>& OutBytes)
+{
+    OutBytes.Init(0, Nodes.Num());
+    ParallelFor(Nodes.Num(), [&Nodes, &OutBytes](const int32 Node)
+    {
+        if (Nodes[Node].Plugin.IsValid())
+        {
+            OutBytes[Node] = FNsSpyglassUnusedPluginFinder::GetBinarySize(*Nodes[Node].Plugin);
+        }
+    });
+}
+
+void FNsSpyglassWhatIf::SetBinarySizes(const TArray<int64>& Bytes)
+{
+    if (Bytes.Num() != NodeBytes.Num())
+    {
+        return;
+    }
+
+    NodeBytes = Bytes;
+    RemovedBytes = 0;
+    OrphanedBytes = 0;
+    for (int32 Component = 0; Component < Members.Num(); ++Component)
+    {
+        ComponentBytes[Component] = 0;
+        for (const int32 Node : Members[Component])
+        {
+            ComponentBytes[Component] += NodeBytes[Node];
+        }
+        RemovedBytes += OffState[Component] ? ComponentBytes[Component] : 0;
+        OrphanedBytes += OrphanState[Component] ? ComponentBytes[Component] : 0;
+    }
+    bSizesKnown = true;
+}
+
+void FNsSpyglassWhatIf::SetDisabled(const TConstArrayView<int32> NodeIndices, const bool bDisabled)
+{
+    TArray<int32> Pending;
+    for (const int32 Node : NodeIndices)
+    {
+        if (!Disabled.IsValidIndex(Node) || Disabled[Node] == bDisabled)
+        {
+            continue;
+        }
+
+        Disabled[Node] = bDisabled;
+        NumDisabled += bDisabled ? 1 : -1;
+        DisabledMembers[ComponentOf[Node]] += bDisabled ? 1 : -1;
+        Pending.Add(ComponentOf[Node]);
+    }
+
+    Propagate(Pending);
+}
+
+void FNsSpyglassWhatIf::Propagate(TArray<int32>& Pending)
+{
+    // A component may be queued several times, it only passes a change on when its state differs from the last one
+    for (int32 Head = 0; Head < Pending.Num(); ++Head)
+    {
+        const int32 Component = Pending[Head];
+
+        const bool bOff = IsOff(Component);
+        if (bOff != OffState[Component])
+        {
+            OffState[Component] = bOff;
+            RemovedModules += bOff ? ComponentModules[Component] : -ComponentModules[Component];
+            RemovedBytes += bOff ? ComponentBytes[Component] : -ComponentBytes[Component];
+            for (const int32 Dependent : Dependents[Component])
+            {
+                MissingDependencies[Dependent] += bOff ? 1 : -1;
+                Pending.Add(Dependent);
+            }
+        }
+
+        const bool bOrphaned = IsOrphaned(Component);
+        if (bOrphaned != OrphanState[Component])
+        {
+            OrphanState[Component] = bOrphaned;
+            OrphanedModules += bOrphaned ? ComponentModules[Component] : -ComponentModules[Component];
+            OrphanedBytes += bOrphaned ? ComponentBytes[Component] : -ComponentBytes[Component];
+        }
+
+        const bool bKept = IsKept(Component);
+        if (bKept != KeptState[Component])
+        {
+            KeptState[Component] = bKept;
+            for (const int32 Dependency : Dependencies[Component])
+            {
+                NeededBy[Dependency] += bKept ? 1 : -1;
+                Pending.Add(Dependency);
+            }
+        }
+    }
+}
+
+bool FNsSpyglassWhatIf::IsDisabled(const int32 Node) const
+{
+    return Disabled.IsValidIndex(Node) && Disabled[Node];
+}
+
+ENsSpyglassWhatIfState FNsSpyglassWhatIf::GetState(const int32 Node) const
+{
+    if (!Disabled.IsValidIndex(Node))
+    {
+        return ENsSpyglassWhatIfState::Enabled;
+    }
+    if (Disabled[Node])
+    {
+        return ENsSpyglassWhatIfState::Disabled;
+    }
+
+    const int32 Component = ComponentOf[Node];
+    if (OffState[Component])
+    {
+        return ENsSpyglassWhatIfState::Broken;
+    }
+    return OrphanState[Component] ? ENsSpyglassWhatIfState::Orphaned : ENsSpyglassWhatIfState::Enabled;
+}
+
+void FNsSpyglassWhatIf::MakeResult(FNsSpyglassWhatIfResult& OutResult) const
+{
+    OutResult.Entries.Reset();
+    for (int32 Component = 0; Component < Members.Num(); ++Component)
+    {
+        if (!OffState[Component] && !OrphanState[Component])
+        {
+            continue;
+        }
+
+        for (const int32 Node : Members[Component])
+        {
+            FNsSpyglassWhatIfEntry& Entry = OutResult.Entries.AddDefaulted_GetRef();
+            Entry.Node = Node;
+            Entry.Name = Names[Node];
+            Entry.State = GetState(Node);
+            Entry.NumModules = NodeModules[Node];
+            Entry.BinaryBytes = NodeBytes[Node];
+        }
+    }
+
+    OutResult.Entries.Sort([](const FNsSpyglassWhatIfEntry& A, const FNsSpyglassWhatIfEntry& B)
+    {
+        if (A.State != B.State)
+        {
+            return A.State < B.State;
+        }
+        if (A.BinaryBytes != B.BinaryBytes)
+        {
+            return A.BinaryBytes > B.BinaryBytes;
+        }
+        return A.NumModules > B.NumModules;
+    });
+
+    OutResult.RemovedModules = RemovedModules;
+    OutResult.RemovedBytes = RemovedBytes;
+    OutResult.OrphanedModules = OrphanedModules;
+    OutResult.OrphanedBytes = OrphanedBytes;
+    OutResult.bSizesKnown = bSizesKnown;
+}
+
+FString FNsSpyglassWhatIf::MakeProjectPluginEntries(const FNsSpyglassWhatIfResult& Result)
+{
+    FString Output;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+
+    // Orphaned plugins still load, the project may use them directly, so they are left to the user
+    Writer->WriteArrayStart();
+    for (const FNsSpyglassWhatIfEntry& Entry : Result.Entries)
+    {
+        if (Entry.State == ENsSpyglassWhatIfState::Disabled || Entry.State == ENsSpyglassWhatIfState::Broken)
+        {
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("Name"), Entry.Name);
+            Writer->WriteValue(TEXT("Enabled"), false);
+            Writer->WriteObjectEnd();
+        }
+    }
+    Writer->WriteArrayEnd();
+    Writer->Close();
+
+    return Output;
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Commandlets/NsSpyglassBudgetCommandlet.h"
+#include "Analysis/NsSpyglassBudgetEvaluator.h"
+#include "Graph/NsSpyglassGraphBuilder.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Settings/NsSpyglassBudgetSettings.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogNsSpyglassBudget, Log, All);
+
+UNsSpyglassBudgetCommandlet::UNsSpyglassBudgetCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UNsSpyglassBudgetCommandlet::Main(const FString& Params)
+{
+    TArray<FString> Tokens;
+    TArray<FString> Switches;
+    TMap<FString, FString> ParamVals;
+    ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+    FString ReportPath = FPaths::ProjectSavedDir() / TEXT("Spyglass") / TEXT("BudgetReport.json");
+    if (const FString* Report = ParamVals.Find(TEXT("Report")))
+    {
+        ReportPath = *Report;
+    }
+
+    // Only descriptors are read, no assets are loaded, so the check stays cheap enough for every pre-merge build
+    const double StartTime = FPlatformTime::Seconds();
+
+    TArray<FPluginNode> Nodes;
+    FNsSpyglassGraphBuilder::BuildPluginNodes(Nodes);
+
+    FNsSpyglassBudgetReport Report;
+    FNsSpyglassBudgetEvaluator::Evaluate(Nodes, *UNsSpyglassBudgetSettings::GetSettings(), Report);
+
+    for (const FNsSpyglassBudgetViolation& Violation : Report.Violations)
+    {
+        UE_LOG(LogNsSpyglassBudget, Error, TEXT("[%s] %s"), *Violation.Rule, *Violation.Detail);
+    }
+
+    if (!FFileHelper::SaveStringToFile(Report.ToJson(), *ReportPath))
+    {
+        UE_LOG(LogNsSpyglassBudget, Error, TEXT("Failed to write %s"), *ReportPath);
+        return 2;
+    }
+
+    UE_LOG(LogNsSpyglassBudget, Display, TEXT("%s: %d plugins, %d modules, depth %d, %d violations in %.3fs. Report: %s"),
+        Report.Passed() ? TEXT("Passed") : TEXT("Failed"),
+        Report.NumPlugins, Report.NumEnabledModules, Report.MaxDepth, Report.Violations.Num(),
+        FPlatformTime::Seconds() - StartTime, *ReportPath);
+
+    return Report.Passed() ? 0 : 1;
+}
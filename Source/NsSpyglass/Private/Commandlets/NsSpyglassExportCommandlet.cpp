@@ -0,0 +1,93 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Commandlets/NsSpyglassExportCommandlet.h"
+#include "Analysis/NsSpyglassContentRollup.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Graph/NsSpyglassCycleDetector.h"
+#include "Graph/NsSpyglassGraphBuilder.h"
+#include "Graph/NsSpyglassGraphExporter.h"
+#include "Graph/NsSpyglassSnapshot.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogNsSpyglassExport, Log, All);
+
+UNsSpyglassExportCommandlet::UNsSpyglassExportCommandlet()
+{
+    IsClient = false;
+    IsEditor = true;
+    IsServer = false;
+    LogToConsole = true;
+}
+
+int32 UNsSpyglassExportCommandlet::Main(const FString& Params)
+{
+    TArray<FString> Tokens;
+    TArray<FString> Switches;
+    TMap<FString, FString> ParamVals;
+    ParseCommandLine(*Params, Tokens, Switches, ParamVals);
+
+    FString OutputPath = FPaths::ProjectSavedDir() / TEXT("Spyglass") / TEXT("PluginGraph.json");
+    if (const FString* Output = ParamVals.Find(TEXT("Output")))
+    {
+        OutputPath = *Output;
+    }
+
+    TArray<FPluginNode> Nodes;
+    FNsSpyglassGraphBuilder::BuildPluginNodes(Nodes);
+
+    FNsSpyglassCycleInfo CycleInfo;
+    FNsSpyglassCycleDetector::Compute(Nodes, CycleInfo);
+
+    for (const TArray<int32>& Cycle : CycleInfo.Cycles)
+    {
+        TArray<FString> Names;
+        for (int32 Member : Cycle)
+        {
+            Names.Add(Nodes[Member].Name);
+        }
+        UE_LOG(LogNsSpyglassExport, Warning, TEXT("Circular dependency: %s"), *FString::Join(Names, TEXT(", ")));
+    }
+
+    // Content references need a full registry scan, so they are opt-in
+    FNsSpyglassContentResult ContentResult;
+    const bool bWithContent = Switches.Contains(TEXT("Content"));
+    if (bWithContent)
+    {
+        IAssetRegistry::GetChecked().SearchAllAssets(true);
+        FNsSpyglassContentRollup::GatherBlocking(Nodes, ContentResult);
+
+        for (const FNsSpyglassContentEdge& Edge : ContentResult.Edges)
+        {
+            if (!Edge.bDeclared)
+            {
+                UE_LOG(LogNsSpyglassExport, Warning, TEXT("Undeclared content dependency: %s -> %s (%d hard, %d soft)"),
+                    *Nodes[Edge.From].Name, *Nodes[Edge.To].Name, Edge.HardReferences, Edge.SoftReferences);
+            }
+        }
+
+        UE_LOG(LogNsSpyglassExport, Display, TEXT("Rolled up %d packages into %d content edges in %.2fs"),
+            ContentResult.NumPackages, ContentResult.Edges.Num(), ContentResult.GatherSeconds);
+    }
+
+    if (!FNsSpyglassGraphExporter::SaveJson(OutputPath, Nodes, CycleInfo, bWithContent ? &ContentResult : nullptr))
+    {
+        UE_LOG(LogNsSpyglassExport, Error, TEXT("Failed to write %s"), *OutputPath);
+        return 1;
+    }
+
+    UE_LOG(LogNsSpyglassExport, Display, TEXT("Exported %d plugins and %d cycles to %s"), Nodes.Num(), CycleInfo.Cycles.Num(), *OutputPath);
+
+    // Binary snapshots are meant to be archived per build and compared in the editor
+    if (const FString* SnapshotPath = ParamVals.Find(TEXT("Snapshot")))
+    {
+        if (!FNsSpyglassSnapshot::Save(*SnapshotPath, Nodes))
+        {
+            UE_LOG(LogNsSpyglassExport, Error, TEXT("Failed to write %s"), **SnapshotPath);
+            return 1;
+        }
+        UE_LOG(LogNsSpyglassExport, Display, TEXT("Wrote snapshot %s"), **SnapshotPath);
+    }
+
+    const bool bFailOnCycles = Switches.Contains(TEXT("FailOnCycles"));
+    return (bFailOnCycles && CycleInfo.Cycles.Num() > 0) ? 1 : 0;
+}
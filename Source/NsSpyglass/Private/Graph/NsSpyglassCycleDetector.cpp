@@ -0,0 +1,227 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassCycleDetector.h"
+
+void FNsSpyglassCycleInfo::Reset(int32 NumNodes)
+{
+    ComponentOf.Init(INDEX_NONE, NumNodes);
+    CycleOf.Init(INDEX_NONE, NumNodes);
+    Cycles.Reset();
+    NumComponents = 0;
+}
+
+void FNsSpyglassCycleDetector::Compute(const TArray<FPluginNode>& Nodes, FNsSpyglassCycleInfo& OutInfo)
+{
+    const int32 Num = Nodes.Num();
+    OutInfo.Reset(Num);
+
+    TArray<int32> Order;
+    Order.Init(INDEX_NONE, Num);
+
+    TArray<int32> LowLink;
+    LowLink.SetNumZeroed(Num);
+
+    TBitArray<> OnStack(false, Num);
+
+    TArray<int32> Stack;
+    Stack.Reserve(Num);
+
+    // Explicit call stack: node plus the next dependency to visit
+    TArray<TPair<int32, int32>> CallStack;
+    CallStack.Reserve(Num);
+
+    int32 Counter = 0;
+
+    for (int32 Root = 0; Root < Num; ++Root)
+    {
+        if (Order[Root] != INDEX_NONE)
+        {
+            continue;
+        }
+
+        Order[Root] = LowLink[Root] = Counter++;
+        Stack.Add(Root);
+        OnStack[Root] = true;
+        CallStack.Emplace(Root, 0);
+
+        while (CallStack.Num() > 0)
+        {
+            const int32 Cur = CallStack.Last().Key;
+            int32& NextEdge = CallStack.Last().Value;
+            const TArray<int32>& Deps = Nodes[Cur].Dependencies;
+
+            if (NextEdge < Deps.Num())
+            {
+                const int32 Dep = Deps[NextEdge++];
+                if (!Nodes.IsValidIndex(Dep))
+                {
+                    continue;
+                }
+
+                if (Order[Dep] == INDEX_NONE)
+                {
+                    Order[Dep] = LowLink[Dep] = Counter++;
+                    Stack.Add(Dep);
+                    OnStack[Dep] = true;
+                    CallStack.Emplace(Dep, 0);
+                }
+                else if (OnStack[Dep])
+                {
+                    LowLink[Cur] = FMath::Min(LowLink[Cur], Order[Dep]);
+                }
+                continue;
+            }
+
+            // All dependencies visited, propagate the low link to the caller
+            CallStack.Pop();
+            if (CallStack.Num() > 0)
+            {
+                const int32 Parent = CallStack.Last().Key;
+                LowLink[Parent] = FMath::Min(LowLink[Parent], LowLink[Cur]);
+            }
+
+            if (LowLink[Cur] != Order[Cur])
+            {
+                continue;
+            }
+
+            // Cur is the root of a component
+            const int32 ComponentId = OutInfo.NumComponents++;
+            TArray<int32> Members;
+            int32 Member = INDEX_NONE;
+            do
+            {
+                Member = Stack.Pop();
+                OnStack[Member] = false;
+                OutInfo.ComponentOf[Member] = ComponentId;
+                Members.Add(Member);
+            }
+            while (Member != Cur);
+
+            if (Members.Num() > 1 || Nodes[Cur].Dependencies.Contains(Cur))
+            {
+                const int32 CycleIndex = OutInfo.Cycles.Num();
+                for (int32 Node : Members)
+                {
+                    OutInfo.CycleOf[Node] = CycleIndex;
+                }
+                OutInfo.Cycles.Add(MoveTemp(Members));
+            }
+        }
+    }
+}
+
+bool FNsSpyglassCycleDetector::AddEdge(const TArray<FPluginNode>& Nodes, int32 From, int32 To, FNsSpyglassCycleInfo& InOutInfo)
+{
+    if (!Nodes.IsValidIndex(From) || !Nodes.IsValidIndex(To))
+    {
+        return false;
+    }
+
+    if (InOutInfo.ComponentOf[From] == InOutInfo.ComponentOf[To])
+    {
+        // Already strongly connected, only a new self reference can turn a trivial component into a cycle
+        if (From == To && !InOutInfo.IsInCycle(From))
+        {
+            InOutInfo.CycleOf[From] = InOutInfo.Cycles.Num();
+            InOutInfo.Cycles.Add(TArray<int32>{From});
+            return true;
+        }
+        return false;
+    }
+
+    const int32 Num = Nodes.Num();
+
+    // Everything reachable from To
+    TBitArray<> Forward(false, Num);
+    TArray<int32> Stack;
+    Stack.Add(To);
+    Forward[To] = true;
+    while (Stack.Num() > 0)
+    {
+        const int32 Cur = Stack.Pop();
+        for (int32 Dep : Nodes[Cur].Dependencies)
+        {
+            if (Nodes.IsValidIndex(Dep) && !Forward[Dep])
+            {
+                Forward[Dep] = true;
+                Stack.Add(Dep);
+            }
+        }
+    }
+
+    if (!Forward[From])
+    {
+        return false;
+    }
+
+    // Nodes on a path To ->* From now share a component with both ends
+    TBitArray<> Backward(false, Num);
+    TArray<int32> Members;
+    Stack.Add(From);
+    Backward[From] = true;
+    while (Stack.Num() > 0)
+    {
+        const int32 Cur = Stack.Pop();
+        Members.Add(Cur);
+        for (int32 Dependent : Nodes[Cur].Dependents)
+        {
+            if (Nodes.IsValidIndex(Dependent) && Forward[Dependent] && !Backward[Dependent])
+            {
+                Backward[Dependent] = true;
+                Stack.Add(Dependent);
+            }
+        }
+    }
+
+    // Whole components are always on such a path, so Members already covers every merged component
+    TSet<int32> MergedComponents;
+    TSet<int32> StaleCycles;
+    for (int32 Node : Members)
+    {
+        MergedComponents.Add(InOutInfo.ComponentOf[Node]);
+        if (InOutInfo.CycleOf[Node] != INDEX_NONE)
+        {
+            StaleCycles.Add(InOutInfo.CycleOf[Node]);
+        }
+    }
+
+    // Remove highest indices first so swapped entries are never ones still pending removal
+    TArray<int32> SortedStale = StaleCycles.Array();
+    SortedStale.Sort(TGreater<int32>());
+    for (int32 CycleIndex : SortedStale)
+    {
+        RemoveCycle(InOutInfo, CycleIndex);
+    }
+
+    const int32 ComponentId = InOutInfo.ComponentOf[From];
+    const int32 CycleIndex = InOutInfo.Cycles.Num();
+    for (int32 Node : Members)
+    {
+        InOutInfo.ComponentOf[Node] = ComponentId;
+        InOutInfo.CycleOf[Node] = CycleIndex;
+    }
+    InOutInfo.Cycles.Add(MoveTemp(Members));
+    InOutInfo.NumComponents -= MergedComponents.Num() - 1;
+
+    return true;
+}
+
+void FNsSpyglassCycleDetector::RemoveCycle(FNsSpyglassCycleInfo& InOutInfo, int32 CycleIndex)
+{
+    for (int32 Node : InOutInfo.Cycles[CycleIndex])
+    {
+        InOutInfo.CycleOf[Node] = INDEX_NONE;
+    }
+
+    const int32 LastIndex = InOutInfo.Cycles.Num() - 1;
+    InOutInfo.Cycles.RemoveAtSwap(CycleIndex);
+
+    if (CycleIndex != LastIndex)
+    {
+        for (int32 Node : InOutInfo.Cycles[CycleIndex])
+        {
+            InOutInfo.CycleOf[Node] = CycleIndex;
+        }
+    }
+}
@@ -0,0 +1,216 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassDependencyMatrix.h"
+
+void FNsSpyglassDependencyMatrix::Build(const TArray<FPluginNode>& Nodes, const FNsSpyglassCycleInfo& CycleInfo)
+{
+    const int32 Num = Nodes.Num();
+
+    // Incremental updates can leave component ids sparse, only their equality matters here
+    FNsSpyglassCycleInfo FreshInfo;
+    const FNsSpyglassCycleInfo* Info = &CycleInfo;
+    if (CycleInfo.ComponentOf.Num() != Num)
+    {
+        FNsSpyglassCycleDetector::Compute(Nodes, FreshInfo);
+        Info = &FreshInfo;
+    }
+    const TArray<int32>& ComponentOf = Info->ComponentOf;
+
+    int32 NumComponents = 0;
+    for (const int32 Component : ComponentOf)
+    {
+        NumComponents = FMath::Max(NumComponents, Component + 1);
+    }
+
+    // --- Members of every component, in node order ---
+    TArray<int32> MemberStart;
+    MemberStart.Init(0, NumComponents + 1);
+    for (const int32 Component : ComponentOf)
+    {
+        ++MemberStart[Component + 1];
+    }
+    for (int32 Component = 0; Component < NumComponents; ++Component)
+    {
+        MemberStart[Component + 1] += MemberStart[Component];
+    }
+    TArray<int32> Members;
+    Members.SetNumUninitialized(Num);
+    {
+        TArray<int32> Fill(MemberStart);
+        for (int32 Node = 0; Node < Num; ++Node)
+        {
+            Members[Fill[ComponentOf[Node]]++] = Node;
+        }
+    }
+
+    // --- Topological order of the condensation, a component goes once everything it depends on is placed ---
+    // Counted over the same Dependents lists Place decrements over, so a duplicated entry counts as often as it is undone
+    TArray<int32> Remaining;
+    Remaining.Init(0, NumComponents);
+    for (int32 Node = 0; Node < Num; ++Node)
+    {
+        for (const int32 Dependent : Nodes[Node].Dependents)
+        {
+            Remaining[ComponentOf[Dependent]] += ComponentOf[Dependent] != ComponentOf[Node] ? 1 : 0;
+        }
+    }
+
+    TArray<int32> Ready;
+    Ready.Reserve(NumComponents);
+    for (int32 Component = 0; Component < NumComponents; ++Component)
+    {
+        if (Remaining[Component] == 0 && MemberStart[Component + 1] > MemberStart[Component])
+        {
+            Ready.Add(Component);
+        }
+    }
+
+    Order.Reset(Num);
+    CycleBlocks.Reset();
+    TBitArray<> Placed(false, NumComponents);
+    const auto Place = [this, &Nodes, &ComponentOf, &Members, &MemberStart, &Remaining, &Ready, &Placed](const int32 Component)
+    {
+        Placed[Component] = true;
+        const int32 Size = MemberStart[Component + 1] - MemberStart[Component];
+        if (Size > 1)
+        {
+            CycleBlocks.Emplace(Order.Num(), Size);
+        }
+
+        for (int32 k = MemberStart[Component]; k < MemberStart[Component + 1]; ++k)
+        {
+            Order.Add(Members[k]);
+            for (const int32 Dependent : Nodes[Members[k]].Dependents)
+            {
+                const int32 DependentComponent = ComponentOf[Dependent];
+                if (DependentComponent != Component && --Remaining[DependentComponent] == 0)
+                {
+                    Ready.Add(DependentComponent);
+                }
+            }
+        }
+    };
+    for (int32 Head = 0; Head < Ready.Num(); ++Head)
+    {
+        Place(Ready[Head]);
+    }
+
+    // Dependents lists that disagree with the dependencies would strand components, they go last
+    for (int32 Component = 0; Component < NumComponents; ++Component)
+    {
+        if (!Placed[Component] && MemberStart[Component + 1] > MemberStart[Component])
+        {
+            Place(Component);
+        }
+    }
+
+    PositionOf.SetNumUninitialized(Num);
+    for (int32 Position = 0; Position < Num; ++Position)
+    {
+        PositionOf[Order[Position]] = Position;
+    }
+
+    // --- Level 0: one sorted row of dependency columns per position ---
+    Levels.Reset();
+    FLevel& Cells = Levels.AddDefaulted_GetRef();
+    Cells.RowStart.Reserve(Num + 1);
+    for (int32 Row = 0; Row < Num; ++Row)
+    {
+        const int32 First = Cells.Columns.Num();
+        Cells.RowStart.Add(First);
+        for (const int32 Dep : Nodes[Order[Row]].Dependencies)
+        {
+            Cells.Columns.Add(PositionOf[Dep]);
+        }
+
+        TArrayView<int32> Columns(Cells.Columns.GetData() + First, Cells.Columns.Num() - First);
+        Columns.Sort();
+        int32 Write = First;
+        for (int32 Read = First; Read < Cells.Columns.Num(); ++Read)
+        {
+            if (Write == First || Cells.Columns[Write - 1] != Cells.Columns[Read])
+            {
+                Cells.Columns[Write++] = Cells.Columns[Read];
+            }
+        }
+        Cells.Columns.SetNum(Write);
+    }
+    Cells.RowStart.Add(Cells.Columns.Num());
+    Cells.Counts.Init(1, Cells.Columns.Num());
+    Cells.MaxCount = Cells.Columns.Num() > 0 ? 1 : 0;
+
+    // --- Further levels: merge pairs of rows and halve their columns until one block is left ---
+    TArray<TPair<int32, int32>> Scratch;
+    for (int32 NumRows = Num; NumRows > 1;)
+    {
+        const FLevel& Fine = Levels.Last();
+        FLevel Coarse;
+        const int32 NumCoarseRows = (NumRows + 1) / 2;
+        Coarse.RowStart.Reserve(NumCoarseRows + 1);
+
+        for (int32 Row = 0; Row < NumCoarseRows; ++Row)
+        {
+            Coarse.RowStart.Add(Coarse.Columns.Num());
+
+            Scratch.Reset();
+            for (int32 FineRow = Row * 2; FineRow < FMath::Min(Row * 2 + 2, NumRows); ++FineRow)
+            {
+                for (int32 k = Fine.RowStart[FineRow]; k < Fine.RowStart[FineRow + 1]; ++k)
+                {
+                    Scratch.Emplace(Fine.Columns[k] / 2, Fine.Counts[k]);
+                }
+            }
+            Scratch.Sort([](const TPair<int32, int32>& A, const TPair<int32, int32>& B) { return A.Key < B.Key; });
+
+            for (const TPair<int32, int32>& Entry : Scratch)
+            {
+                if (Coarse.Columns.Num() > Coarse.RowStart.Last() && Coarse.Columns.Last() == Entry.Key)
+                {
+                    Coarse.Counts.Last() += Entry.Value;
+                }
+                else
+                {
+                    Coarse.Columns.Add(Entry.Key);
+                    Coarse.Counts.Add(Entry.Value);
+                }
+                Coarse.MaxCount = FMath::Max(Coarse.MaxCount, Coarse.Counts.Last());
+            }
+        }
+        Coarse.RowStart.Add(Coarse.Columns.Num());
+
+        Levels.Add(MoveTemp(Coarse));
+        NumRows = NumCoarseRows;
+    }
+}
+
+bool FNsSpyglassDependencyMatrix::HasEdge(const int32 Row, const int32 Column) const
+{
+    if (!Order.IsValidIndex(Row))
+    {
+        return false;
+    }
+
+    const FLevel& Cells = Levels[0];
+    const int32* Last = Cells.Columns.GetData() + Cells.RowStart[Row + 1];
+    const int32* Found = LowerBound(Cells.Columns.GetData() + Cells.RowStart[Row], Last, Column);
+    return Found != Last && *Found == Column;
+}
+
+const int32* FNsSpyglassDependencyMatrix::LowerBound(const int32* First, const int32* Last, const int32 Value)
+{
+    int32 Count = static_cast<int32>(Last - First);
+    while (Count > 0)
+    {
+        const int32 Half = Count / 2;
+        if (First[Half] < Value)
+        {
+            First += Half + 1;
+            Count -= Half + 1;
+        }
+        else
+        {
+            Count = Half;
+        }
+    }
+    return First;
+}
@@ -0,0 +1,190 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassEdgeBundler.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+    /** Edges less compatible than this do not attract each other. */
+    constexpr float CompatibilityThreshold = 0.6f;
+
+    /** Spring stiffness along an edge. */
+    constexpr float SpringConstant = 0.1f;
+
+    /** Subdivision cycles, the point count doubles every cycle. */
+    constexpr int32 NumCycles = 5;
+
+    /** Iterations of the first cycle, later cycles run two thirds of the previous. */
+    constexpr int32 FirstCycleIterations = 50;
+
+    /** Step size of the first cycle relative to the mean edge length, halved every cycle. */
+    constexpr float FirstCycleStep = 0.04f;
+
+    /** Angle, scale and position compatibility of two edges, 0..1. */
+    float Compatibility(const FVector2D& P0, const FVector2D& P1, const FVector2D& Q0, const FVector2D& Q1)
+    {
+        const FVector2D P = P1 - P0;
+        const FVector2D Q = Q1 - Q0;
+        const float LenP = P.Size();
+        const float LenQ = Q.Size();
+        const float LenAvg = (LenP + LenQ) * 0.5f;
+
+        const float Angle = FMath::Abs(FVector2D::DotProduct(P, Q)) / (LenP * LenQ);
+        const float Scale = 2.f / (LenAvg / FMath::Min(LenP, LenQ) + FMath::Max(LenP, LenQ) / LenAvg);
+        const float Position = LenAvg / (LenAvg + FVector2D::Distance((P0 + P1) * 0.5f, (Q0 + Q1) * 0.5f));
+
+        return Angle * Scale * Position;
+    }
+
+    /** Resample a polyline to NumPoints points at equal arc length, endpoints included. */
+    void Resample(TConstArrayView<FVector2D> In, TArrayView<FVector2D> Out)
+    {
+        float Length = 0.f;
+        for (int32 i = 1; i < In.Num(); ++i)
+        {
+            Length += FVector2D::Distance(In[i - 1], In[i]);
+        }
+
+        const int32 NumOut = Out.Num();
+        const float Spacing = Length / static_cast<float>(NumOut - 1);
+
+        Out[0] = In[0];
+        int32 Segment = 1;
+        float Walked = 0.f;
+        for (int32 k = 1; k < NumOut - 1; ++k)
+        {
+            const float Target = Spacing * static_cast<float>(k);
+            float SegmentLength = FVector2D::Distance(In[Segment - 1], In[Segment]);
+            while (Walked + SegmentLength < Target && Segment < In.Num() - 1)
+            {
+                Walked += SegmentLength;
+                ++Segment;
+                SegmentLength = FVector2D::Distance(In[Segment - 1], In[Segment]);
+            }
+
+            const float Alpha = SegmentLength > KINDA_SMALL_NUMBER ? (Target - Walked) / SegmentLength : 0.f;
+            Out[k] = FMath::Lerp(In[Segment - 1], In[Segment], FMath::Clamp(Alpha, 0.f, 1.f));
+        }
+        Out[NumOut - 1] = In.Last();
+    }
+}
+
+void FNsSpyglassEdgeBundler::Compute(const TArray<FVector2D>& Positions, const TArray<FIntPoint>& InEdges, FNsSpyglassEdgeBundles& OutBundles)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    OutBundles.Points.Reset();
+    OutBundles.Edges.Reset();
+
+    // Zero length edges have no direction and cannot be compared
+    for (const FIntPoint& Edge : InEdges)
+    {
+        if (!Positions[Edge.X].Equals(Positions[Edge.Y], 1.f))
+        {
+            OutBundles.Edges.Add(Edge);
+        }
+    }
+
+    const TArray<FIntPoint>& Edges = OutBundles.Edges;
+    const int32 NumEdges = Edges.Num();
+
+    // Compatible partners per edge. Partners pointing the opposite way are stored as ~Index so their points are walked backwards
+    TArray<TArray<int32>> Partners;
+    Partners.SetNum(NumEdges);
+    ParallelFor(NumEdges, [&](const int32 i)
+    {
+        const FVector2D& P0 = Positions[Edges[i].X];
+        const FVector2D& P1 = Positions[Edges[i].Y];
+        for (int32 j = 0; j < NumEdges; ++j)
+        {
+            const FVector2D& Q0 = Positions[Edges[j].X];
+            const FVector2D& Q1 = Positions[Edges[j].Y];
+            if (i != j && Compatibility(P0, P1, Q0, Q1) >= CompatibilityThreshold)
+            {
+                Partners[i].Add(FVector2D::DotProduct(P1 - P0, Q1 - Q0) >= 0.f ? j : ~j);
+            }
+        }
+    });
+
+    float MeanLength = 0.f;
+    for (const FIntPoint& Edge : Edges)
+    {
+        MeanLength += FVector2D::Distance(Positions[Edge.X], Positions[Edge.Y]) / static_cast<float>(FMath::Max(NumEdges, 1));
+    }
+
+    // Start with one subdivision point at the middle of every edge
+    int32 Stride = 3;
+    TArray<FVector2D> Current;
+    Current.SetNumUninitialized(NumEdges * Stride);
+    for (int32 e = 0; e < NumEdges; ++e)
+    {
+        const FVector2D& From = Positions[Edges[e].X];
+        const FVector2D& To = Positions[Edges[e].Y];
+        Current[e * Stride] = From;
+        Current[e * Stride + 1] = (From + To) * 0.5f;
+        Current[e * Stride + 2] = To;
+    }
+
+    TArray<FVector2D> Next;
+    float Step = FirstCycleStep * MeanLength;
+    int32 Iterations = FirstCycleIterations;
+
+    for (int32 Cycle = 0; Cycle < NumCycles; ++Cycle)
+    {
+        if (Cycle > 0)
+        {
+            // Double the subdivision points, keeping the current shape
+            const int32 NewStride = (Stride - 2) * 2 + 2;
+            Next.SetNumUninitialized(NumEdges * NewStride);
+            ParallelFor(NumEdges, [&](const int32 e)
+            {
+                Resample(TConstArrayView<FVector2D>(Current.GetData() + e * Stride, Stride), TArrayView<FVector2D>(Next.GetData() + e * NewStride, NewStride));
+            });
+            Swap(Current, Next);
+            Stride = NewStride;
+            Step *= 0.5f;
+            Iterations = FMath::Max(1, Iterations * 2 / 3);
+        }
+
+        const int32 NumInner = Stride - 2;
+        Next.SetNumUninitialized(Current.Num());
+
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            ParallelFor(NumEdges, [&](const int32 e)
+            {
+                const FVector2D* Points = Current.GetData() + e * Stride;
+                FVector2D* Out = Next.GetData() + e * Stride;
+
+                const float Length = FVector2D::Distance(Points[0], Points[Stride - 1]);
+                const float Spring = SpringConstant / (Length * static_cast<float>(NumInner + 1));
+
+                Out[0] = Points[0];
+                Out[Stride - 1] = Points[Stride - 1];
+                for (int32 k = 1; k <= NumInner; ++k)
+                {
+                    FVector2D Force = (Points[k - 1] - Points[k] + Points[k + 1] - Points[k]) * Spring * MeanLength;
+
+                    for (const int32 Partner : Partners[e])
+                    {
+                        const bool bReversed = Partner < 0;
+                        const FVector2D* Other = Current.GetData() + (bReversed ? ~Partner : Partner) * Stride;
+                        const FVector2D Delta = Other[bReversed ? Stride - 1 - k : k] - Points[k];
+                        const float Dist = Delta.Size();
+                        if (Dist > 1.f)
+                        {
+                            Force += Delta / (Dist * Dist) * MeanLength;
+                        }
+                    }
+
+                    Out[k] = Points[k] + Force.GetClampedToMaxSize(1.f) * Step;
+                }
+            });
+            Swap(Current, Next);
+        }
+    }
+
+    OutBundles.Points = MoveTemp(Current);
+    OutBundles.PointsPerEdge = Stride;
+    OutBundles.BundleSeconds = FPlatformTime::Seconds() - StartTime;
+}
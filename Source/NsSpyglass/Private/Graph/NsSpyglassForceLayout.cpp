@@ -0,0 +1,123 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassForceLayout.h"
+#include "Misc/MemStack.h"
+
+void FNsSpyglassForceLayout::Step(TArray<FPluginNode>& InNodes, const TConstArrayView<int32> Active, const TBitArray<>& ActiveMask, const int32 InRootIndex, const FNsSpyglassForceParams& Params, const float DeltaTime)
+{
+    const int32 Num = InNodes.Num();
+    if (Num <= 1) return;
+
+    const float MinDist = 25.f;
+
+    // Feel tuning
+    const float Damping  = 0.90f;
+    const float MaxSpeed = 1000.f;
+
+    const float RestLength = 140.f;   // edges only pull when stretched
+
+    // Inactive nodes are skipped entirely, so a narrow set shrinks the O(n^2) repulsion pass
+    const int32 NumActive = Active.Num();
+
+    // Scratch comes from the thread's frame arena, which reuses its pages instead of touching the heap every step
+    FMemMark Mark(FMemStack::Get());
+    TArray<float, TMemStackAllocator<>> Mass;
+    Mass.SetNumUninitialized(Num);
+    for (int32 i : Active)
+    {
+        Mass[i] = 1.f + InNodes[i].Links.Num();
+    }
+
+    TArray<FVector2D, TMemStackAllocator<>> Force;
+    Force.Init(FVector2D::ZeroVector, Num);
+
+    // --- Repulsion (pairwise) ---
+    for (int32 A = 0; A < NumActive; ++A)
+    {
+        const int32 i = Active[A];
+        if (!InNodes[i].bActive) continue;
+
+        for (int32 B = A + 1; B < NumActive; ++B)
+        {
+            const int32 j = Active[B];
+            if (!InNodes[j].bActive) continue;
+
+            FVector2D Delta = InNodes[i].Position - InNodes[j].Position;
+
+            float DistSqr = Delta.SizeSquared();
+            DistSqr = FMath::Max(DistSqr, MinDist * MinDist);
+
+            const float Dist = FMath::Sqrt(DistSqr);
+            const FVector2D Dir = Delta / Dist;
+
+            const float F = Params.Repulsion * Mass[i] * Mass[j] / DistSqr;
+
+            Force[i] += Dir * F;
+            Force[j] -= Dir * F;
+        }
+    }
+
+    // --- Attraction (edges) ---
+    for (int32 i : Active)
+    {
+        if (!InNodes[i].bActive) continue;
+
+        for (int32 Link : InNodes[i].Links)
+        {
+            if (!InNodes.IsValidIndex(Link)) continue;
+            if (!InNodes[Link].bActive || !ActiveMask[Link]) continue;
+
+            // critical: process each undirected edge once
+            if (Link <= i) continue;
+
+            FVector2D Delta = InNodes[i].Position - InNodes[Link].Position;
+
+            float Dist = Delta.Size();
+            Dist = FMath::Max(Dist, MinDist);
+
+            const FVector2D Dir = Delta / Dist;
+
+            // only pull when stretched past rest length
+            const float Stretch = FMath::Max(0.f, Dist - RestLength);
+            const float F = Stretch * Params.EdgeStrength;
+
+            Force[i] -= Dir * F;
+            Force[Link] += Dir * F;
+        }
+    }
+
+    // --- Gravity (toward origin) ---
+    for (int32 i : Active)
+    {
+        if (!InNodes[i].bActive) continue;
+        Force[i] -= InNodes[i].Position * Params.Gravity * Mass[i];
+    }
+
+    // --- Integrate with damping ---
+    for (int32 i : Active)
+    {
+        if (!InNodes[i].bActive) continue;
+        if (i == InRootIndex || InNodes[i].bFixed) continue;
+
+        const FVector2D Accel = Force[i] / Mass[i];
+
+        InNodes[i].Velocity += Accel * DeltaTime * Params.SimSpeed;
+        InNodes[i].Velocity *= Damping;
+        InNodes[i].Velocity = ClampToMaxSize2D(InNodes[i].Velocity, MaxSpeed);
+
+        InNodes[i].Position += InNodes[i].Velocity * DeltaTime;
+    }
+}
+
+FVector2D FNsSpyglassForceLayout::ClampToMaxSize2D(const FVector2D& V, float MaxSize)
+{
+    const float MaxSqr = MaxSize * MaxSize;
+    const float Sqr = V.SizeSquared();
+
+    if (Sqr <= MaxSqr || Sqr <= KINDA_SMALL_NUMBER)
+    {
+        return V;
+    }
+
+    return V * (MaxSize / FMath::Sqrt(Sqr));
+}
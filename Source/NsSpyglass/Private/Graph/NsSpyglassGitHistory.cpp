@@ -0,0 +1,1151 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassGitHistory.h"
+#include "Async/MappedFileHandle.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/SecureHash.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+namespace
+{
+    /** Object types as numbered in pack files. */
+    enum class EGitObject : uint8
+    {
+        None = 0,
+        Commit = 1,
+        Tree = 2,
+        Blob = 3,
+        Tag = 4,
+        OfsDelta = 6,
+        RefDelta = 7
+    };
+
+    /** Pack index header, version 2. */
+    constexpr uint32 PackIndexMagic = 0xff744f63;
+    constexpr uint32 PackIndexVersion = 2;
+
+    /** Git caps delta chains at 50 by default, anything far deeper is a corrupt pack. */
+    constexpr int32 MaxDeltaDepth = 256;
+
+    /** Bytes of resolved delta bases kept around before the cache starts over. */
+    constexpr int64 MaxBaseCacheBytes = 64 * 1024 * 1024;
+
+    /** Directories of a tree that never hold descriptors and are not descended into. */
+    const TCHAR* const SkippedDirs[] = {
+        TEXT("Binaries"), TEXT("Build"), TEXT("Config"), TEXT("Content"), TEXT("DerivedDataCache"),
+        TEXT("Intermediate"), TEXT("Resources"), TEXT("Saved"), TEXT("Shaders"), TEXT("Source")
+    };
+
+    uint32 ReadBigEndian32(const uint8* Data)
+    {
+        return (static_cast<uint32>(Data[0]) << 24) | (static_cast<uint32>(Data[1]) << 16) | (static_cast<uint32>(Data[2]) << 8) | Data[3];
+    }
+
+    uint64 ReadBigEndian64(const uint8* Data)
+    {
+        return (static_cast<uint64>(ReadBigEndian32(Data)) << 32) | ReadBigEndian32(Data + 4);
+    }
+
+    /** Parse a full hexadecimal object id. */
+    bool ParseHash(const FStringView Text, FSHAHash& OutHash)
+    {
+        if (Text.Len() < 40)
+        {
+            return false;
+        }
+        for (int32 i = 0; i < 40; ++i)
+        {
+            if (!FChar::IsHexDigit(Text[i]))
+            {
+                return false;
+            }
+        }
+        OutHash.FromString(FString(Text.Left(40)));
+        return true;
+    }
+
+    /** Text of a UTF-8 range. */
+    FString Utf8ToString(const uint8* Data, const int32 Num)
+    {
+        const FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data), Num);
+        return FString(Converter.Length(), Converter.Get());
+    }
+
+    /** Inflate a zlib stream. ExpectedSize is the exact output size when known, or negative. */
+    bool Inflate(const uint8* Source, const int64 SourceSize, TArray<uint8>& Out, const int64 ExpectedSize)
+    {
+        z_stream Stream;
+        FMemory::Memzero(Stream);
+        if (inflateInit(&Stream) != Z_OK)
+        {
+            return false;
+        }
+
+        // One spare byte lets the stream end without a second round for known sizes
+        Out.SetNumUninitialized(static_cast<int32>(ExpectedSize >= 0 ? ExpectedSize + 1 : FMath::Clamp<int64>(SourceSize * 4, 256, MAX_int32 / 2)));
+        Stream.next_in = const_cast<Bytef*>(Source);
+        Stream.avail_in = static_cast<uInt>(FMath::Min<int64>(SourceSize, MAX_uint32));
+
+        int Result = Z_OK;
+        int64 Written = 0;
+        for (;;)
+        {
+            if (Written == Out.Num())
+            {
+                Out.SetNumUninitialized(Out.Num() * 2);
+            }
+
+            Stream.next_out = Out.GetData() + Written;
+            Stream.avail_out = static_cast<uInt>(Out.Num() - Written);
+            Result = inflate(&Stream, Z_NO_FLUSH);
+            Written = static_cast<int64>(Stream.total_out);
+            if (Result != Z_OK || (Stream.avail_in == 0 && Stream.avail_out > 0))
+            {
+                break;
+            }
+        }
+        inflateEnd(&Stream);
+
+        Out.SetNum(static_cast<int32>(Written));
+        return Result == Z_STREAM_END && (ExpectedSize < 0 || Written == ExpectedSize);
+    }
+
+    /** Size varint at the start of a delta. */
+    bool ReadDeltaSize(const uint8*& Pos, const uint8* End, int64& OutSize)
+    {
+        OutSize = 0;
+        for (int32 Shift = 0; Pos < End && Shift < 64; Shift += 7)
+        {
+            const uint8 Byte = *Pos++;
+            OutSize |= static_cast<int64>(Byte & 0x7f) << Shift;
+            if ((Byte & 0x80) == 0)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Rebuild an object from its base and a delta of copy and insert instructions. */
+    bool ApplyDelta(const TArray<uint8>& Base, const TArray<uint8>& Delta, TArray<uint8>& Out)
+    {
+        const uint8* Pos = Delta.GetData();
+        const uint8* End = Pos + Delta.Num();
+        int64 BaseSize = 0;
+        int64 ResultSize = 0;
+        if (!ReadDeltaSize(Pos, End, BaseSize) || !ReadDeltaSize(Pos, End, ResultSize) || BaseSize != Base.Num() || ResultSize > MAX_int32)
+        {
+            return false;
+        }
+
+        Out.Reset(static_cast<int32>(ResultSize));
+        while (Pos < End)
+        {
+            const uint8 Command = *Pos++;
+            if (Command & 0x80)
+            {
+                uint32 CopyOffset = 0;
+                uint32 CopySize = 0;
+                for (int32 i = 0; i < 4; ++i)
+                {
+                    if (Command & (1 << i))
+                    {
+                        if (Pos >= End)
+                        {
+                            return false;
+                        }
+                        CopyOffset |= static_cast<uint32>(*Pos++) << (8 * i);
+                    }
+                }
+                for (int32 i = 0; i < 3; ++i)
+                {
+                    if (Command & (0x10 << i))
+                    {
+                        if (Pos >= End)
+                        {
+                            return false;
+                        }
+                        CopySize |= static_cast<uint32>(*Pos++) << (8 * i);
+                    }
+                }
+                CopySize = CopySize == 0 ? 0x10000 : CopySize;
+                if (static_cast<uint64>(CopyOffset) + CopySize > static_cast<uint64>(Base.Num()))
+                {
+                    return false;
+                }
+                Out.Append(Base.GetData() + CopyOffset, static_cast<int32>(CopySize));
+            }
+            else if (Command != 0)
+            {
+                if (End - Pos < Command)
+                {
+                    return false;
+                }
+                Out.Append(Pos, Command);
+                Pos += Command;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        return Out.Num() == ResultSize;
+    }
+
+    /** Read-only access to the objects and refs of one repository. */
+    class FGitObjectStore
+    {
+    public:
+
+        ~FGitObjectStore()
+        {
+            // Regions go before the files they map
+            for (TUniquePtr<FPack>& Pack : Packs)
+            {
+                Pack->IndexRegion.Reset();
+                Pack->IndexHandle.Reset();
+                Pack->DataRegion.Reset();
+                Pack->DataHandle.Reset();
+            }
+        }
+
+        /** Find the git directory of the working tree holding a directory, or take the directory as one, and map its packs. */
+        bool Open(const FString& RepositoryDir, FString& OutError)
+        {
+            const FString Dir = FPaths::ConvertRelativePathToFull(RepositoryDir);
+            IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+            // A project often lives further down a larger repository
+            FString WorkDir = Dir;
+            while (!PlatformFile.DirectoryExists(*(WorkDir / TEXT(".git"))) && !PlatformFile.FileExists(*(WorkDir / TEXT(".git"))))
+            {
+                const FString Parent = FPaths::GetPath(WorkDir);
+                if (Parent.IsEmpty() || Parent == WorkDir)
+                {
+                    WorkDir.Reset();
+                    break;
+                }
+                WorkDir = Parent;
+            }
+
+            FString DotGit;
+            if (!WorkDir.IsEmpty() && PlatformFile.DirectoryExists(*(WorkDir / TEXT(".git"))))
+            {
+                GitDir = WorkDir / TEXT(".git");
+            }
+            else if (!WorkDir.IsEmpty() && FFileHelper::LoadFileToString(DotGit, *(WorkDir / TEXT(".git")), FFileHelper::EHashOptions::None, FILEREAD_Silent))
+            {
+                // Worktrees and submodules point to their git directory from a file
+                DotGit.TrimStartAndEndInline();
+                if (!DotGit.RemoveFromStart(TEXT("gitdir:")))
+                {
+                    OutError = FString::Printf(TEXT("Unexpected .git file in %s"), *WorkDir);
+                    return false;
+                }
+                DotGit.TrimStartInline();
+                GitDir = FPaths::IsRelative(DotGit) ? WorkDir / DotGit : DotGit;
+            }
+            else if (PlatformFile.FileExists(*(Dir / TEXT("HEAD"))) && PlatformFile.DirectoryExists(*(Dir / TEXT("objects"))))
+            {
+                GitDir = Dir;
+            }
+            else
+            {
+                OutError = FString::Printf(TEXT("No git repository at or above %s"), *Dir);
+                return false;
+            }
+            FPaths::CollapseRelativeDirectories(GitDir);
+
+            // Linked worktrees keep objects and shared refs in the main git directory
+            CommonDir = GitDir;
+            FString Common;
+            if (FFileHelper::LoadFileToString(Common, *(GitDir / TEXT("commondir")), FFileHelper::EHashOptions::None, FILEREAD_Silent))
+            {
+                Common.TrimStartAndEndInline();
+                CommonDir = FPaths::IsRelative(Common) ? GitDir / Common : Common;
+                FPaths::CollapseRelativeDirectories(CommonDir);
+            }
+            ObjectsDir = CommonDir / TEXT("objects");
+
+            TArray<FString> IndexFiles;
+            IFileManager::Get().FindFiles(IndexFiles, *(ObjectsDir / TEXT("pack") / TEXT("*.idx")), true, false);
+            for (const FString& IndexFile : IndexFiles)
+            {
+                OpenPack(ObjectsDir / TEXT("pack") / IndexFile);
+            }
+
+            FString PackedRefsText;
+            if (FFileHelper::LoadFileToString(PackedRefsText, *(CommonDir / TEXT("packed-refs")), FFileHelper::EHashOptions::None, FILEREAD_Silent))
+            {
+                TArray<FString> Lines;
+                PackedRefsText.ParseIntoArrayLines(Lines);
+                for (const FString& Line : Lines)
+                {
+                    FSHAHash Hash;
+                    if (Line.Len() > 41 && ParseHash(Line, Hash))
+                    {
+                        PackedRefs.Add(Line.RightChop(41), Hash);
+                    }
+                }
+            }
+            return true;
+        }
+
+        /** Resolve a full id or a ref name to a commit, peeling annotated tags. */
+        bool ResolveRevision(const FString& Revision, FSHAHash& OutHash, FString& OutError)
+        {
+            const FString Name = Revision.TrimStartAndEnd().IsEmpty() ? FString(TEXT("HEAD")) : Revision.TrimStartAndEnd();
+            if (!(Name.Len() == 40 && ParseHash(Name, OutHash)))
+            {
+                // The lookup order git uses for a short ref name
+                const FString Candidates[] = {
+                    Name, TEXT("refs/") + Name, TEXT("refs/tags/") + Name, TEXT("refs/heads/") + Name,
+                    TEXT("refs/remotes/") + Name, TEXT("refs/remotes/") + Name + TEXT("/HEAD")
+                };
+                bool bFound = false;
+                for (const FString& Candidate : Candidates)
+                {
+                    if (ReadRef(Candidate, OutHash, 0))
+                    {
+                        bFound = true;
+                        break;
+                    }
+                }
+                if (!bFound)
+                {
+                    OutError = FString::Printf(TEXT("Unknown revision '%s'"), *Name);
+                    return false;
+                }
+            }
+
+            for (int32 Peel = 0; Peel < 8; ++Peel)
+            {
+                EGitObject Type = EGitObject::None;
+                TArray<uint8> Data;
+                if (!Read(OutHash, Type, Data))
+                {
+                    OutError = FString::Printf(TEXT("Cannot read object %s of '%s'"), *OutHash.ToString(), *Name);
+                    return false;
+                }
+                if (Type == EGitObject::Commit)
+                {
+                    return true;
+                }
+
+                // An annotated tag names its target on the first line
+                if (Type != EGitObject::Tag || Data.Num() < 47 || FMemory::Memcmp(Data.GetData(), "object ", 7) != 0
+                    || !ParseHash(Utf8ToString(Data.GetData() + 7, 40), OutHash))
+                {
+                    break;
+                }
+            }
+
+            OutError = FString::Printf(TEXT("'%s' does not name a commit"), *Name);
+            return false;
+        }
+
+        /** Read an object from a pack or from its loose file. */
+        bool Read(const FSHAHash& Hash, EGitObject& OutType, TArray<uint8>& OutData)
+        {
+            for (int32 PackIndex = 0; PackIndex < Packs.Num(); ++PackIndex)
+            {
+                int64 Offset = 0;
+                if (FindInPack(*Packs[PackIndex], Hash, Offset))
+                {
+                    return ReadPacked(PackIndex, Offset, OutType, OutData, 0);
+                }
+            }
+            return ReadLoose(Hash, OutType, OutData);
+        }
+
+    private:
+
+        /** A mapped pack and its index. */
+        struct FPack
+        {
+            TUniquePtr<IMappedFileHandle> IndexHandle;
+            TUniquePtr<IMappedFileRegion> IndexRegion;
+            TUniquePtr<IMappedFileHandle> DataHandle;
+            TUniquePtr<IMappedFileRegion> DataRegion;
+
+            const uint8* Index = nullptr;
+            const uint8* Data = nullptr;
+            int64 DataSize = 0;
+            uint32 NumObjects = 0;
+        };
+
+        /** A resolved delta base. */
+        struct FCachedObject
+        {
+            EGitObject Type = EGitObject::None;
+            TArray<uint8> Data;
+        };
+
+        void OpenPack(const FString& IndexPath)
+        {
+            IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+            TUniquePtr<FPack> Pack = MakeUnique<FPack>();
+
+            Pack->IndexHandle.Reset(PlatformFile.OpenMapped(*IndexPath));
+            Pack->DataHandle.Reset(PlatformFile.OpenMapped(*FPaths::ChangeExtension(IndexPath, TEXT("pack"))));
+            if (!Pack->IndexHandle.IsValid() || !Pack->DataHandle.IsValid())
+            {
+                return;
+            }
+            Pack->IndexRegion.Reset(Pack->IndexHandle->MapRegion(0, Pack->IndexHandle->GetFileSize()));
+            Pack->DataRegion.Reset(Pack->DataHandle->MapRegion(0, Pack->DataHandle->GetFileSize()));
+            if (!Pack->IndexRegion.IsValid() || !Pack->DataRegion.IsValid())
+            {
+                return;
+            }
+
+            // Header, fan-out table, then ids, checksums and offsets of every object
+            const int64 IndexSize = Pack->IndexRegion->GetMappedSize();
+            Pack->Index = Pack->IndexRegion->GetMappedPtr();
+            if (IndexSize < 8 + 256 * 4 || ReadBigEndian32(Pack->Index) != PackIndexMagic || ReadBigEndian32(Pack->Index + 4) != PackIndexVersion)
+            {
+                return;
+            }
+            Pack->NumObjects = ReadBigEndian32(Pack->Index + 8 + 255 * 4);
+            if (IndexSize < 8 + 256 * 4 + static_cast<int64>(Pack->NumObjects) * 28)
+            {
+                return;
+            }
+
+            Pack->Data = Pack->DataRegion->GetMappedPtr();
+            Pack->DataSize = Pack->DataRegion->GetMappedSize();
+            if (Pack->DataSize < 12 || FMemory::Memcmp(Pack->Data, "PACK", 4) != 0)
+            {
+                return;
+            }
+            Packs.Add(MoveTemp(Pack));
+        }
+
+        bool FindInPack(const FPack& Pack, const FSHAHash& Hash, int64& OutOffset) const
+        {
+            const uint8* Fanout = Pack.Index + 8;
+            const uint8 FirstByte = Hash.Hash[0];
+            uint32 Low = FirstByte == 0 ? 0 : ReadBigEndian32(Fanout + (FirstByte - 1) * 4);
+            uint32 High = ReadBigEndian32(Fanout + FirstByte * 4);
+            const uint8* Names = Fanout + 256 * 4;
+
+            while (Low < High)
+            {
+                const uint32 Mid = Low + (High - Low) / 2;
+                const int32 Order = FMemory::Memcmp(Names + static_cast<int64>(Mid) * 20, Hash.Hash, 20);
+                if (Order == 0)
+                {
+                    const uint8* Offsets = Names + static_cast<int64>(Pack.NumObjects) * 24;
+                    const uint32 Offset = ReadBigEndian32(Offsets + static_cast<int64>(Mid) * 4);
+
+                    // Packs past 2 GB keep large offsets in a trailing table
+                    if (Offset & 0x80000000)
+                    {
+                        const uint8* LargeOffsets = Offsets + static_cast<int64>(Pack.NumObjects) * 4;
+                        OutOffset = static_cast<int64>(ReadBigEndian64(LargeOffsets + static_cast<int64>(Offset & 0x7fffffff) * 8));
+                    }
+                    else
+                    {
+                        OutOffset = Offset;
+                    }
+                    return OutOffset < Pack.DataSize;
+                }
+                if (Order < 0)
+                {
+                    Low = Mid + 1;
+                }
+                else
+                {
+                    High = Mid;
+                }
+            }
+            return false;
+        }
+
+        bool ReadPacked(const int32 PackIndex, const int64 Offset, EGitObject& OutType, TArray<uint8>& OutData, const int32 Depth)
+        {
+            if (Depth > MaxDeltaDepth)
+            {
+                return false;
+            }
+
+            const uint64 CacheKey = (static_cast<uint64>(PackIndex) << 48) | static_cast<uint64>(Offset);
+            if (const FCachedObject* Cached = BaseCache.Find(CacheKey))
+            {
+                OutType = Cached->Type;
+                OutData = Cached->Data;
+                return true;
+            }
+
+            const FPack& Pack = *Packs[PackIndex];
+            const uint8* Data = Pack.Data;
+            int64 Pos = Offset;
+
+            // Type and inflated size share a varint
+            uint8 Byte = Data[Pos++];
+            const EGitObject Type = static_cast<EGitObject>((Byte >> 4) & 7);
+            int64 Size = Byte & 15;
+            for (int32 Shift = 4; (Byte & 0x80) && Pos < Pack.DataSize && Shift < 64; Shift += 7)
+            {
+                Byte = Data[Pos++];
+                Size |= static_cast<int64>(Byte & 0x7f) << Shift;
+            }
+
+            if (Type == EGitObject::OfsDelta || Type == EGitObject::RefDelta)
+            {
+                int32 BasePack = PackIndex;
+                int64 BaseOffset = 0;
+                if (Type == EGitObject::OfsDelta)
+                {
+                    // Distance back to the base, each continuation byte adds one before shifting
+                    if (Pos >= Pack.DataSize)
+                    {
+                        return false;
+                    }
+                    Byte = Data[Pos++];
+                    int64 Distance = Byte & 0x7f;
+                    while (Byte & 0x80)
+                    {
+                        if (Pos >= Pack.DataSize)
+                        {
+                            return false;
+                        }
+                        Byte = Data[Pos++];
+                        Distance = ((Distance + 1) << 7) | (Byte & 0x7f);
+                    }
+                    BaseOffset = Offset - Distance;
+                    if (BaseOffset < 0 || Distance == 0)
+                    {
+                        return false;
+                    }
+                }
+                else
+                {
+                    if (Pos + 20 > Pack.DataSize)
+                    {
+                        return false;
+                    }
+                    FSHAHash BaseHash;
+                    FMemory::Memcpy(BaseHash.Hash, Data + Pos, 20);
+                    Pos += 20;
+
+                    BasePack = INDEX_NONE;
+                    for (int32 Candidate = 0; Candidate < Packs.Num() && BasePack == INDEX_NONE; ++Candidate)
+                    {
+                        BasePack = FindInPack(*Packs[Candidate], BaseHash, BaseOffset) ? Candidate : INDEX_NONE;
+                    }
+                    if (BasePack == INDEX_NONE)
+                    {
+                        return false;
+                    }
+                }
+
+                TArray<uint8> Delta;
+                TArray<uint8> Base;
+                EGitObject BaseType = EGitObject::None;
+                if (!Inflate(Data + Pos, Pack.DataSize - Pos, Delta, Size)
+                    || !ReadPacked(BasePack, BaseOffset, BaseType, Base, Depth + 1)
+                    || !ApplyDelta(Base, Delta, OutData))
+                {
+                    return false;
+                }
+                OutType = BaseType;
+            }
+            else
+            {
+                OutType = Type;
+                if (!Inflate(Data + Pos, Pack.DataSize - Pos, OutData, Size))
+                {
+                    return false;
+                }
+            }
+
+            // Objects read as bases are bases of their neighbours too, keep them for the next chain
+            if (Depth > 0)
+            {
+                if (BaseCacheBytes + OutData.Num() > MaxBaseCacheBytes)
+                {
+                    BaseCache.Reset();
+                    BaseCacheBytes = 0;
+                }
+                BaseCache.Add(CacheKey, FCachedObject{ OutType, OutData });
+                BaseCacheBytes += OutData.Num();
+            }
+            return true;
+        }
+
+        bool ReadLoose(const FSHAHash& Hash, EGitObject& OutType, TArray<uint8>& OutData) const
+        {
+            const FString Hex = Hash.ToString().ToLower();
+            TArray<uint8> Compressed;
+            if (!FFileHelper::LoadFileToArray(Compressed, *(ObjectsDir / Hex.Left(2) / Hex.RightChop(2)), FILEREAD_Silent))
+            {
+                return false;
+            }
+
+            TArray<uint8> Raw;
+            if (!Inflate(Compressed.GetData(), Compressed.Num(), Raw, -1))
+            {
+                return false;
+            }
+
+            // "<type> <size>\0<payload>"
+            const int32 Header = Raw.Find(0);
+            if (Header == INDEX_NONE)
+            {
+                return false;
+            }
+            const FString TypeName = Utf8ToString(Raw.GetData(), Header);
+            OutType = TypeName.StartsWith(TEXT("commit ")) ? EGitObject::Commit
+                : TypeName.StartsWith(TEXT("tree ")) ? EGitObject::Tree
+                : TypeName.StartsWith(TEXT("blob ")) ? EGitObject::Blob
+                : TypeName.StartsWith(TEXT("tag ")) ? EGitObject::Tag
+                : EGitObject::None;
+            OutData.Reset(Raw.Num() - Header - 1);
+            OutData.Append(Raw.GetData() + Header + 1, Raw.Num() - Header - 1);
+            return OutType != EGitObject::None;
+        }
+
+        bool ReadRef(const FString& Name, FSHAHash& OutHash, const int32 Depth) const
+        {
+            if (Depth > 8)
+            {
+                return false;
+            }
+
+            // HEAD and other per worktree refs live in the git directory, shared ones in the common directory
+            FString Contents;
+            if (FFileHelper::LoadFileToString(Contents, *(GitDir / Name), FFileHelper::EHashOptions::None, FILEREAD_Silent)
+                || FFileHelper::LoadFileToString(Contents, *(CommonDir / Name), FFileHelper::EHashOptions::None, FILEREAD_Silent))
+            {
+                Contents.TrimStartAndEndInline();
+                if (Contents.RemoveFromStart(TEXT("ref:")))
+                {
+                    return ReadRef(Contents.TrimStart(), OutHash, Depth + 1);
+                }
+                return ParseHash(Contents, OutHash);
+            }
+
+            if (const FSHAHash* Packed = PackedRefs.Find(Name))
+            {
+                OutHash = *Packed;
+                return true;
+            }
+            return false;
+        }
+
+        FString GitDir;
+        FString CommonDir;
+        FString ObjectsDir;
+        TArray<TUniquePtr<FPack>> Packs;
+        TMap<FString, FSHAHash> PackedRefs;
+
+        /** Resolved delta bases by pack and offset. */
+        TMap<uint64, FCachedObject> BaseCache;
+        int64 BaseCacheBytes = 0;
+    };
+
+    /** Fields of a commit the timeline shows. */
+    struct FCommitInfo
+    {
+        FSHAHash Tree;
+        FSHAHash Parent;
+        bool bHasParent = false;
+        FString Author;
+        FDateTime Time;
+        FString Summary;
+    };
+
+    bool ParseCommit(const TArray<uint8>& Data, FCommitInfo& Out)
+    {
+        const FString Text = Utf8ToString(Data.GetData(), Data.Num());
+        bool bHasTree = false;
+        int32 Pos = 0;
+        while (Pos < Text.Len())
+        {
+            int32 End = Text.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos);
+            End = End == INDEX_NONE ? Text.Len() : End;
+            const FStringView Line(*Text + Pos, End - Pos);
+            Pos = End + 1;
+
+            // Headers end at the first empty line, the summary is the first line after it
+            if (Line.IsEmpty())
+            {
+                End = Text.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Pos);
+                Out.Summary = Text.Mid(Pos, (End == INDEX_NONE ? Text.Len() : End) - Pos).TrimEnd();
+                break;
+            }
+
+            if (Line.StartsWith(TEXT("tree ")))
+            {
+                bHasTree = ParseHash(Line.RightChop(5), Out.Tree);
+            }
+            else if (Line.StartsWith(TEXT("parent ")) && !Out.bHasParent)
+            {
+                Out.bHasParent = ParseHash(Line.RightChop(7), Out.Parent);
+            }
+            else if (Line.StartsWith(TEXT("author ")))
+            {
+                // "author Name <email> 1700000000 +0100"
+                int32 Mail = INDEX_NONE;
+                int32 MailEnd = INDEX_NONE;
+                if (Line.FindChar(TEXT('<'), Mail) && Line.FindLastChar(TEXT('>'), MailEnd))
+                {
+                    Out.Author = FString(Line.Mid(7, Mail - 7)).TrimEnd();
+                    const FString Stamp = FString(Line.RightChop(MailEnd + 1)).TrimStart();
+                    Out.Time = FDateTime::FromUnixTimestamp(FCString::Atoi64(*Stamp));
+                }
+            }
+        }
+        return bHasTree;
+    }
+
+    bool IsDescriptor(const FStringView Name)
+    {
+        return Name.EndsWith(TEXT(".uplugin"), ESearchCase::IgnoreCase) || Name.EndsWith(TEXT(".uproject"), ESearchCase::IgnoreCase);
+    }
+
+    bool IsSkippedDir(const FStringView Name)
+    {
+        for (const TCHAR* Skipped : SkippedDirs)
+        {
+            if (Name.Equals(Skipped, ESearchCase::IgnoreCase))
+            {
+                return true;
+            }
+        }
+        return Name.StartsWith(TEXT("."));
+    }
+
+    /** A tree entry that may lead to a descriptor. */
+    struct FTreeEntry
+    {
+        FString Name;
+        FSHAHash Hash;
+        bool bIsTree = false;
+    };
+
+    /** Read a tree, keeping subtrees worth descending into and descriptor blobs. */
+    bool ReadTree(FGitObjectStore& Store, const FSHAHash& Hash, TArray<FTreeEntry>& OutEntries)
+    {
+        EGitObject Type = EGitObject::None;
+        TArray<uint8> Data;
+        if (!Store.Read(Hash, Type, Data) || Type != EGitObject::Tree)
+        {
+            return false;
+        }
+
+        // "<octal mode> <name>\0<20 byte id>" per entry
+        int32 Pos = 0;
+        while (Pos < Data.Num())
+        {
+            int32 ModeEnd = Pos;
+            while (ModeEnd < Data.Num() && Data[ModeEnd] != ' ')
+            {
+                ++ModeEnd;
+            }
+            int32 NameEnd = ModeEnd + 1;
+            while (NameEnd < Data.Num() && Data[NameEnd] != 0)
+            {
+                ++NameEnd;
+            }
+            if (NameEnd + 21 > Data.Num())
+            {
+                return false;
+            }
+
+            // Trees have mode 40000, submodules 160000 and symlinks 120000 are neither trees nor descriptors
+            const bool bIsTree = ModeEnd - Pos == 5 && Data[Pos] == '4';
+            const bool bIsFile = ModeEnd - Pos == 6 && Data[Pos] == '1' && Data[Pos + 1] == '0';
+            const FString Name = Utf8ToString(Data.GetData() + ModeEnd + 1, NameEnd - ModeEnd - 1);
+            if ((bIsTree && !IsSkippedDir(Name)) || (bIsFile && IsDescriptor(Name)))
+            {
+                FTreeEntry& Entry = OutEntries.AddDefaulted_GetRef();
+                Entry.Name = Name;
+                Entry.bIsTree = bIsTree;
+                FMemory::Memcpy(Entry.Hash.Hash, Data.GetData() + NameEnd + 1, 20);
+            }
+            Pos = NameEnd + 21;
+        }
+        return true;
+    }
+
+    /** A descriptor that appeared, changed or went away. */
+    struct FDescriptorChange
+    {
+        FString Path;
+        FSHAHash Blob;
+        bool bRemoved = false;
+    };
+
+    /** Collect descriptor changes between two trees, either may be null. Subtrees with equal ids are skipped. */
+    bool DiffTrees(FGitObjectStore& Store, const FSHAHash* OldTree, const FSHAHash* NewTree, const FString& Prefix, TArray<FDescriptorChange>& OutChanges)
+    {
+        if (OldTree && NewTree && *OldTree == *NewTree)
+        {
+            return true;
+        }
+
+        TArray<FTreeEntry> OldEntries;
+        TArray<FTreeEntry> NewEntries;
+        if ((OldTree && !ReadTree(Store, *OldTree, OldEntries)) || (NewTree && !ReadTree(Store, *NewTree, NewEntries)))
+        {
+            return false;
+        }
+
+        const auto Removed = [&Store, &Prefix, &OutChanges](const FTreeEntry& Entry)
+        {
+            if (Entry.bIsTree)
+            {
+                return DiffTrees(Store, &Entry.Hash, nullptr, Prefix + Entry.Name + TEXT("/"), OutChanges);
+            }
+            OutChanges.Add(FDescriptorChange{ Prefix + Entry.Name, Entry.Hash, true });
+            return true;
+        };
+
+        for (const FTreeEntry& New : NewEntries)
+        {
+            const FTreeEntry* Old = OldEntries.FindByPredicate([&New](const FTreeEntry& Entry) { return Entry.Name == New.Name && Entry.bIsTree == New.bIsTree; });
+            if (Old && Old->Hash == New.Hash)
+            {
+                continue;
+            }
+
+            if (New.bIsTree)
+            {
+                if (!DiffTrees(Store, Old ? &Old->Hash : nullptr, &New.Hash, Prefix + New.Name + TEXT("/"), OutChanges))
+                {
+                    return false;
+                }
+            }
+            else
+            {
+                OutChanges.Add(FDescriptorChange{ Prefix + New.Name, New.Hash, false });
+            }
+        }
+
+        for (const FTreeEntry& Old : OldEntries)
+        {
+            const bool bKept = NewEntries.ContainsByPredicate([&Old](const FTreeEntry& Entry) { return Entry.Name == Old.Name && Entry.bIsTree == Old.bIsTree; });
+            if (!bKept && !Removed(Old))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /** Plugins a descriptor depends on, or a project enables. Disabled entries are left out. */
+    void ParseDescriptor(const TArray<uint8>& Blob, TArray<FString>& OutPlugins)
+    {
+        // Descriptors saved by some editors start with a byte order mark
+        const int32 Skip = Blob.Num() >= 3 && Blob[0] == 0xEF && Blob[1] == 0xBB && Blob[2] == 0xBF ? 3 : 0;
+        const FString Text = Utf8ToString(Blob.GetData() + Skip, Blob.Num() - Skip);
+
+        TSharedPtr<FJsonObject> Root;
+        const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Text);
+        const TArray<TSharedPtr<FJsonValue>>* Plugins = nullptr;
+        if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("Plugins"), Plugins))
+        {
+            return;
+        }
+
+        for (const TSharedPtr<FJsonValue>& Value : *Plugins)
+        {
+            const TSharedPtr<FJsonObject>* Entry = nullptr;
+            FString Name;
+            bool bEnabled = true;
+            if (Value.IsValid() && Value->TryGetObject(Entry) && (*Entry)->TryGetStringField(TEXT("Name"), Name))
+            {
+                (*Entry)->TryGetBoolField(TEXT("Enabled"), bEnabled);
+                if (bEnabled && !Name.IsEmpty())
+                {
+                    OutPlugins.Add(Name);
+                }
+            }
+        }
+    }
+
+    /** Pack a directed plugin pair into a single key. */
+    uint64 PackPair(const int32 From, const int32 To)
+    {
+        return (static_cast<uint64>(static_cast<uint32>(From)) << 32) | static_cast<uint32>(To);
+    }
+
+    /**
+     * Turns descriptor changes into graph ops.
+     * Nodes and edges are reference counted: a plugin is in the graph while a descriptor of it exists or anything
+     * refers to it, an edge while any descriptor of its source names its target. Only transitions are recorded.
+     */
+    class FHistoryBuilder
+    {
+    public:
+
+        FHistoryBuilder(FGitObjectStore& InStore, FNsSpyglassHistory& InHistory)
+            : Store(InStore)
+            , History(InHistory)
+        {
+        }
+
+        /** Apply the descriptor changes of one commit and record its ops. */
+        bool AddCommit(const TArray<FDescriptorChange>& Changes)
+        {
+            NodeDeltas.Reset();
+            EdgeDeltas.Reset();
+
+            for (const FDescriptorChange& Change : Changes)
+            {
+                if (const FLiveDescriptor* Old = Live.Find(Change.Path))
+                {
+                    Apply(*Old, -1);
+                    Live.Remove(Change.Path);
+                }
+                if (Change.bRemoved)
+                {
+                    continue;
+                }
+
+                FLiveDescriptor Descriptor;
+                const bool bIsPlugin = Change.Path.EndsWith(TEXT(".uplugin"), ESearchCase::IgnoreCase);
+                Descriptor.Node = bIsPlugin ? FindOrAddNode(FPaths::GetBaseFilename(Change.Path)) : INDEX_NONE;
+                if (bIsPlugin)
+                {
+                    History.IsLocal[Descriptor.Node] = true;
+                }
+                if (!GetTargets(Change.Blob, Descriptor.Targets))
+                {
+                    return false;
+                }
+
+                Apply(Descriptor, 1);
+                Live.Add(Change.Path, MoveTemp(Descriptor));
+            }
+
+            // Adds go first and removals last, so every edge op finds both of its nodes present
+            TArray<uint64> Removals;
+            for (const TPair<int32, int32>& Delta : NodeDeltas)
+            {
+                const int32 Old = NodeRefs[Delta.Key];
+                NodeRefs[Delta.Key] += Delta.Value;
+                if (Old == 0 && NodeRefs[Delta.Key] > 0)
+                {
+                    History.Ops.Add(FNsSpyglassHistory::PackOp(ENsSpyglassHistoryOp::AddNode, Delta.Key));
+                }
+                else if (Old > 0 && NodeRefs[Delta.Key] == 0)
+                {
+                    Removals.Add(FNsSpyglassHistory::PackOp(ENsSpyglassHistoryOp::RemoveNode, Delta.Key));
+                }
+            }
+            for (const TPair<uint64, int32>& Delta : EdgeDeltas)
+            {
+                int32& Refs = EdgeRefs.FindOrAdd(Delta.Key, 0);
+                const int32 Old = Refs;
+                Refs += Delta.Value;
+                const int32 From = static_cast<int32>(Delta.Key >> 32);
+                const int32 To = static_cast<int32>(Delta.Key & 0xffffffff);
+                if (Old == 0 && Refs > 0)
+                {
+                    History.Ops.Add(FNsSpyglassHistory::PackOp(ENsSpyglassHistoryOp::AddEdge, From, To));
+                }
+                else if (Old > 0 && Refs == 0)
+                {
+                    History.Ops.Add(FNsSpyglassHistory::PackOp(ENsSpyglassHistoryOp::RemoveEdge, From, To));
+                    EdgeRefs.Remove(Delta.Key);
+                }
+            }
+            History.Ops.Append(Removals);
+            History.OpStart.Add(History.Ops.Num());
+            return true;
+        }
+
+    private:
+
+        /** What a descriptor in the current tree contributes. */
+        struct FLiveDescriptor
+        {
+            /** Node of the plugin it describes, INDEX_NONE for a project. */
+            int32 Node = INDEX_NONE;
+
+            /** Nodes it depends on or enables. */
+            TArray<int32> Targets;
+        };
+
+        int32 FindOrAddNode(const FString& Name)
+        {
+            if (const int32* Existing = NameToNode.Find(Name))
+            {
+                return *Existing;
+            }
+
+            const int32 Node = History.NodeNames.Add(Name);
+            History.IsLocal.Add(false);
+            NodeRefs.Add(0);
+            NameToNode.Add(Name, Node);
+            return Node;
+        }
+
+        /** Targets of a blob, parsed the first time the blob id is seen. */
+        bool GetTargets(const FSHAHash& Blob, TArray<int32>& OutTargets)
+        {
+            if (const TArray<int32>* Cached = BlobTargets.Find(Blob))
+            {
+                OutTargets = *Cached;
+                return true;
+            }
+
+            EGitObject Type = EGitObject::None;
+            TArray<uint8> Data;
+            if (!Store.Read(Blob, Type, Data) || Type != EGitObject::Blob)
+            {
+                return false;
+            }
+
+            TArray<FString> Names;
+            ParseDescriptor(Data, Names);
+            ++History.NumParsedBlobs;
+
+            for (const FString& Name : Names)
+            {
+                OutTargets.AddUnique(FindOrAddNode(Name));
+            }
+            BlobTargets.Add(Blob, OutTargets);
+            return true;
+        }
+
+        void Apply(const FLiveDescriptor& Descriptor, const int32 Sign)
+        {
+            if (Descriptor.Node != INDEX_NONE)
+            {
+                NodeDeltas.FindOrAdd(Descriptor.Node, 0) += Sign;
+            }
+            for (const int32 Target : Descriptor.Targets)
+            {
+                NodeDeltas.FindOrAdd(Target, 0) += Sign;
+                if (Descriptor.Node != INDEX_NONE && Target != Descriptor.Node)
+                {
+                    EdgeDeltas.FindOrAdd(PackPair(Descriptor.Node, Target), 0) += Sign;
+                }
+            }
+        }
+
+        FGitObjectStore& Store;
+        FNsSpyglassHistory& History;
+
+        /** Descriptors of the current tree by path. */
+        TMap<FString, FLiveDescriptor> Live;
+
+        /** Node ids by plugin name, names compare without case like plugin names do. */
+        TMap<FString, int32> NameToNode;
+
+        /** Parsed targets by blob id. */
+        TMap<FSHAHash, TArray<int32>> BlobTargets;
+
+        /** Reference counts of the current graph. */
+        TArray<int32> NodeRefs;
+        TMap<uint64, int32> EdgeRefs;
+
+        /** Net reference changes of the commit being added. */
+        TMap<int32, int32> NodeDeltas;
+        TMap<uint64, int32> EdgeDeltas;
+    };
+}
+
+bool FNsSpyglassGitHistory::Load(const FParams& Params, FNsSpyglassHistory& OutHistory, FString& OutError, std::atomic<int32>* Progress, const std::atomic<bool>* Cancel)
+{
+    const double StartTime = FPlatformTime::Seconds();
+    OutHistory = FNsSpyglassHistory();
+    OutHistory.RepositoryDir = Params.RepositoryDir;
+    OutHistory.OpStart.Add(0);
+
+    FGitObjectStore Store;
+    if (!Store.Open(Params.RepositoryDir, OutError))
+    {
+        return false;
+    }
+
+    FSHAHash To;
+    FSHAHash From;
+    const bool bHasFrom = !Params.FromRevision.TrimStartAndEnd().IsEmpty();
+    if (!Store.ResolveRevision(Params.ToRevision, To, OutError) || (bHasFrom && !Store.ResolveRevision(Params.FromRevision, From, OutError)))
+    {
+        return false;
+    }
+
+    // --- First-parent chain, newest first ---
+    TArray<FSHAHash> Chain;
+    TArray<FCommitInfo> Infos;
+    for (FSHAHash Current = To; Chain.Num() < FMath::Max(1, Params.MaxCommits);)
+    {
+        if (Cancel && Cancel->load(std::memory_order_relaxed))
+        {
+            OutError = TEXT("Cancelled");
+            return false;
+        }
+
+        EGitObject Type = EGitObject::None;
+        TArray<uint8> Data;
+        FCommitInfo& Info = Infos.AddDefaulted_GetRef();
+        if (!Store.Read(Current, Type, Data) || Type != EGitObject::Commit || !ParseCommit(Data, Info))
+        {
+            OutError = FString::Printf(TEXT("Cannot read commit %s"), *Current.ToString());
+            return false;
+        }
+        Chain.Add(Current);
+
+        if ((bHasFrom && Current == From) || !Info.bHasParent)
+        {
+            break;
+        }
+        Current = Info.Parent;
+    }
+
+    if (bHasFrom && Chain.Last() != From)
+    {
+        OutError = FString::Printf(TEXT("'%s' is not within %d first-parent commits of '%s'"), *Params.FromRevision, Params.MaxCommits, *Params.ToRevision);
+        return false;
+    }
+
+    // --- Deltas, oldest first, each tree diffed against its parent's ---
+    FHistoryBuilder Builder(Store, OutHistory);
+    TArray<FDescriptorChange> Changes;
+    for (int32 Index = Chain.Num() - 1; Index >= 0; --Index)
+    {
+        if (Cancel && Cancel->load(std::memory_order_relaxed))
+        {
+            OutError = TEXT("Cancelled");
+            return false;
+        }
+
+        const FCommitInfo& Info = Infos[Index];
+        const FSHAHash* ParentTree = Index + 1 < Chain.Num() ? &Infos[Index + 1].Tree : nullptr;
+        Changes.Reset();
+        if (!DiffTrees(Store, ParentTree, &Info.Tree, FString(), Changes) || !Builder.AddCommit(Changes))
+        {
+            OutError = FString::Printf(TEXT("Cannot read the tree of commit %s"), *Chain[Index].ToString());
+            return false;
+        }
+
+        FNsSpyglassHistoryCommit& Commit = OutHistory.Commits.AddDefaulted_GetRef();
+        Commit.Hash = Chain[Index].ToString().ToLower();
+        Commit.Summary = Info.Summary;
+        Commit.Author = Info.Author;
+        Commit.Time = Info.Time;
+
+        if (Progress)
+        {
+            Progress->fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    OutHistory.LoadSeconds = FPlatformTime::Seconds() - StartTime;
+    return true;
+}
@@ -0,0 +1,69 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassGraphBuilder.h"
+#include "Interfaces/IPluginManager.h"
+
+void FNsSpyglassGraphBuilder::BuildPluginNodes(TArray<FPluginNode>& OutNodes)
+{
+    BuildPluginNodes(IPluginManager::Get().GetEnabledPlugins(), OutNodes);
+}
+
+void FNsSpyglassGraphBuilder::BuildPluginNodes(const TArray<TSharedRef<IPlugin>>& Plugins, TArray<FPluginNode>& OutNodes)
+{
+    OutNodes.Reset();
+
+    TMap<FString, int32> NameToIndex;
+    TMap<FString, FLinearColor> CategoryColors;
+
+    // Create nodes for plugins
+    for (const TSharedRef<IPlugin>& Plugin : Plugins)
+    {
+        FPluginNode Node;
+        Node.Name = Plugin->GetName();
+        Node.Plugin = Plugin;
+        Node.bIsEngine = Plugin->GetLoadedFrom() == EPluginLoadedFrom::Engine;
+        Node.Position = FVector2D::ZeroVector;
+        Node.bFixed = false;
+
+        const FPluginDescriptor& Desc = Plugin->GetDescriptor();
+        const FString Category = Desc.Category.IsEmpty() ? TEXT("Misc") : Desc.Category;
+
+        FLinearColor* Existing = CategoryColors.Find(Category);
+        if (!Existing)
+        {
+            const int32 Index = CategoryColors.Num();
+            const float Hue = FMath::Fmod(static_cast<float>(Index) * 50.f, 360.f);
+            FLinearColor NewColor = FLinearColor::MakeFromHSV8(static_cast<uint8>(Hue), 160, 255);
+            NewColor.A = 0.1f;
+            CategoryColors.Add(Category, NewColor);
+            Existing = CategoryColors.Find(Category);
+        }
+        Node.Color = *Existing;
+        Node.Color.A = 0.1f;
+
+        int32 Idx = OutNodes.Add(Node);
+        NameToIndex.Add(Node.Name, Idx);
+    }
+
+    // Fill in links
+    for (int32 i = 0; i < OutNodes.Num(); ++i)
+    {
+        const TSharedRef<IPlugin>& Plugin = Plugins[i];
+        const FPluginDescriptor& Desc = Plugin->GetDescriptor();
+        for (const FPluginReferenceDescriptor& Ref : Desc.Plugins)
+        {
+            if (Ref.bEnabled)
+            {
+                if (int32* DepIdx = NameToIndex.Find(Ref.Name))
+                {
+                    OutNodes[i].Links.AddUnique(*DepIdx);
+                    OutNodes[*DepIdx].Links.AddUnique(i); // undirected for layout
+
+                    // Store directed dependency
+                    OutNodes[i].Dependencies.AddUnique(*DepIdx);
+                    OutNodes[*DepIdx].Dependents.AddUnique(i);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,90 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassGraphExporter.h"
+#include "Analysis/NsSpyglassContentRollup.h"
+#include "Graph/NsSpyglassCycleDetector.h"
+#include "Misc/FileHelper.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+
+FString FNsSpyglassGraphExporter::ToJson(const TArray<FPluginNode>& Nodes, const FNsSpyglassCycleInfo& CycleInfo, const FNsSpyglassContentResult* Content)
+{
+    FString Output;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Output);
+
+    Writer->WriteObjectStart();
+
+    Writer->WriteArrayStart(TEXT("nodes"));
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        const FPluginNode& Node = Nodes[i];
+        Writer->WriteObjectStart();
+        Writer->WriteValue(TEXT("name"), Node.Name);
+        Writer->WriteValue(TEXT("engine"), Node.bIsEngine);
+        Writer->WriteValue(TEXT("cycle"), CycleInfo.GetCycle(i));
+        Writer->WriteObjectEnd();
+    }
+    Writer->WriteArrayEnd();
+
+    Writer->WriteArrayStart(TEXT("edges"));
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        for (int32 Dep : Nodes[i].Dependencies)
+        {
+            if (!Nodes.IsValidIndex(Dep))
+            {
+                continue;
+            }
+
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("from"), Nodes[i].Name);
+            Writer->WriteValue(TEXT("to"), Nodes[Dep].Name);
+            Writer->WriteValue(TEXT("cyclic"), CycleInfo.IsCyclicEdge(i, Dep));
+            Writer->WriteObjectEnd();
+        }
+    }
+    Writer->WriteArrayEnd();
+
+    Writer->WriteArrayStart(TEXT("cycles"));
+    for (const TArray<int32>& Cycle : CycleInfo.Cycles)
+    {
+        Writer->WriteArrayStart();
+        for (int32 Member : Cycle)
+        {
+            Writer->WriteValue(Nodes[Member].Name);
+        }
+        Writer->WriteArrayEnd();
+    }
+    Writer->WriteArrayEnd();
+
+    if (Content)
+    {
+        Writer->WriteArrayStart(TEXT("contentEdges"));
+        for (const FNsSpyglassContentEdge& Edge : Content->Edges)
+        {
+            if (!Nodes.IsValidIndex(Edge.From) || !Nodes.IsValidIndex(Edge.To))
+            {
+                continue;
+            }
+
+            Writer->WriteObjectStart();
+            Writer->WriteValue(TEXT("from"), Nodes[Edge.From].Name);
+            Writer->WriteValue(TEXT("to"), Nodes[Edge.To].Name);
+            Writer->WriteValue(TEXT("hard"), Edge.HardReferences);
+            Writer->WriteValue(TEXT("soft"), Edge.SoftReferences);
+            Writer->WriteValue(TEXT("declared"), Edge.bDeclared);
+            Writer->WriteObjectEnd();
+        }
+        Writer->WriteArrayEnd();
+    }
+
+    Writer->WriteObjectEnd();
+    Writer->Close();
+
+    return Output;
+}
+
+bool FNsSpyglassGraphExporter::SaveJson(const FString& FilePath, const TArray<FPluginNode>& Nodes, const FNsSpyglassCycleInfo& CycleInfo, const FNsSpyglassContentResult* Content)
+{
+    return FFileHelper::SaveStringToFile(ToJson(Nodes, CycleInfo, Content), *FilePath);
+}
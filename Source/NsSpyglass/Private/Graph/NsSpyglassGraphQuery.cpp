@@ -0,0 +1,326 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassGraphQuery.h"
+#include "Algo/Reverse.h"
+#include "Editor.h"
+#include "Graph/NsSpyglassGraphBuilder.h"
+#include "Graph/NsSpyglassGraphSubsystem.h"
+
+namespace
+{
+    /** Shared query over the enabled plugins. */
+    TSharedPtr<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> LiveQuery;
+
+    /** Number of enabled plugins LiveQuery was built for. */
+    int32 LiveQueryPluginCount = INDEX_NONE;
+}
+
+FNsSpyglassGraphQuery::FNsSpyglassGraphQuery(const TArray<FPluginNode>& Nodes)
+{
+    const int32 Num = Nodes.Num();
+
+    Names.Reserve(Num);
+    NameToNode.Reserve(Num);
+    for (int32 i = 0; i < Num; ++i)
+    {
+        Names.Add(Nodes[i].Name);
+        NameToNode.Add(Nodes[i].Name, i);
+    }
+
+    // Flatten both directions so traversals walk contiguous memory
+    DependencyOffsets.Reserve(Num + 1);
+    DependentOffsets.Reserve(Num + 1);
+    DependencyOffsets.Add(0);
+    DependentOffsets.Add(0);
+    for (const FPluginNode& Node : Nodes)
+    {
+        for (int32 Dep : Node.Dependencies)
+        {
+            if (Nodes.IsValidIndex(Dep))
+            {
+                DependencyColumns.Add(Dep);
+            }
+        }
+        DependencyOffsets.Add(DependencyColumns.Num());
+
+        for (int32 Dependent : Node.Dependents)
+        {
+            if (Nodes.IsValidIndex(Dependent))
+            {
+                DependentColumns.Add(Dependent);
+            }
+        }
+        DependentOffsets.Add(DependentColumns.Num());
+    }
+
+    FNsSpyglassReachability::Compute(Nodes, Reachability);
+
+    // Component ids are in reverse topological order, so ascending ids put dependencies first
+    TopologicalOrder.Reserve(Num);
+    for (int32 i = 0; i < Num; ++i)
+    {
+        TopologicalOrder.Add(i);
+    }
+    const TArray<int32>& ComponentOf = Reachability.Components.ComponentOf;
+    TopologicalOrder.StableSort([&ComponentOf](const int32 A, const int32 B)
+    {
+        return ComponentOf[A] < ComponentOf[B];
+    });
+}
+
+int32 FNsSpyglassGraphQuery::FindNode(const FString& Name) const
+{
+    const int32* Node = NameToNode.Find(Name);
+    return Node ? *Node : INDEX_NONE;
+}
+
+bool FNsSpyglassGraphQuery::FindShortestPath(const int32 From, const int32 To, TArray<int32>& OutPath) const
+{
+    OutPath.Reset();
+    if (!Names.IsValidIndex(From) || !Names.IsValidIndex(To) || From == To || !DependsOn(From, To))
+    {
+        return false;
+    }
+
+    // Breadth first, only expanding nodes that can still reach the target
+    TArray<int32> Parent;
+    Parent.Init(INDEX_NONE, Names.Num());
+    Parent[From] = From;
+
+    TArray<int32> Queue;
+    Queue.Add(From);
+    for (int32 Head = 0; Head < Queue.Num(); ++Head)
+    {
+        const int32 Current = Queue[Head];
+        for (int32 Dep : GetRow(DependencyOffsets, DependencyColumns, Current))
+        {
+            if (Parent[Dep] != INDEX_NONE || (Dep != To && !DependsOn(Dep, To)))
+            {
+                continue;
+            }
+
+            Parent[Dep] = Current;
+            if (Dep == To)
+            {
+                for (int32 Node = To; Node != From; Node = Parent[Node])
+                {
+                    OutPath.Add(Node);
+                }
+                OutPath.Add(From);
+                Algo::Reverse(OutPath);
+                return true;
+            }
+            Queue.Add(Dep);
+        }
+    }
+
+    return false;
+}
+
+int32 FNsSpyglassGraphQuery::FindAllPaths(const int32 From, const int32 To, const int32 MaxPaths, TArray<TArray<int32>>& OutPaths, const int32 MaxVisits) const
+{
+    OutPaths.Reset();
+    if (MaxPaths <= 0 || !Names.IsValidIndex(From) || !Names.IsValidIndex(To) || From == To || !DependsOn(From, To))
+    {
+        return 0;
+    }
+
+    // Hops from every node to To, by a breadth first search over dependents. Unreached nodes cannot lead to To
+    TArray<int32> Distance;
+    Distance.Init(INDEX_NONE, Names.Num());
+    TArray<int32> Queue;
+    Queue.Add(To);
+    Distance[To] = 0;
+    for (int32 Head = 0; Head < Queue.Num(); ++Head)
+    {
+        const int32 Node = Queue[Head];
+        for (const int32 Dependent : GetRow(DependentOffsets, DependentColumns, Node))
+        {
+            if (Distance[Dependent] == INDEX_NONE)
+            {
+                Distance[Dependent] = Distance[Node] + 1;
+                Queue.Add(Dependent);
+            }
+        }
+    }
+
+    // Iterative depth first search over simple paths of exactly Length edges, for growing lengths. A node is only
+    // entered when To is still within reach of the length, so every pass stays close to the chains it finds
+    struct FFrame
+    {
+        int32 Node;
+        int32 NextEdge;
+    };
+
+    TBitArray<> OnPath(false, Names.Num());
+    TArray<FFrame> Stack;
+    TArray<int32> Path;
+    int32 Visits = 0;
+
+    for (int32 Length = Distance[From]; Length < Names.Num() && OutPaths.Num() < MaxPaths && Visits < MaxVisits; ++Length)
+    {
+        // A pass that cut nothing for its length explored every simple chain, so no longer ones exist
+        bool bCutByLength = false;
+
+        Stack.Add({From, DependencyOffsets[From]});
+        Path.Add(From);
+        OnPath[From] = true;
+
+        while (Stack.Num() > 0)
+        {
+            FFrame& Frame = Stack.Last();
+            if (Frame.NextEdge == DependencyOffsets[Frame.Node + 1] || OutPaths.Num() >= MaxPaths || Visits >= MaxVisits)
+            {
+                OnPath[Frame.Node] = false;
+                Path.Pop();
+                Stack.Pop();
+                continue;
+            }
+
+            const int32 Dep = DependencyColumns[Frame.NextEdge++];
+            if (OnPath[Dep] || Distance[Dep] == INDEX_NONE)
+            {
+                continue;
+            }
+
+            // Edges of the chain once Dep is appended
+            const int32 Depth = Path.Num();
+            if (Depth + Distance[Dep] > Length)
+            {
+                bCutByLength = true;
+                continue;
+            }
+
+            // Shorter chains were reported by an earlier pass
+            if (Dep == To)
+            {
+                if (Depth == Length)
+                {
+                    TArray<int32>& Found = OutPaths.Add_GetRef(Path);
+                    Found.Add(To);
+                }
+                continue;
+            }
+
+            ++Visits;
+            OnPath[Dep] = true;
+            Path.Add(Dep);
+            Stack.Add({Dep, DependencyOffsets[Dep]});
+        }
+
+        if (!bCutByLength)
+        {
+            break;
+        }
+    }
+
+    return OutPaths.Num();
+}
+
+void FNsSpyglassGraphQuery::GetNeighbourhood(const int32 Node, const int32 K, const ENsSpyglassQueryDirection Direction, TArray<int32>& OutNodes, TArray<int32>* OutDistances) const
+{
+    OutNodes.Reset();
+    if (OutDistances)
+    {
+        OutDistances->Reset();
+    }
+
+    if (!Names.IsValidIndex(Node) || K <= 0)
+    {
+        return;
+    }
+
+    const bool bDown = Direction != ENsSpyglassQueryDirection::Up;
+    const bool bUp = Direction != ENsSpyglassQueryDirection::Down;
+
+    TBitArray<> Visited(false, Names.Num());
+    Visited[Node] = true;
+
+    // OutNodes doubles as the queue, each ring is appended after the previous one
+    int32 Distance = 1;
+    const auto Expand = [&](const int32 Current)
+    {
+        const auto Visit = [&](const TConstArrayView<int32> Row)
+        {
+            for (int32 Next : Row)
+            {
+                if (!Visited[Next])
+                {
+                    Visited[Next] = true;
+                    OutNodes.Add(Next);
+                    if (OutDistances)
+                    {
+                        OutDistances->Add(Distance);
+                    }
+                }
+            }
+        };
+
+        if (bDown)
+        {
+            Visit(GetRow(DependencyOffsets, DependencyColumns, Current));
+        }
+        if (bUp)
+        {
+            Visit(GetRow(DependentOffsets, DependentColumns, Current));
+        }
+    };
+
+    Expand(Node);
+
+    int32 RingEnd = 0;
+    for (Distance = 2; Distance <= K; ++Distance)
+    {
+        const int32 RingStart = RingEnd;
+        RingEnd = OutNodes.Num();
+        if (RingStart == RingEnd)
+        {
+            break;
+        }
+
+        for (int32 i = RingStart; i < RingEnd; ++i)
+        {
+            Expand(OutNodes[i]);
+        }
+    }
+}
+
+void FNsSpyglassGraphQuery::GetTransitiveDependents(const int32 Node, TArray<int32>& OutNodes) const
+{
+    GetNeighbourhood(Node, MAX_int32, ENsSpyglassQueryDirection::Up, OutNodes);
+}
+
+TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> FNsSpyglassGraphQuery::GetLive()
+{
+    // The editor keeps one shared build, commandlets and callers during a build fall back to their own
+    if (GEditor)
+    {
+        if (const UNsSpyglassGraphSubsystem* Graph = GEditor->GetEditorSubsystem<UNsSpyglassGraphSubsystem>())
+        {
+            const FNsSpyglassGraphModelRef Model = Graph->GetModel();
+            if (Model->bComplete)
+            {
+                return Model->Query.ToSharedRef();
+            }
+        }
+    }
+
+    check(IsInGameThread());
+
+    const int32 PluginCount = IPluginManager::Get().GetEnabledPlugins().Num();
+    if (!LiveQuery.IsValid() || LiveQueryPluginCount != PluginCount)
+    {
+        TArray<FPluginNode> Nodes;
+        FNsSpyglassGraphBuilder::BuildPluginNodes(Nodes);
+        LiveQuery = MakeShared<FNsSpyglassGraphQuery, ESPMode::ThreadSafe>(Nodes);
+        LiveQueryPluginCount = PluginCount;
+    }
+
+    return LiveQuery.ToSharedRef();
+}
+
+void FNsSpyglassGraphQuery::InvalidateLive()
+{
+    LiveQuery.Reset();
+    LiveQueryPluginCount = INDEX_NONE;
+}
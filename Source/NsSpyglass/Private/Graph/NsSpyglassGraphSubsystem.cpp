@@ -0,0 +1,369 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassGraphSubsystem.h"
+#include "Analysis/NsSpyglassContentRollup.h"
+#include "Analysis/NsSpyglassFrameAllocations.h"
+#include "Async/Async.h"
+#include "Editor.h"
+#include "Graph/NsSpyglassForceLayout.h"
+#include "Graph/NsSpyglassGraphBuilder.h"
+#include "Graph/NsSpyglassOverlapRemoval.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/ScopeRWLock.h"
+#include "Settings/NsSpyglassSettings.h"
+
+/** Nodes slower than this, in graph units per second, count as still. */
+static constexpr float SettleSpeed = 2.f;
+
+/** Seconds every node must stay still before the simulation settles. */
+static constexpr float SettleSeconds = 0.5f;
+
+/** Nodes in the first batch of a build. Every following batch doubles the count. */
+static constexpr int32 FirstBatchSize = 32;
+
+/** Radius of the ring unconnected nodes start on, and distance of a new node from its placed neighbour. */
+static constexpr float StartRadius = 200.f;
+static constexpr float NeighbourSpread = 60.f;
+
+/** Reorder the nodes by descending link count and remap every index to the new order. */
+static void SortByDegree(TArray<FPluginNode>& Nodes)
+{
+    TArray<int32> Order;
+    Order.Reserve(Nodes.Num());
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        Order.Add(i);
+    }
+    Order.StableSort([&Nodes](const int32 A, const int32 B)
+    {
+        return Nodes[A].Links.Num() > Nodes[B].Links.Num();
+    });
+
+    TArray<int32> NewIndex;
+    NewIndex.SetNumUninitialized(Nodes.Num());
+    for (int32 k = 0; k < Order.Num(); ++k)
+    {
+        NewIndex[Order[k]] = k;
+    }
+
+    TArray<FPluginNode> Sorted;
+    Sorted.Reserve(Nodes.Num());
+    for (const int32 Old : Order)
+    {
+        FPluginNode& Node = Sorted.Add_GetRef(MoveTemp(Nodes[Old]));
+        for (TArray<int32>* Indices : { &Node.Links, &Node.Dependencies, &Node.Dependents })
+        {
+            for (int32& Index : *Indices)
+            {
+                Index = NewIndex[Index];
+            }
+        }
+    }
+    Nodes = MoveTemp(Sorted);
+}
+
+/** Model of the first Count nodes and the edges between them. */
+static TSharedRef<FNsSpyglassGraphModel, ESPMode::ThreadSafe> MakeBatch(const TArray<FPluginNode>& Nodes, const int32 Count)
+{
+    TSharedRef<FNsSpyglassGraphModel, ESPMode::ThreadSafe> Batch = MakeShared<FNsSpyglassGraphModel, ESPMode::ThreadSafe>();
+    const auto IsLater = [Count](const int32 Index) { return Index >= Count; };
+
+    Batch->Nodes.Reserve(Count);
+    for (int32 i = 0; i < Count; ++i)
+    {
+        FPluginNode& Node = Batch->Nodes.Add_GetRef(Nodes[i]);
+        Node.Links.RemoveAll(IsLater);
+        Node.Dependencies.RemoveAll(IsLater);
+        Node.Dependents.RemoveAll(IsLater);
+    }
+
+    // Cycles only change when the nodes do, so detect them once per batch
+    FNsSpyglassCycleDetector::Compute(Batch->Nodes, Batch->CycleInfo);
+    Batch->PluginSetHash = FNsSpyglassContentRollup::ComputePluginSetHash(Batch->Nodes);
+    Batch->Query = MakeShared<FNsSpyglassGraphQuery, ESPMode::ThreadSafe>(Batch->Nodes);
+    Batch->bComplete = Count == Nodes.Num();
+    return Batch;
+}
+
+UNsSpyglassGraphSubsystem& UNsSpyglassGraphSubsystem::Get()
+{
+    check(GEditor);
+    UNsSpyglassGraphSubsystem* Subsystem = GEditor->GetEditorSubsystem<UNsSpyglassGraphSubsystem>();
+    check(Subsystem);
+    return *Subsystem;
+}
+
+void UNsSpyglassGraphSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Readers always find a model, an empty one until the first batch arrives
+    TSharedRef<FNsSpyglassGraphModel, ESPMode::ThreadSafe> EmptyModel = MakeShared<FNsSpyglassGraphModel, ESPMode::ThreadSafe>();
+    EmptyModel->Query = MakeShared<FNsSpyglassGraphQuery, ESPMode::ThreadSafe>(EmptyModel->Nodes);
+    EmptyModel->Version = NextVersion++;
+    {
+        FWriteScopeLock Lock(SnapshotLock);
+        Model = EmptyModel;
+    }
+    PublishLayout();
+
+    Rebuild();
+}
+
+void UNsSpyglassGraphSubsystem::Deinitialize()
+{
+    {
+        FWriteScopeLock Lock(SnapshotLock);
+        Model.Reset();
+        Layout.Reset();
+    }
+    Batches.Empty();
+    ++BuildGeneration;
+    SpareLayout.Reset();
+    SimNodes.Empty();
+    NumViewers = 0;
+    NumPinned = 0;
+
+    Super::Deinitialize();
+}
+
+FNsSpyglassGraphModelRef UNsSpyglassGraphSubsystem::GetModel() const
+{
+    FReadScopeLock Lock(SnapshotLock);
+    return Model.ToSharedRef();
+}
+
+FNsSpyglassGraphLayoutRef UNsSpyglassGraphSubsystem::GetLayout() const
+{
+    FReadScopeLock Lock(SnapshotLock);
+    return Layout.ToSharedRef();
+}
+
+void UNsSpyglassGraphSubsystem::Rebuild()
+{
+    check(IsInGameThread());
+
+    // Batches of a build still in flight are dropped once this one starts
+    const uint32 BuildId = ++BuildGeneration;
+    TArray<TSharedRef<IPlugin>> Plugins = IPluginManager::Get().GetEnabledPlugins();
+
+    TWeakObjectPtr<UNsSpyglassGraphSubsystem> WeakThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, BuildId, Plugins = MoveTemp(Plugins)]()
+    {
+        TArray<FPluginNode> Nodes;
+        FNsSpyglassGraphBuilder::BuildPluginNodes(Plugins, Nodes);
+
+        // The most connected plugins arrive first and anchor the layout for the ones that follow
+        SortByDegree(Nodes);
+
+        int32 Count = FMath::Min(FirstBatchSize, Nodes.Num());
+        while (true)
+        {
+            TSharedRef<FNsSpyglassGraphModel, ESPMode::ThreadSafe> Batch = MakeBatch(Nodes, Count);
+            Batch->BuildId = BuildId;
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Batch]()
+            {
+                UNsSpyglassGraphSubsystem* This = WeakThis.Get();
+                if (This && This->BuildGeneration == Batch->BuildId)
+                {
+                    This->PublishBatch(Batch);
+                }
+            });
+
+            if (Batch->bComplete)
+            {
+                break;
+            }
+            Count = FMath::Min(Count * 2, Nodes.Num());
+        }
+    });
+}
+
+bool UNsSpyglassGraphSubsystem::IsBuilding() const
+{
+    return !GetModel()->bComplete;
+}
+
+FNsSpyglassGraphModelRef UNsSpyglassGraphSubsystem::GetNextBatch(const uint32 BuildId, const int32 NumNodes) const
+{
+    check(IsInGameThread());
+
+    if (Batches.Num() > 0 && Batches[0]->BuildId != BuildId)
+    {
+        return Batches[0];
+    }
+    for (const FNsSpyglassGraphModelRef& Batch : Batches)
+    {
+        if (Batch->Nodes.Num() > NumNodes)
+        {
+            return Batch;
+        }
+    }
+    return Model.ToSharedRef();
+}
+
+void UNsSpyglassGraphSubsystem::PublishBatch(const TSharedRef<FNsSpyglassGraphModel, ESPMode::ThreadSafe>& NewModel)
+{
+    // A later batch of the same build keeps every node placed so far where the simulation moved it
+    const bool bContinues = Model->BuildId == NewModel->BuildId;
+    const int32 NumPlaced = bContinues ? SimNodes.Num() : 0;
+    if (bContinues && NewModel->Nodes.Num() <= NumPlaced)
+    {
+        return;
+    }
+
+    TArray<FPluginNode>& Nodes = NewModel->Nodes;
+    for (int32 i = 0; i < NumPlaced; ++i)
+    {
+        Nodes[i].Position = SimNodes[i].Position;
+        Nodes[i].Velocity = SimNodes[i].Velocity;
+        Nodes[i].bFixed = SimNodes[i].bFixed;
+    }
+
+    // New nodes start next to a neighbour that is already placed, or on a ring around the origin
+    const float GoldenAngle = PI * (3.f - FMath::Sqrt(5.f));
+    for (int32 i = NumPlaced; i < Nodes.Num(); ++i)
+    {
+        const float Angle = GoldenAngle * static_cast<float>(i);
+        const FVector2D Direction(FMath::Cos(Angle), FMath::Sin(Angle));
+        const int32* Anchor = Nodes[i].Links.FindByPredicate([i](const int32 Link) { return Link < i; });
+        Nodes[i].Position = Anchor ? Nodes[*Anchor].Position + Direction * NeighbourSpread : Direction * StartRadius;
+    }
+
+    NewModel->Version = NextVersion++;
+
+    SimNodes = Nodes;
+    SimOrder.Reset(Nodes.Num());
+    NumPinned = 0;
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        SimOrder.Add(i);
+        NumPinned += Nodes[i].bFixed ? 1 : 0;
+    }
+    SimMask.Init(true, Nodes.Num());
+    bSettled = false;
+    SettleTime = 0.f;
+
+    if (!bContinues)
+    {
+        Batches.Reset();
+    }
+    Batches.Add(NewModel);
+
+    {
+        FWriteScopeLock Lock(SnapshotLock);
+        Model = NewModel;
+    }
+    PublishLayout();
+
+    ModelChanged.Broadcast();
+}
+
+void UNsSpyglassGraphSubsystem::AddViewer()
+{
+    ++NumViewers;
+}
+
+void UNsSpyglassGraphSubsystem::RemoveViewer()
+{
+    NumViewers = FMath::Max(0, NumViewers - 1);
+}
+
+void UNsSpyglassGraphSubsystem::SetNodePinned(const int32 NodeIndex, const FVector2D& Position, const bool bPinned)
+{
+    if (!SimNodes.IsValidIndex(NodeIndex))
+    {
+        return;
+    }
+
+    FPluginNode& Node = SimNodes[NodeIndex];
+    if (Node.bFixed != bPinned)
+    {
+        NumPinned += bPinned ? 1 : -1;
+    }
+    Node.Position = Position;
+    Node.Velocity = FVector2D::ZeroVector;
+    Node.bFixed = bPinned;
+    bSettled = false;
+    SettleTime = 0.f;
+}
+
+void UNsSpyglassGraphSubsystem::RemoveOverlaps()
+{
+    if (!Model.IsValid())
+    {
+        return;
+    }
+
+    FNsSpyglassOverlapRemoval::Resolve(SimNodes, SimOrder, INDEX_NONE);
+    PublishLayout();
+}
+
+void UNsSpyglassGraphSubsystem::Tick(const float DeltaTime)
+{
+    FNsSpyglassFrameAllocations::FCountScope CountAllocations;
+    const UNsSpyglassSettings* Settings = UNsSpyglassSettings::GetSettings();
+
+    FNsSpyglassForceParams Params;
+    Params.Repulsion = Settings->Repulsion * 100.f;
+    Params.Gravity = Settings->CenterForce;
+    Params.EdgeStrength = Settings->AttractionScale;
+    Params.SimSpeed = NumPinned > 0 ? 60.f : 40.f;
+
+    // A settled layout costs nothing until a drag, a rebuild or new forces disturb it
+    const bool bParamsChanged = Params.Repulsion != LastParams.Repulsion || Params.Gravity != LastParams.Gravity || Params.EdgeStrength != LastParams.EdgeStrength;
+    LastParams = Params;
+    if (bSettled && !bParamsChanged)
+    {
+        return;
+    }
+    bSettled = false;
+
+    const float Delta = FMath::Min(DeltaTime, 0.05f);
+    FNsSpyglassForceLayout::Step(SimNodes, SimOrder, SimMask, INDEX_NONE, Params, Delta);
+
+    float MaxSpeedSqr = 0.f;
+    for (const FPluginNode& Node : SimNodes)
+    {
+        MaxSpeedSqr = FMath::Max(MaxSpeedSqr, Node.Velocity.SizeSquared());
+    }
+    SettleTime = MaxSpeedSqr < FMath::Square(SettleSpeed) ? SettleTime + Delta : 0.f;
+
+    if (SettleTime >= SettleSeconds && NumPinned == 0)
+    {
+        FNsSpyglassOverlapRemoval::Resolve(SimNodes, SimOrder, INDEX_NONE);
+        for (FPluginNode& Node : SimNodes)
+        {
+            Node.Velocity = FVector2D::ZeroVector;
+        }
+        bSettled = true;
+    }
+
+    PublishLayout();
+}
+
+TStatId UNsSpyglassGraphSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UNsSpyglassGraphSubsystem, STATGROUP_Tickables);
+}
+
+void UNsSpyglassGraphSubsystem::PublishLayout()
+{
+    // A reader may still hold the previous layout, only write into it once nobody else does
+    TSharedPtr<FNsSpyglassGraphLayout, ESPMode::ThreadSafe> Next = MoveTemp(SpareLayout);
+    if (!Next.IsValid() || !Next.IsUnique())
+    {
+        Next = MakeShared<FNsSpyglassGraphLayout, ESPMode::ThreadSafe>();
+    }
+
+    Next->Positions.SetNumUninitialized(SimNodes.Num());
+    for (int32 i = 0; i < SimNodes.Num(); ++i)
+    {
+        Next->Positions[i] = SimNodes[i].Position;
+    }
+    Next->ModelVersion = Model->Version;
+
+    FWriteScopeLock Lock(SnapshotLock);
+    SpareLayout = MoveTemp(Layout);
+    Layout = MoveTemp(Next);
+}
@@ -0,0 +1,251 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassLayeredLayout.h"
+
+namespace
+{
+    /** Vertical distance between layers. */
+    constexpr float LayerSpacing = 140.f;
+
+    /** Horizontal room taken by a plugin and by a dummy vertex. */
+    constexpr float NodeWidth = 110.f;
+    constexpr float DummyWidth = 20.f;
+
+    /** Barycenter sweeps, alternating down and up. */
+    constexpr int32 NumOrderSweeps = 8;
+
+    /** Coordinate passes, alternating down and up. */
+    constexpr int32 NumCoordinatePasses = 6;
+}
+
+void FNsSpyglassLayeredLayout::Compute(const TArray<FPluginNode>& Nodes, const TArray<int32>& Subset, TArray<FVector2D>& OutPositions)
+{
+    OutPositions.SetNumZeroed(Nodes.Num());
+
+    const int32 Num = Subset.Num();
+    if (Num == 0)
+    {
+        return;
+    }
+
+    TArray<int32> LocalOf;
+    LocalOf.Init(INDEX_NONE, Nodes.Num());
+    for (int32 i = 0; i < Num; ++i)
+    {
+        LocalOf[Subset[i]] = i;
+    }
+
+    // --- Cycle breaking: iterative DFS over dependencies, edges back onto the stack are dropped ---
+    TArray<TArray<int32>> Dependencies;
+    Dependencies.SetNum(Num);
+
+    TArray<uint8> State;
+    State.Init(0, Num);
+
+    TArray<int32> PostOrder;
+    PostOrder.Reserve(Num);
+
+    TArray<TPair<int32, int32>> Stack;
+    for (int32 Root = 0; Root < Num; ++Root)
+    {
+        if (State[Root] != 0)
+        {
+            continue;
+        }
+
+        State[Root] = 1;
+        Stack.Emplace(Root, 0);
+        while (Stack.Num() > 0)
+        {
+            const int32 Node = Stack.Last().Key;
+            const TArray<int32>& Links = Nodes[Subset[Node]].Dependencies;
+            if (Stack.Last().Value >= Links.Num())
+            {
+                State[Node] = 2;
+                PostOrder.Add(Node);
+                Stack.Pop();
+                continue;
+            }
+
+            const int32 Link = Links[Stack.Last().Value++];
+            const int32 Dep = Nodes.IsValidIndex(Link) ? LocalOf[Link] : INDEX_NONE;
+            if (Dep == INDEX_NONE || Dep == Node || State[Dep] == 1)
+            {
+                continue;
+            }
+
+            Dependencies[Node].AddUnique(Dep);
+            if (State[Dep] == 0)
+            {
+                State[Dep] = 1;
+                Stack.Emplace(Dep, 0);
+            }
+        }
+    }
+
+    // --- Layer assignment: longest path, the post order visits dependencies first ---
+    TArray<int32> VertexLayer;
+    VertexLayer.Init(0, Num);
+    int32 NumLayers = 1;
+    for (int32 Node : PostOrder)
+    {
+        for (int32 Dep : Dependencies[Node])
+        {
+            VertexLayer[Node] = FMath::Max(VertexLayer[Node], VertexLayer[Dep] + 1);
+        }
+        NumLayers = FMath::Max(NumLayers, VertexLayer[Node] + 1);
+    }
+
+    // --- Dummy vertices so every edge connects adjacent layers ---
+    TArray<TArray<int32>> Above;
+    TArray<TArray<int32>> Below;
+    Above.SetNum(Num);
+    Below.SetNum(Num);
+    for (int32 Node : PostOrder)
+    {
+        for (int32 Dep : Dependencies[Node])
+        {
+            int32 Prev = Dep;
+            for (int32 Layer = VertexLayer[Dep] + 1; Layer < VertexLayer[Node]; ++Layer)
+            {
+                const int32 Dummy = VertexLayer.Add(Layer);
+                Above.AddDefaulted();
+                Below.AddDefaulted();
+                Above[Dummy].Add(Prev);
+                Below[Prev].Add(Dummy);
+                Prev = Dummy;
+            }
+            Above[Node].Add(Prev);
+            Below[Prev].Add(Node);
+        }
+    }
+
+    const int32 NumVertices = VertexLayer.Num();
+
+    TArray<TArray<int32>> Layers;
+    Layers.SetNum(NumLayers);
+    for (int32 Node : PostOrder)
+    {
+        Layers[VertexLayer[Node]].Add(Node);
+    }
+    for (int32 Vertex = Num; Vertex < NumVertices; ++Vertex)
+    {
+        Layers[VertexLayer[Vertex]].Add(Vertex);
+    }
+
+    TArray<float> Order;
+    Order.SetNumUninitialized(NumVertices);
+    for (const TArray<int32>& Row : Layers)
+    {
+        for (int32 i = 0; i < Row.Num(); ++i)
+        {
+            Order[Row[i]] = static_cast<float>(i);
+        }
+    }
+
+    // --- Crossing minimisation: sort every layer by the mean position of its neighbours in the previous one ---
+    TArray<float> Barycenter;
+    Barycenter.SetNumUninitialized(NumVertices);
+    const auto SortLayer = [&](TArray<int32>& Row, const TArray<TArray<int32>>& Neighbours)
+    {
+        for (int32 Vertex : Row)
+        {
+            const TArray<int32>& Adjacent = Neighbours[Vertex];
+            float Sum = 0.f;
+            for (int32 Other : Adjacent)
+            {
+                Sum += Order[Other];
+            }
+            Barycenter[Vertex] = Adjacent.Num() > 0 ? Sum / static_cast<float>(Adjacent.Num()) : Order[Vertex];
+        }
+
+        Row.StableSort([&Barycenter](const int32 A, const int32 B) { return Barycenter[A] < Barycenter[B]; });
+        for (int32 i = 0; i < Row.Num(); ++i)
+        {
+            Order[Row[i]] = static_cast<float>(i);
+        }
+    };
+
+    for (int32 Sweep = 0; Sweep < NumOrderSweeps; ++Sweep)
+    {
+        if (Sweep % 2 == 0)
+        {
+            for (int32 Layer = 1; Layer < NumLayers; ++Layer)
+            {
+                SortLayer(Layers[Layer], Above);
+            }
+        }
+        else
+        {
+            for (int32 Layer = NumLayers - 2; Layer >= 0; --Layer)
+            {
+                SortLayer(Layers[Layer], Below);
+            }
+        }
+    }
+
+    // --- Coordinate assignment: pull toward neighbours, then resolve overlaps from both sides ---
+    const auto Width = [Num](const int32 Vertex) { return Vertex < Num ? NodeWidth : DummyWidth; };
+
+    TArray<float> X;
+    X.SetNumUninitialized(NumVertices);
+    for (const TArray<int32>& Row : Layers)
+    {
+        float Cursor = 0.f;
+        for (int32 i = 0; i < Row.Num(); ++i)
+        {
+            Cursor += i > 0 ? (Width(Row[i - 1]) + Width(Row[i])) * 0.5f : 0.f;
+            X[Row[i]] = Cursor;
+        }
+    }
+
+    TArray<float> Desired;
+    TArray<float> Forward;
+    for (int32 Pass = 0; Pass < NumCoordinatePasses; ++Pass)
+    {
+        const bool bDown = Pass % 2 == 0;
+        const TArray<TArray<int32>>& Neighbours = bDown ? Above : Below;
+        for (int32 Step = 0; Step < NumLayers; ++Step)
+        {
+            const TArray<int32>& Row = Layers[bDown ? Step : NumLayers - 1 - Step];
+            const int32 Count = Row.Num();
+
+            Desired.SetNumUninitialized(Count);
+            for (int32 i = 0; i < Count; ++i)
+            {
+                const TArray<int32>& Adjacent = Neighbours[Row[i]];
+                float Sum = 0.f;
+                for (int32 Other : Adjacent)
+                {
+                    Sum += X[Other];
+                }
+                Desired[i] = Adjacent.Num() > 0 ? Sum / static_cast<float>(Adjacent.Num()) : X[Row[i]];
+            }
+
+            // Both sweeps keep the spacing, so does their average
+            Forward.SetNumUninitialized(Count);
+            for (int32 i = 0; i < Count; ++i)
+            {
+                Forward[i] = i > 0 ? FMath::Max(Desired[i], Forward[i - 1] + (Width(Row[i - 1]) + Width(Row[i])) * 0.5f) : Desired[i];
+            }
+            float Backward = 0.f;
+            for (int32 i = Count - 1; i >= 0; --i)
+            {
+                Backward = i < Count - 1 ? FMath::Min(Desired[i], Backward - (Width(Row[i]) + Width(Row[i + 1])) * 0.5f) : Desired[i];
+                X[Row[i]] = (Forward[i] + Backward) * 0.5f;
+            }
+        }
+    }
+
+    float MeanX = 0.f;
+    for (int32 Node = 0; Node < Num; ++Node)
+    {
+        MeanX += X[Node] / static_cast<float>(Num);
+    }
+
+    const float HalfHeight = static_cast<float>(NumLayers - 1) * 0.5f;
+    for (int32 Node = 0; Node < Num; ++Node)
+    {
+        OutPositions[Subset[Node]] = FVector2D(X[Node] - MeanX, (static_cast<float>(VertexLayer[Node]) - HalfHeight) * LayerSpacing);
+    }
+}
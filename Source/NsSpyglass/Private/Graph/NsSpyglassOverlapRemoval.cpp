@@ -0,0 +1,105 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassOverlapRemoval.h"
+
+namespace
+{
+    /** Size of a node circle in graph space, matching the graph view. */
+    constexpr float NodeSize = 40.f;
+
+    /** Gap kept between separated boxes. */
+    constexpr float Margin = 6.f;
+
+    /** Distance two box centers need on one axis to not overlap. */
+    constexpr float MinSpacing = NodeSize + 2.f * Margin;
+
+    /** Grid cell of a position. */
+    FIntPoint CellOf(const FVector2D& Position, const float CellSize)
+    {
+        return FIntPoint(FMath::FloorToInt(Position.X / CellSize), FMath::FloorToInt(Position.Y / CellSize));
+    }
+}
+
+int32 FNsSpyglassOverlapRemoval::Resolve(TArray<FPluginNode>& Nodes, const TConstArrayView<int32> Subset, const int32 RootIndex, const int32 MaxIterations)
+{
+    // Two boxes can only overlap when their centers are less than one cell apart on both axes
+    const float CellSize = MinSpacing;
+
+    TMap<FIntPoint, TArray<int32>> Grid;
+    TArray<FVector2D> Push;
+    Push.SetNumZeroed(Nodes.Num());
+
+    int32 Overlaps = 0;
+    for (int32 Iteration = 0; Iteration < MaxIterations; ++Iteration)
+    {
+        for (TPair<FIntPoint, TArray<int32>>& Cell : Grid)
+        {
+            Cell.Value.Reset();
+        }
+        for (int32 i : Subset)
+        {
+            Grid.FindOrAdd(CellOf(Nodes[i].Position, CellSize)).Add(i);
+            Push[i] = FVector2D::ZeroVector;
+        }
+
+        Overlaps = 0;
+        for (int32 i : Subset)
+        {
+            const FIntPoint Cell = CellOf(Nodes[i].Position, CellSize);
+            const bool bMovableI = i != RootIndex && !Nodes[i].bFixed;
+
+            for (int32 dY = -1; dY <= 1; ++dY)
+            {
+                for (int32 dX = -1; dX <= 1; ++dX)
+                {
+                    const TArray<int32>* Bucket = Grid.Find(Cell + FIntPoint(dX, dY));
+                    if (!Bucket)
+                    {
+                        continue;
+                    }
+
+                    for (int32 j : *Bucket)
+                    {
+                        if (j <= i)
+                        {
+                            continue;
+                        }
+
+                        const FVector2D Delta = Nodes[j].Position - Nodes[i].Position;
+                        const float OverlapX = MinSpacing - FMath::Abs(Delta.X);
+                        const float OverlapY = MinSpacing - FMath::Abs(Delta.Y);
+                        if (OverlapX <= 0.f || OverlapY <= 0.f)
+                        {
+                            continue;
+                        }
+
+                        ++Overlaps;
+
+                        // Coincident nodes still need a direction, the index order gives a stable one
+                        const FVector2D Separation = OverlapX < OverlapY
+                            ? FVector2D((Delta.X >= 0.f ? 1.f : -1.f) * OverlapX, 0.f)
+                            : FVector2D(0.f, (Delta.Y >= 0.f ? 1.f : -1.f) * OverlapY);
+
+                        const bool bMovableJ = j != RootIndex && !Nodes[j].bFixed;
+                        const float ShareI = bMovableI ? (bMovableJ ? 0.5f : 1.f) : 0.f;
+                        const float ShareJ = bMovableJ ? (bMovableI ? 0.5f : 1.f) : 0.f;
+                        Push[i] -= Separation * ShareI;
+                        Push[j] += Separation * ShareJ;
+                    }
+                }
+            }
+        }
+
+        if (Overlaps == 0)
+        {
+            break;
+        }
+
+        for (int32 i : Subset)
+        {
+            Nodes[i].Position += Push[i];
+        }
+    }
+
+    return Overlaps;
+}
@@ -0,0 +1,153 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassRadialLayout.h"
+
+namespace
+{
+    /** Minimum distance between rings. */
+    constexpr float RingSpacing = 160.f;
+
+    /** Arc length a plugin takes on its ring. Crowded rings grow beyond the minimum spacing to keep it. */
+    constexpr float NodeArc = 90.f;
+
+    /** Sort key of nodes without a parent on the ring inside, which go after the others in search order. */
+    constexpr float NoParentKey = 2.f * PI;
+}
+
+void FNsSpyglassRadialLayout::Compute(const TArray<FPluginNode>& Nodes, const TArray<int32>& Subset, const int32 Root, const bool bDependencies, const bool bDependents, TArray<FVector2D>& OutPositions)
+{
+    OutPositions.SetNumZeroed(Nodes.Num());
+
+    const int32 Num = Nodes.Num();
+    TBitArray<> InSubset(false, Num);
+    for (const int32 Node : Subset)
+    {
+        InSubset[Node] = true;
+    }
+    if (!Nodes.IsValidIndex(Root) || !InSubset[Root])
+    {
+        return;
+    }
+
+    const auto ForEachNeighbour = [&Nodes, &InSubset, bDependencies, bDependents](const int32 Node, auto&& Visit)
+    {
+        if (bDependencies)
+        {
+            for (const int32 Link : Nodes[Node].Dependencies)
+            {
+                if (InSubset[Link])
+                {
+                    Visit(Link);
+                }
+            }
+        }
+        if (bDependents)
+        {
+            for (const int32 Link : Nodes[Node].Dependents)
+            {
+                if (InSubset[Link])
+                {
+                    Visit(Link);
+                }
+            }
+        }
+    };
+
+    // --- Rings: breadth-first search, so the order is sorted by distance ---
+    TArray<int32> Depth;
+    Depth.Init(INDEX_NONE, Num);
+    TArray<int32> Order;
+    Order.Reserve(Subset.Num());
+    Order.Add(Root);
+    Depth[Root] = 0;
+    for (int32 Head = 0; Head < Order.Num(); ++Head)
+    {
+        const int32 Node = Order[Head];
+        ForEachNeighbour(Node, [&Depth, &Order, Node](const int32 Link)
+        {
+            if (Depth[Link] == INDEX_NONE)
+            {
+                Depth[Link] = Depth[Node] + 1;
+                Order.Add(Link);
+            }
+        });
+    }
+
+    const int32 OuterRing = Depth[Order.Last()] + 1;
+    for (const int32 Node : Subset)
+    {
+        if (Depth[Node] == INDEX_NONE)
+        {
+            Depth[Node] = OuterRing;
+            Order.Add(Node);
+        }
+    }
+
+    // --- Placement, ring by ring from the inside ---
+    TArray<float> Angle;
+    Angle.Init(0.f, Num);
+    OutPositions[Root] = FVector2D::ZeroVector;
+
+    TArray<TPair<float, int32>> Ring;
+    float Radius = 0.f;
+    for (int32 Begin = 1; Begin < Order.Num();)
+    {
+        const int32 RingDepth = Depth[Order[Begin]];
+        int32 End = Begin;
+        while (End < Order.Num() && Depth[Order[End]] == RingDepth)
+        {
+            ++End;
+        }
+
+        // Order by the mean direction of the parents, angles are averaged as vectors so the wrap at 2 pi does not matter
+        Ring.Reset();
+        for (int32 k = Begin; k < End; ++k)
+        {
+            const int32 Node = Order[k];
+            FVector2D Direction = FVector2D::ZeroVector;
+            ForEachNeighbour(Node, [&Depth, &Angle, &Direction, RingDepth](const int32 Link)
+            {
+                if (Depth[Link] == RingDepth - 1)
+                {
+                    Direction += FVector2D(FMath::Cos(Angle[Link]), FMath::Sin(Angle[Link]));
+                }
+            });
+
+            float Key = NoParentKey + static_cast<float>(k);
+            if (!Direction.IsNearlyZero())
+            {
+                Key = FMath::Atan2(Direction.Y, Direction.X);
+                Key = Key < 0.f ? Key + 2.f * PI : Key;
+            }
+            Ring.Emplace(Key, Node);
+        }
+        Ring.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B)
+        {
+            return A.Key != B.Key ? A.Key < B.Key : A.Value < B.Value;
+        });
+
+        const int32 Count = End - Begin;
+        const float Step = 2.f * PI / static_cast<float>(Count);
+        Radius = FMath::Max(Radius + RingSpacing, static_cast<float>(Count) * NodeArc / (2.f * PI));
+
+        // Turn the ring so its slots sit as close to the parent directions as an even spread allows
+        FVector2D Turn = FVector2D::ZeroVector;
+        for (int32 k = 0; k < Count; ++k)
+        {
+            if (Ring[k].Key < NoParentKey)
+            {
+                const float Offset = Ring[k].Key - Step * static_cast<float>(k);
+                Turn += FVector2D(FMath::Cos(Offset), FMath::Sin(Offset));
+            }
+        }
+        const float Start = Turn.IsNearlyZero() ? 0.f : FMath::Atan2(Turn.Y, Turn.X);
+
+        for (int32 k = 0; k < Count; ++k)
+        {
+            const int32 Node = Ring[k].Value;
+            Angle[Node] = Start + Step * static_cast<float>(k);
+            OutPositions[Node] = FVector2D(FMath::Cos(Angle[Node]), FMath::Sin(Angle[Node])) * Radius;
+        }
+        Begin = End;
+    }
+}
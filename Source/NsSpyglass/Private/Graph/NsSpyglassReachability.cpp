@@ -0,0 +1,100 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassReachability.h"
+
+void FNsSpyglassReachability::Compute(const TArray<FPluginNode>& Nodes, FNsSpyglassReachability& OutReachability)
+{
+    const int32 Num = Nodes.Num();
+
+    FNsSpyglassCycleDetector::Compute(Nodes, OutReachability.Components);
+    const FNsSpyglassCycleInfo& Info = OutReachability.Components;
+    const int32 NumComponents = Info.NumComponents;
+
+    // Group members by component
+    TArray<TArray<int32>> Members;
+    Members.SetNum(NumComponents);
+    for (int32 Node = 0; Node < Num; ++Node)
+    {
+        Members[Info.ComponentOf[Node]].Add(Node);
+    }
+
+    OutReachability.ComponentReach.Reset();
+    OutReachability.ComponentReach.Reserve(NumComponents);
+    TArray<int32> ComponentDepth;
+    ComponentDepth.Init(0, NumComponents);
+
+    // Tarjan completes a component only after everything it reaches, so ascending ids visit successors first
+    for (int32 Component = 0; Component < NumComponents; ++Component)
+    {
+        TBitArray<>& Reach = OutReachability.ComponentReach.Emplace_GetRef(false, Num);
+        const bool bCyclic = Info.IsInCycle(Members[Component][0]);
+
+        for (int32 Node : Members[Component])
+        {
+            if (bCyclic)
+            {
+                Reach[Node] = true;
+            }
+
+            for (int32 Dep : Nodes[Node].Dependencies)
+            {
+                if (!Nodes.IsValidIndex(Dep))
+                {
+                    continue;
+                }
+
+                const int32 DepComponent = Info.ComponentOf[Dep];
+                if (DepComponent == Component)
+                {
+                    continue;
+                }
+
+                Reach[Dep] = true;
+                Reach.CombineWithBitwiseOR(OutReachability.ComponentReach[DepComponent], EBitwiseOperatorFlags::MaintainSize);
+                ComponentDepth[Component] = FMath::Max(ComponentDepth[Component], ComponentDepth[DepComponent] + 1);
+            }
+        }
+    }
+
+    OutReachability.TransitiveDependencies.Init(0, Num);
+    OutReachability.TransitiveDependents.Init(0, Num);
+    OutReachability.Depth.Init(0, Num);
+
+    for (int32 Node = 0; Node < Num; ++Node)
+    {
+        const int32 Component = Info.ComponentOf[Node];
+        const TBitArray<>& Reach = OutReachability.ComponentReach[Component];
+
+        // A node in a cycle reaches itself, which does not count as a dependency
+        OutReachability.TransitiveDependencies[Node] = Reach.CountSetBits() - (Info.IsInCycle(Node) ? 1 : 0);
+        OutReachability.Depth[Node] = ComponentDepth[Component];
+
+        for (TConstSetBitIterator<> It(Reach); It; ++It)
+        {
+            if (It.GetIndex() != Node)
+            {
+                ++OutReachability.TransitiveDependents[It.GetIndex()];
+            }
+        }
+    }
+}
+
+bool FNsSpyglassReachability::DependsOn(int32 From, int32 To) const
+{
+    if (!Components.ComponentOf.IsValidIndex(From) || !Components.ComponentOf.IsValidIndex(To))
+    {
+        return false;
+    }
+
+    return ComponentReach[Components.ComponentOf[From]][To];
+}
+
+int32 FNsSpyglassReachability::GetMaxDepth() const
+{
+    int32 MaxDepth = 0;
+    for (int32 NodeDepth : Depth)
+    {
+        MaxDepth = FMath::Max(MaxDepth, NodeDepth);
+    }
+    return MaxDepth;
+}
@@ -0,0 +1,131 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassSearchIndex.h"
+#include "Algo/BinarySearch.h"
+
+uint64 FNsSpyglassSearchIndex::MakeGramKey(const TCHAR* Chars, const int32 Len)
+{
+    // 20 bits per character covers the BMP and leaves room for the length tag
+    uint64 Key = static_cast<uint64>(Len) << 60;
+    for (int32 i = 0; i < Len; ++i)
+    {
+        Key |= (static_cast<uint64>(Chars[i]) & 0xFFFFF) << (20 * i);
+    }
+    return Key;
+}
+
+void FNsSpyglassSearchIndex::Build(const TArray<FPluginNode>& Nodes)
+{
+    Documents.Reset();
+    Grams.Reset();
+    LastQuery.Reset();
+    LastMatches.Empty();
+
+    Documents.Reserve(Nodes.Num());
+    for (int32 Node = 0; Node < Nodes.Num(); ++Node)
+    {
+        TArray<FString> Fields;
+        Fields.Add(Nodes[Node].Name);
+        if (Nodes[Node].Plugin.IsValid())
+        {
+            const FPluginDescriptor& Desc = Nodes[Node].Plugin->GetDescriptor();
+            Fields.Add(Desc.FriendlyName);
+            Fields.Add(Desc.Category);
+            Fields.Add(Desc.CreatedBy);
+            for (const FModuleDescriptor& Module : Desc.Modules)
+            {
+                Fields.Add(Module.Name.ToString());
+            }
+        }
+
+        // Grams never span the separator, so a term cannot match across two fields
+        const FString& Document = Documents.Add_GetRef(FString::Join(Fields, TEXT("\n")).ToLower());
+        const TCHAR* Chars = *Document;
+        for (int32 Start = 0; Start < Document.Len(); ++Start)
+        {
+            for (int32 Len = 1; Len <= 3 && Start + Len <= Document.Len(); ++Len)
+            {
+                if (Chars[Start + Len - 1] == TEXT('\n'))
+                {
+                    break;
+                }
+
+                TArray<int32>& Posting = Grams.FindOrAdd(MakeGramKey(Chars + Start, Len));
+                if (Posting.Num() == 0 || Posting.Last() != Node)
+                {
+                    Posting.Add(Node);
+                }
+            }
+        }
+    }
+}
+
+void FNsSpyglassSearchIndex::FilterByTerm(const FString& Term, TBitArray<>& InOutMatches) const
+{
+    const TCHAR* Chars = *Term;
+    const int32 NumGrams = Term.Len() <= 3 ? 1 : Term.Len() - 2;
+    const int32 GramLen = FMath::Min(Term.Len(), 3);
+
+    // Collect the posting lists, shortest first so membership checks run on the fewest candidates
+    TArray<const TArray<int32>*, TInlineAllocator<16>> Postings;
+    for (int32 i = 0; i < NumGrams; ++i)
+    {
+        const TArray<int32>* Posting = Grams.Find(MakeGramKey(Chars + i, GramLen));
+        if (!Posting)
+        {
+            InOutMatches.Init(false, InOutMatches.Num());
+            return;
+        }
+        Postings.AddUnique(Posting);
+    }
+    Postings.Sort([](const TArray<int32>& A, const TArray<int32>& B) { return A.Num() < B.Num(); });
+
+    TBitArray<> Candidates(false, InOutMatches.Num());
+    for (int32 Node : *Postings[0])
+    {
+        if (!InOutMatches[Node])
+        {
+            continue;
+        }
+
+        bool bInAll = true;
+        for (int32 i = 1; i < Postings.Num() && bInAll; ++i)
+        {
+            bInAll = Algo::BinarySearch(*Postings[i], Node) != INDEX_NONE;
+        }
+
+        // Shared trigrams do not guarantee the characters are contiguous
+        if (bInAll && (Term.Len() <= 3 || Documents[Node].Contains(Term, ESearchCase::CaseSensitive)))
+        {
+            Candidates[Node] = true;
+        }
+    }
+
+    InOutMatches = MoveTemp(Candidates);
+}
+
+void FNsSpyglassSearchIndex::Search(const FString& Query, TBitArray<>& OutMatches)
+{
+    const FString Lower = Query.TrimStartAndEnd().ToLower();
+    const int32 Num = Documents.Num();
+
+    // Extending the query can only remove matches, start from the previous result
+    if (!LastQuery.IsEmpty() && Lower.StartsWith(LastQuery, ESearchCase::CaseSensitive) && LastMatches.Num() == Num)
+    {
+        OutMatches = LastMatches;
+    }
+    else
+    {
+        OutMatches.Init(true, Num);
+    }
+
+    TArray<FString> Terms;
+    Lower.ParseIntoArrayWS(Terms);
+    for (const FString& Term : Terms)
+    {
+        FilterByTerm(Term, OutMatches);
+    }
+
+    LastQuery = Lower;
+    LastMatches = OutMatches;
+}
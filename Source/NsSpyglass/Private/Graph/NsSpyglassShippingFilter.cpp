@@ -0,0 +1,246 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassShippingFilter.h"
+#include "Interfaces/IProjectManager.h"
+#include "Misc/App.h"
+#include "ProjectDescriptor.h"
+
+namespace
+{
+    /** Engine target type matching a view target. */
+    EBuildTargetType ToBuildTargetType(const ENsSpyglassShipTarget Target)
+    {
+        switch (Target)
+        {
+        case ENsSpyglassShipTarget::Client: return EBuildTargetType::Client;
+        case ENsSpyglassShipTarget::Server: return EBuildTargetType::Server;
+        case ENsSpyglassShipTarget::Editor: return EBuildTargetType::Editor;
+        default:                            return EBuildTargetType::Game;
+        }
+    }
+
+    /** Add platform names from a descriptor list, up to the 64 a mask can hold. */
+    void AddPlatforms(const TArray<FString>& Names, TArray<FString>& InOutPlatforms)
+    {
+        for (const FString& Name : Names)
+        {
+            if (InOutPlatforms.Num() < 64)
+            {
+                InOutPlatforms.AddUnique(Name);
+            }
+        }
+    }
+}
+
+const TArray<FString>& FNsSpyglassShippingFilter::GetKnownPlatforms()
+{
+    static const TArray<FString> Known = { TEXT("Win64"), TEXT("Mac"), TEXT("Linux"), TEXT("LinuxArm64"), TEXT("Android"), TEXT("IOS"), TEXT("TVOS") };
+    return Known;
+}
+
+const TCHAR* FNsSpyglassShippingFilter::GetTargetName(const ENsSpyglassShipTarget Target)
+{
+    switch (Target)
+    {
+    case ENsSpyglassShipTarget::Client: return TEXT("Client");
+    case ENsSpyglassShipTarget::Server: return TEXT("Server");
+    case ENsSpyglassShipTarget::Editor: return TEXT("Editor");
+    default:                            return TEXT("Game");
+    }
+}
+
+void FNsSpyglassShippingFilter::Build(const TArray<FPluginNode>& Nodes)
+{
+    const int32 Num = Nodes.Num();
+
+    // Platforms named by descriptors get a bit too, so their lists are honoured even when not offered in the view
+    Platforms = GetKnownPlatforms();
+    for (const FPluginNode& Node : Nodes)
+    {
+        if (!Node.Plugin.IsValid())
+        {
+            continue;
+        }
+
+        const FPluginDescriptor& Descriptor = Node.Plugin->GetDescriptor();
+        AddPlatforms(Descriptor.SupportedTargetPlatforms, Platforms);
+        for (const FModuleDescriptor& Module : Descriptor.Modules)
+        {
+            AddPlatforms(Module.PlatformAllowList, Platforms);
+            AddPlatforms(Module.PlatformDenyList, Platforms);
+        }
+    }
+
+    const uint64 AllPlatforms = Platforms.Num() == 64 ? ~0ull : (1ull << Platforms.Num()) - 1;
+    const FTargetMasks AllTargets(InPlace, AllPlatforms);
+
+    // Evaluate a predicate for every target and platform once
+    const auto MakeMasks = [this](TFunctionRef<bool(EBuildTargetType, const FString&)> Predicate)
+    {
+        FTargetMasks Masks;
+        for (int32 Target = 0; Target < NumTargets; ++Target)
+        {
+            const EBuildTargetType TargetType = ToBuildTargetType(static_cast<ENsSpyglassShipTarget>(Target));
+            Masks[Target] = 0;
+            for (int32 Platform = 0; Platform < Platforms.Num(); ++Platform)
+            {
+                Masks[Target] |= Predicate(TargetType, Platforms[Platform]) ? 1ull << Platform : 0;
+            }
+        }
+        return Masks;
+    };
+
+    // Plugins the project references keep the allow and deny lists of their reference
+    TMap<FString, const FPluginReferenceDescriptor*> ProjectReferences;
+    if (const FProjectDescriptor* Project = IProjectManager::Get().GetCurrentProject())
+    {
+        for (const FPluginReferenceDescriptor& Reference : Project->Plugins)
+        {
+            ProjectReferences.Add(Reference.Name, &Reference);
+        }
+    }
+
+    NodePlatforms.Reset(Num);
+    ProjectEnabledOn.Reset(Num);
+    ContentOnly.Init(false, Num);
+    Modules.Reset();
+    References.Reset();
+    ReferenceOffsets.Reset(Num + 1);
+
+    const FString TargetName = FApp::GetProjectName();
+    TMap<FString, int32> NameToNode;
+    for (int32 i = 0; i < Num; ++i)
+    {
+        NameToNode.Add(Nodes[i].Name, i);
+    }
+
+    for (int32 i = 0; i < Num; ++i)
+    {
+        ReferenceOffsets.Add(References.Num());
+
+        // Snapshot nodes carry no descriptor, they always ship
+        const FPluginNode& Node = Nodes[i];
+        if (!Node.Plugin.IsValid())
+        {
+            NodePlatforms.Add(AllPlatforms);
+            ProjectEnabledOn.Add(AllTargets);
+            ContentOnly[i] = true;
+            continue;
+        }
+
+        const FPluginDescriptor& Descriptor = Node.Plugin->GetDescriptor();
+        uint64 Supported = 0;
+        for (int32 Platform = 0; Platform < Platforms.Num(); ++Platform)
+        {
+            Supported |= Descriptor.SupportsTargetPlatform(Platforms[Platform]) ? 1ull << Platform : 0;
+        }
+        NodePlatforms.Add(Supported);
+
+        if (const FPluginReferenceDescriptor* const* Reference = ProjectReferences.Find(Node.Name))
+        {
+            const FPluginReferenceDescriptor& ProjectReference = **Reference;
+            ProjectEnabledOn.Add(ProjectReference.bEnabled
+                ? MakeMasks([&ProjectReference](const EBuildTargetType TargetType, const FString& Platform)
+                {
+                    return ProjectReference.IsEnabledForTarget(TargetType) && ProjectReference.IsEnabledForPlatform(Platform);
+                })
+                : FTargetMasks(InPlace, 0));
+        }
+        else
+        {
+            // Plugins the project does not name only ship when enabled by default or pulled in by another plugin
+            ProjectEnabledOn.Add(Node.Plugin->IsEnabledByDefault(true) ? AllTargets : FTargetMasks(InPlace, 0));
+        }
+
+        ContentOnly[i] = Descriptor.Modules.Num() == 0 && Node.Plugin->CanContainContent();
+        for (const FModuleDescriptor& Module : Descriptor.Modules)
+        {
+            FModuleEntry& Entry = Modules.AddDefaulted_GetRef();
+            Entry.Node = i;
+            Entry.bOnDemand = Module.LoadingPhase == ELoadingPhase::None;
+
+            // Non-editor targets are judged as shipping builds, which leave developer tools out and use cooked data
+            Entry.CompiledOn = MakeMasks([&Module, &TargetName](const EBuildTargetType TargetType, const FString& Platform)
+            {
+                const bool bEditor = TargetType == EBuildTargetType::Editor;
+                return Module.IsCompiledInConfiguration(Platform, bEditor ? EBuildConfiguration::Development : EBuildConfiguration::Shipping,
+                    TargetName, TargetType, bEditor, !bEditor);
+            });
+        }
+
+        for (const FPluginReferenceDescriptor& Reference : Descriptor.Plugins)
+        {
+            const int32* To = Reference.bEnabled ? NameToNode.Find(Reference.Name) : nullptr;
+            if (!To)
+            {
+                continue;
+            }
+
+            FReferenceEntry& Entry = References.AddDefaulted_GetRef();
+            Entry.To = *To;
+            Entry.EnabledOn = MakeMasks([&Reference](const EBuildTargetType TargetType, const FString& Platform)
+            {
+                return Reference.IsEnabledForTarget(TargetType) && Reference.IsEnabledForPlatform(Platform);
+            });
+        }
+    }
+    ReferenceOffsets.Add(References.Num());
+}
+
+void FNsSpyglassShippingFilter::Evaluate(const ENsSpyglassShipTarget Target, const FString& Platform, FNsSpyglassShippingResult& OutResult) const
+{
+    const int32 Num = NodePlatforms.Num();
+    const int32 TargetIndex = static_cast<int32>(Target);
+    const int32 PlatformIndex = Platforms.IndexOfByKey(Platform);
+    const uint64 Bit = PlatformIndex != INDEX_NONE ? 1ull << PlatformIndex : 0;
+
+    OutResult = FNsSpyglassShippingResult();
+    OutResult.Ships.Init(false, Num);
+
+    // A plugin can ship when it supports the platform and has something for the target
+    TArray<int32> BuiltModules;
+    BuiltModules.Init(0, Num);
+    for (const FModuleEntry& Module : Modules)
+    {
+        BuiltModules[Module.Node] += (Module.CompiledOn[TargetIndex] & Bit) != 0 ? 1 : 0;
+    }
+
+    TBitArray<> CanShip(false, Num);
+    TArray<int32> Pending;
+    for (int32 i = 0; i < Num; ++i)
+    {
+        CanShip[i] = (NodePlatforms[i] & Bit) != 0 && (BuiltModules[i] > 0 || ContentOnly[i]);
+        if (CanShip[i] && (ProjectEnabledOn[i][TargetIndex] & Bit) != 0)
+        {
+            OutResult.Ships[i] = true;
+            Pending.Add(i);
+        }
+    }
+    const int32 NumSeeds = Pending.Num();
+
+    // Follow the references enabled for the target into everything the shipping plugins need
+    for (int32 Head = 0; Head < Pending.Num(); ++Head)
+    {
+        const int32 Node = Pending[Head];
+        for (int32 Ref = ReferenceOffsets[Node]; Ref < ReferenceOffsets[Node + 1]; ++Ref)
+        {
+            const FReferenceEntry& Reference = References[Ref];
+            if ((Reference.EnabledOn[TargetIndex] & Bit) != 0 && CanShip[Reference.To] && !OutResult.Ships[Reference.To])
+            {
+                OutResult.Ships[Reference.To] = true;
+                Pending.Add(Reference.To);
+            }
+        }
+    }
+
+    OutResult.NumPlugins = Pending.Num();
+    OutResult.NumPulledIn = Pending.Num() - NumSeeds;
+    for (const FModuleEntry& Module : Modules)
+    {
+        if (OutResult.Ships[Module.Node] && (Module.CompiledOn[TargetIndex] & Bit) != 0)
+        {
+            ++OutResult.NumModules;
+            OutResult.NumOnDemandModules += Module.bOnDemand ? 1 : 0;
+        }
+    }
+}
@@ -0,0 +1,505 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassSnapshot.h"
+#include "Async/MappedFileHandle.h"
+#include "Graph/NsSpyglassCycleDetector.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+    /** File header, followed by the sections in the order listed. */
+    struct FSnapshotHeader
+    {
+        uint32 Magic = 0;
+        uint32 Version = 0;
+        uint32 NumNodes = 0;
+        uint32 NumEdges = 0;
+        uint32 NumStrings = 0;
+        uint32 StringBytes = 0;
+        uint32 Reserved[2] = { 0, 0 };
+    };
+
+    static_assert(sizeof(FSnapshotHeader) == 32, "Snapshot header layout changed");
+    static_assert(sizeof(FNsSpyglassSnapshotNode) == 32, "Snapshot node layout changed");
+
+    /** Deduplicates strings while a snapshot is written. */
+    struct FStringTable
+    {
+        TMap<FString, uint32> Ids;
+        TArray<uint32> Offsets = { 0 };
+        TArray<uint8> Bytes;
+
+        uint32 Intern(const FString& Value)
+        {
+            if (const uint32* Existing = Ids.Find(Value))
+            {
+                return *Existing;
+            }
+
+            const FTCHARToUTF8 Utf8(*Value);
+            Bytes.Append(reinterpret_cast<const uint8*>(Utf8.Get()), Utf8.Length());
+            Offsets.Add(Bytes.Num());
+
+            const uint32 Id = Ids.Num();
+            Ids.Add(Value, Id);
+            return Id;
+        }
+    };
+
+    template <typename T>
+    void AppendRaw(TArray<uint8>& Buffer, const T* Items, const int32 Count)
+    {
+        Buffer.Append(reinterpret_cast<const uint8*>(Items), Count * sizeof(T));
+    }
+
+    /** Edge map key. */
+    uint64 EdgeKey(const int32 From, const int32 To)
+    {
+        return (static_cast<uint64>(From) << 32) | static_cast<uint32>(To);
+    }
+}
+
+FNsSpyglassSnapshotView::FNsSpyglassSnapshotView() = default;
+
+FNsSpyglassSnapshotView::~FNsSpyglassSnapshotView()
+{
+    MappedRegion.Reset();
+    MappedHandle.Reset();
+}
+
+bool FNsSpyglassSnapshotView::Open(const FString& FilePath, FString& OutError)
+{
+    MappedRegion.Reset();
+    MappedHandle.Reset();
+    FallbackData.Empty();
+    Data = nullptr;
+    DataSize = 0;
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    MappedHandle.Reset(PlatformFile.OpenMapped(*FilePath));
+    if (MappedHandle.IsValid() && MappedHandle->GetFileSize() > 0)
+    {
+        MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+    }
+
+    if (MappedRegion.IsValid())
+    {
+        Data = MappedRegion->GetMappedPtr();
+        DataSize = MappedRegion->GetMappedSize();
+    }
+    else
+    {
+        // Platforms without mapping support read the whole file
+        MappedHandle.Reset();
+        if (!FFileHelper::LoadFileToArray(FallbackData, *FilePath))
+        {
+            OutError = FString::Printf(TEXT("Could not read %s"), *FilePath);
+            return false;
+        }
+
+        Data = FallbackData.GetData();
+        DataSize = FallbackData.Num();
+    }
+
+    if (!Parse(OutError))
+    {
+        MappedRegion.Reset();
+        MappedHandle.Reset();
+        FallbackData.Empty();
+        Data = nullptr;
+        DataSize = 0;
+        return false;
+    }
+
+    return true;
+}
+
+bool FNsSpyglassSnapshotView::OpenMemory(TArray64<uint8>&& Bytes, FString& OutError)
+{
+    MappedRegion.Reset();
+    MappedHandle.Reset();
+    FallbackData = MoveTemp(Bytes);
+    Data = FallbackData.GetData();
+    DataSize = FallbackData.Num();
+
+    if (!Parse(OutError))
+    {
+        FallbackData.Empty();
+        Data = nullptr;
+        DataSize = 0;
+        return false;
+    }
+
+    return true;
+}
+
+bool FNsSpyglassSnapshotView::Parse(FString& OutError)
+{
+    if (DataSize < static_cast<int64>(sizeof(FSnapshotHeader)))
+    {
+        OutError = TEXT("File is too small to be a snapshot");
+        return false;
+    }
+
+    const FSnapshotHeader& Header = *reinterpret_cast<const FSnapshotHeader*>(Data);
+    if (Header.Magic != FNsSpyglassSnapshot::Magic)
+    {
+        OutError = TEXT("Not a Spyglass snapshot");
+        return false;
+    }
+
+    if (Header.Version != FNsSpyglassSnapshot::Version)
+    {
+        OutError = FString::Printf(TEXT("Unsupported snapshot version %u"), Header.Version);
+        return false;
+    }
+
+    const int64 NodesOffset = sizeof(FSnapshotHeader);
+    const int64 RowsOffset = NodesOffset + static_cast<int64>(Header.NumNodes) * sizeof(FNsSpyglassSnapshotNode);
+    const int64 ColumnsOffset = RowsOffset + (static_cast<int64>(Header.NumNodes) + 1) * sizeof(uint32);
+    const int64 StringOffsetsOffset = ColumnsOffset + static_cast<int64>(Header.NumEdges) * sizeof(uint32);
+    const int64 StringDataOffset = StringOffsetsOffset + (static_cast<int64>(Header.NumStrings) + 1) * sizeof(uint32);
+    if (StringDataOffset + Header.StringBytes > DataSize)
+    {
+        OutError = TEXT("Snapshot is truncated");
+        return false;
+    }
+
+    NodeRecords = reinterpret_cast<const FNsSpyglassSnapshotNode*>(Data + NodesOffset);
+    RowOffsets = reinterpret_cast<const uint32*>(Data + RowsOffset);
+    Columns = reinterpret_cast<const uint32*>(Data + ColumnsOffset);
+    StringOffsets = reinterpret_cast<const uint32*>(Data + StringOffsetsOffset);
+    StringData = reinterpret_cast<const UTF8CHAR*>(Data + StringDataOffset);
+    NumStrings = Header.NumStrings;
+
+    // Validate once so accessors can index without checks
+    if (RowOffsets[0] != 0 || RowOffsets[Header.NumNodes] != Header.NumEdges)
+    {
+        OutError = TEXT("Snapshot edge table is corrupt");
+        return false;
+    }
+
+    for (uint32 i = 0; i < Header.NumNodes; ++i)
+    {
+        const FNsSpyglassSnapshotNode& Node = NodeRecords[i];
+        if (RowOffsets[i] > RowOffsets[i + 1] || Node.NameId >= NumStrings || Node.CategoryId >= NumStrings || Node.VersionNameId >= NumStrings)
+        {
+            OutError = TEXT("Snapshot node table is corrupt");
+            return false;
+        }
+    }
+
+    for (uint32 i = 0; i < Header.NumEdges; ++i)
+    {
+        if (Columns[i] >= Header.NumNodes)
+        {
+            OutError = TEXT("Snapshot edge table is corrupt");
+            return false;
+        }
+    }
+
+    for (uint32 i = 0; i < NumStrings; ++i)
+    {
+        if (StringOffsets[i] > StringOffsets[i + 1] || StringOffsets[i + 1] > Header.StringBytes)
+        {
+            OutError = TEXT("Snapshot string table is corrupt");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int32 FNsSpyglassSnapshotView::NumNodes() const
+{
+    return Data ? static_cast<int32>(reinterpret_cast<const FSnapshotHeader*>(Data)->NumNodes) : 0;
+}
+
+int32 FNsSpyglassSnapshotView::NumEdges() const
+{
+    return Data ? static_cast<int32>(reinterpret_cast<const FSnapshotHeader*>(Data)->NumEdges) : 0;
+}
+
+const FNsSpyglassSnapshotNode& FNsSpyglassSnapshotView::GetNode(const int32 Index) const
+{
+    check(Index >= 0 && Index < NumNodes());
+    return NodeRecords[Index];
+}
+
+TConstArrayView<uint32> FNsSpyglassSnapshotView::GetDependencies(const int32 Index) const
+{
+    check(Index >= 0 && Index < NumNodes());
+    return TConstArrayView<uint32>(Columns + RowOffsets[Index], RowOffsets[Index + 1] - RowOffsets[Index]);
+}
+
+FUtf8StringView FNsSpyglassSnapshotView::GetString(const uint32 StringId) const
+{
+    check(StringId < NumStrings);
+    return FUtf8StringView(StringData + StringOffsets[StringId], StringOffsets[StringId + 1] - StringOffsets[StringId]);
+}
+
+FString FNsSpyglassSnapshotView::GetNodeName(const int32 Index) const
+{
+    const FUtf8StringView Name = GetString(GetNode(Index).NameId);
+    const FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Name.GetData()), Name.Len());
+    return FString(Converted.Length(), Converted.Get());
+}
+
+ENsSpyglassDiffState FNsSpyglassGraphDiff::GetEdgeState(const int32 From, const int32 To) const
+{
+    const ENsSpyglassDiffState* State = EdgeStates.Find(EdgeKey(From, To));
+    return State ? *State : ENsSpyglassDiffState::Unchanged;
+}
+
+bool FNsSpyglassSnapshot::Save(const FString& FilePath, const TArray<FPluginNode>& Nodes)
+{
+    TArray<uint8> Buffer;
+    Write(Nodes, Buffer);
+    return FFileHelper::SaveArrayToFile(Buffer, *FilePath);
+}
+
+void FNsSpyglassSnapshot::Write(const TArray<FPluginNode>& Nodes, TArray<uint8>& OutBuffer)
+{
+    FNsSpyglassCycleInfo CycleInfo;
+    FNsSpyglassCycleDetector::Compute(Nodes, CycleInfo);
+
+    FStringTable Strings;
+    TArray<FNsSpyglassSnapshotNode> Records;
+    TArray<uint32> RowOffsets;
+    TArray<uint32> Columns;
+    Records.Reserve(Nodes.Num());
+    RowOffsets.Reserve(Nodes.Num() + 1);
+    RowOffsets.Add(0);
+
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        const FPluginNode& Node = Nodes[i];
+
+        FNsSpyglassSnapshotNode& Record = Records.AddDefaulted_GetRef();
+        Record.NameId = Strings.Intern(Node.Name);
+        Record.X = static_cast<float>(Node.Position.X);
+        Record.Y = static_cast<float>(Node.Position.Y);
+
+        ENsSpyglassSnapshotNodeFlags Flags = ENsSpyglassSnapshotNodeFlags::None;
+        if (Node.bIsEngine)
+        {
+            Flags |= ENsSpyglassSnapshotNodeFlags::Engine;
+        }
+        if (CycleInfo.IsInCycle(i))
+        {
+            Flags |= ENsSpyglassSnapshotNodeFlags::Cyclic;
+        }
+        Record.Flags = static_cast<uint32>(Flags);
+
+        if (Node.Plugin.IsValid())
+        {
+            const FPluginDescriptor& Desc = Node.Plugin->GetDescriptor();
+            Record.CategoryId = Strings.Intern(Desc.Category);
+            Record.VersionNameId = Strings.Intern(Desc.VersionName);
+            Record.NumModules = Desc.Modules.Num();
+        }
+        else
+        {
+            Record.CategoryId = Strings.Intern(FString());
+            Record.VersionNameId = Record.CategoryId;
+        }
+
+        for (int32 Dep : Node.Dependencies)
+        {
+            if (Nodes.IsValidIndex(Dep))
+            {
+                Columns.Add(Dep);
+            }
+        }
+        RowOffsets.Add(Columns.Num());
+    }
+
+    FSnapshotHeader Header;
+    Header.Magic = Magic;
+    Header.Version = Version;
+    Header.NumNodes = Records.Num();
+    Header.NumEdges = Columns.Num();
+    Header.NumStrings = Strings.Ids.Num();
+    Header.StringBytes = Strings.Bytes.Num();
+
+    OutBuffer.Reset(sizeof(Header) + Records.Num() * sizeof(FNsSpyglassSnapshotNode) + (RowOffsets.Num() + Columns.Num() + Strings.Offsets.Num()) * sizeof(uint32) + Strings.Bytes.Num());
+    AppendRaw(OutBuffer, &Header, 1);
+    AppendRaw(OutBuffer, Records.GetData(), Records.Num());
+    AppendRaw(OutBuffer, RowOffsets.GetData(), RowOffsets.Num());
+    AppendRaw(OutBuffer, Columns.GetData(), Columns.Num());
+    AppendRaw(OutBuffer, Strings.Offsets.GetData(), Strings.Offsets.Num());
+    OutBuffer.Append(Strings.Bytes);
+}
+
+void FNsSpyglassSnapshot::Read(const FNsSpyglassSnapshotView& View, TArray<FPluginNode>& OutNodes)
+{
+    OutNodes.Reset();
+    if (!View.IsValid())
+    {
+        return;
+    }
+
+    OutNodes.SetNum(View.NumNodes());
+    for (int32 i = 0; i < OutNodes.Num(); ++i)
+    {
+        const FNsSpyglassSnapshotNode& Record = View.GetNode(i);
+        FPluginNode& Node = OutNodes[i];
+        Node.Name = View.GetNodeName(i);
+        Node.Position = FVector2D(Record.X, Record.Y);
+        Node.bIsEngine = EnumHasAnyFlags(static_cast<ENsSpyglassSnapshotNodeFlags>(Record.Flags), ENsSpyglassSnapshotNodeFlags::Engine);
+        Node.Plugin = IPluginManager::Get().FindPlugin(Node.Name);
+        for (uint32 Dep : View.GetDependencies(i))
+        {
+            Node.Dependencies.Add(Dep);
+        }
+    }
+
+    for (int32 i = 0; i < OutNodes.Num(); ++i)
+    {
+        for (int32 Dep : OutNodes[i].Dependencies)
+        {
+            OutNodes[i].Links.AddUnique(Dep);
+            OutNodes[Dep].Links.AddUnique(i);
+            OutNodes[Dep].Dependents.AddUnique(i);
+        }
+    }
+}
+
+void FNsSpyglassSnapshot::Diff(const FNsSpyglassSnapshotView& Old, const FNsSpyglassSnapshotView& New, FNsSpyglassGraphDiff& OutDiff)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    OutDiff = FNsSpyglassGraphDiff();
+    if (!Old.IsValid() || !New.IsValid())
+    {
+        return;
+    }
+
+    const int32 NumOld = Old.NumNodes();
+    const int32 NumNew = New.NumNodes();
+
+    // The union keeps the new graph's indices and appends removed nodes
+    TMap<FString, int32> NewIndexByName;
+    NewIndexByName.Reserve(NumNew);
+    OutDiff.Nodes.SetNum(NumNew);
+    OutDiff.NodeStates.Init(ENsSpyglassDiffState::Added, NumNew);
+
+    for (int32 i = 0; i < NumNew; ++i)
+    {
+        const FNsSpyglassSnapshotNode& Record = New.GetNode(i);
+        FPluginNode& Node = OutDiff.Nodes[i];
+        Node.Name = New.GetNodeName(i);
+        Node.Position = FVector2D(Record.X, Record.Y);
+        Node.bIsEngine = EnumHasAnyFlags(static_cast<ENsSpyglassSnapshotNodeFlags>(Record.Flags), ENsSpyglassSnapshotNodeFlags::Engine);
+        NewIndexByName.Add(Node.Name, i);
+    }
+
+    TArray<int32> OldToUnion;
+    OldToUnion.SetNumUninitialized(NumOld);
+    for (int32 i = 0; i < NumOld; ++i)
+    {
+        FString Name = Old.GetNodeName(i);
+        if (const int32* Match = NewIndexByName.Find(Name))
+        {
+            OldToUnion[i] = *Match;
+            OutDiff.NodeStates[*Match] = ENsSpyglassDiffState::Unchanged;
+            continue;
+        }
+
+        const FNsSpyglassSnapshotNode& Record = Old.GetNode(i);
+        FPluginNode& Node = OutDiff.Nodes.AddDefaulted_GetRef();
+        Node.Name = MoveTemp(Name);
+        Node.Position = FVector2D(Record.X, Record.Y);
+        Node.bIsEngine = EnumHasAnyFlags(static_cast<ENsSpyglassSnapshotNodeFlags>(Record.Flags), ENsSpyglassSnapshotNodeFlags::Engine);
+        OldToUnion[i] = OutDiff.NodeStates.Add(ENsSpyglassDiffState::Removed);
+        ++OutDiff.NumRemovedNodes;
+    }
+
+    // Compare matched nodes and collect edges that were added or removed
+    TArray<int32> OldDepsInUnion;
+    for (int32 i = 0; i < NumOld; ++i)
+    {
+        const int32 From = OldToUnion[i];
+        OldDepsInUnion.Reset();
+        for (uint32 Dep : Old.GetDependencies(i))
+        {
+            OldDepsInUnion.Add(OldToUnion[Dep]);
+        }
+
+        const bool bMatched = From < NumNew;
+        const FNsSpyglassSnapshotNode& OldRecord = Old.GetNode(i);
+        bool bChanged = false;
+
+        if (bMatched)
+        {
+            const FNsSpyglassSnapshotNode& NewRecord = New.GetNode(From);
+            bChanged = OldRecord.Flags != NewRecord.Flags
+                || OldRecord.NumModules != NewRecord.NumModules
+                || !Old.GetString(OldRecord.CategoryId).Equals(New.GetString(NewRecord.CategoryId), ESearchCase::CaseSensitive)
+                || !Old.GetString(OldRecord.VersionNameId).Equals(New.GetString(NewRecord.VersionNameId), ESearchCase::CaseSensitive);
+
+            for (uint32 Dep : New.GetDependencies(From))
+            {
+                if (!OldDepsInUnion.Contains(static_cast<int32>(Dep)))
+                {
+                    OutDiff.EdgeStates.Add(EdgeKey(From, Dep), ENsSpyglassDiffState::Added);
+                    ++OutDiff.NumAddedEdges;
+                    bChanged = true;
+                }
+            }
+        }
+
+        // Old edges missing from the new graph are kept in the union so they can be drawn
+        const TConstArrayView<uint32> NewDeps = bMatched ? New.GetDependencies(From) : TConstArrayView<uint32>();
+        for (int32 Dep : OldDepsInUnion)
+        {
+            if (!NewDeps.Contains(static_cast<uint32>(Dep)))
+            {
+                OutDiff.Nodes[From].Dependencies.AddUnique(Dep);
+                OutDiff.EdgeStates.Add(EdgeKey(From, Dep), ENsSpyglassDiffState::Removed);
+                ++OutDiff.NumRemovedEdges;
+                bChanged = true;
+            }
+        }
+
+        if (bMatched && bChanged)
+        {
+            OutDiff.NodeStates[From] = ENsSpyglassDiffState::Changed;
+            ++OutDiff.NumChangedNodes;
+        }
+    }
+
+    // Edges of nodes that only exist in the new graph
+    for (int32 i = 0; i < NumNew; ++i)
+    {
+        for (uint32 Dep : New.GetDependencies(i))
+        {
+            OutDiff.Nodes[i].Dependencies.AddUnique(Dep);
+            if (OutDiff.NodeStates[i] == ENsSpyglassDiffState::Added)
+            {
+                OutDiff.EdgeStates.Add(EdgeKey(i, Dep), ENsSpyglassDiffState::Added);
+                ++OutDiff.NumAddedEdges;
+            }
+        }
+
+        if (OutDiff.NodeStates[i] == ENsSpyglassDiffState::Added)
+        {
+            ++OutDiff.NumAddedNodes;
+        }
+    }
+
+    // Derived adjacency used by layout and highlighting
+    for (int32 i = 0; i < OutDiff.Nodes.Num(); ++i)
+    {
+        FPluginNode& Node = OutDiff.Nodes[i];
+        for (int32 Dep : Node.Dependencies)
+        {
+            Node.Links.AddUnique(Dep);
+            OutDiff.Nodes[Dep].Links.AddUnique(i);
+            OutDiff.Nodes[Dep].Dependents.AddUnique(i);
+        }
+    }
+
+    OutDiff.DiffSeconds = FPlatformTime::Seconds() - StartTime;
+}
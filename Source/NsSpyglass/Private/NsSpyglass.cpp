@@ -1,11 +1,31 @@
 #include "NsSpyglass.h"
+#include "Analysis/NsSpyglassBuildTimings.h"
+#include "Analysis/NsSpyglassContentRollup.h"
+#include "Analysis/NsSpyglassIncludeScanner.h"
+#include "Analysis/NsSpyglassSession.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Graph/NsSpyglassGraphQuery.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
 #include "Settings/NsSpyglassSettings.h"
 #include "Styling/SlateTypes.h"
 #include "ToolMenus.h"
 #include "Widgets/Docking/SDockTab.h"
+#include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SSearchBox.h"
 #include "Widgets/Input/SSpinBox.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include "Widgets/SOverlay.h"
+#include "Widgets/SNsSpyglassCycleListWidget.h"
 #include "Widgets/SNsSpyglassGraphWidget.h"
+#include "Widgets/SNsSpyglassMatrixWidget.h"
+#include "Widgets/SNsSpyglassMinimapWidget.h"
+#include "Widgets/SNsSpyglassShippingWidget.h"
+#include "Widgets/SNsSpyglassSnapshotWidget.h"
+#include "Widgets/SNsSpyglassTimelineWidget.h"
+#include "Widgets/SNsSpyglassUnusedPluginsWidget.h"
+#include "Widgets/SNsSpyglassWhatIfWidget.h"
 #include "Widgets/SPluginInfoWidget.h"
 #include "Widgets/Text/STextBlock.h"
 
@@ -40,6 +60,10 @@ void FNsSpyglassModule::StartupModule()
 /** Cleanup registered UI on shutdown. */
 void FNsSpyglassModule::ShutdownModule()
 {
+    FNsSpyglassContentRollup::Get().Shutdown();
+    FNsSpyglassBuildTimings::Get().Shutdown();
+    FNsSpyglassIncludeScanner::Get().Shutdown();
+    FNsSpyglassGraphQuery::InvalidateLive();
     UToolMenus::UnregisterOwner(this);
     FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SpyglassTabName);
 }
@@ -48,7 +72,14 @@ void FNsSpyglassModule::ShutdownModule()
 TSharedRef<SDockTab> FNsSpyglassModule::OnSpawnPluginTab(const FSpawnTabArgs& Args)
 {
     TSharedPtr<SNsSpyglassGraphWidget> GraphWidget;
+    TSharedPtr<SNsSpyglassMatrixWidget> MatrixWidget;
     TSharedPtr<SPluginInfoWidget> InfoWidget;
+    TSharedPtr<SNsSpyglassCycleListWidget> CycleListWidget;
+    TSharedPtr<SNsSpyglassUnusedPluginsWidget> UnusedPluginsWidget;
+    TSharedPtr<SNsSpyglassWhatIfWidget> WhatIfWidget;
+    TSharedPtr<SNsSpyglassShippingWidget> ShippingWidget;
+    TSharedPtr<SNsSpyglassSnapshotWidget> SnapshotWidget;
+    TSharedPtr<SNsSpyglassTimelineWidget> TimelineWidget;
 
     // Spin boxes that expose the runtime settings. The widgets are stored so
     // their values can be updated when Zen mode toggles.
@@ -61,18 +92,74 @@ TSharedRef<SDockTab> FNsSpyglassModule::OnSpawnPluginTab(const FSpawnTabArgs& Ar
     const float MaxCenterForce = 1.f;
     const float MaxAttractionScale = 2.f;
 
+    // Created up front so side panel controls can bind to it
+    GraphWidget = SNew(SNsSpyglassGraphWidget);
+    TWeakPtr<SNsSpyglassGraphWidget> WeakGraph = GraphWidget;
+
+    // The matrix covers the graph, which is hidden meanwhile so it stops ticking and painting
+    GraphWidget->SetVisibility(TAttribute<EVisibility>::CreateLambda([]()
+    {
+        return UNsSpyglassSettings::GetSettings()->bShowMatrix ? EVisibility::Hidden : EVisibility::Visible;
+    }));
+
     TSharedRef<SDockTab> Tab = SNew(SDockTab)
     .TabRole(ETabRole::NomadTab)
     [
         SNew(SHorizontalBox)
         + SHorizontalBox::Slot().FillWidth(1.f)
         [
-            SAssignNew(GraphWidget, SNsSpyglassGraphWidget)
+            SNew(SOverlay)
+            + SOverlay::Slot()
+            [
+                GraphWidget.ToSharedRef()
+            ]
+            + SOverlay::Slot().HAlign(HAlign_Right).VAlign(VAlign_Bottom).Padding(8.f)
+            [
+                SNew(SNsSpyglassMinimapWidget, GraphWidget.ToSharedRef())
+                .Visibility_Lambda([]()
+                {
+                    const UNsSpyglassSettings* Settings = UNsSpyglassSettings::GetSettings();
+                    return Settings->bShowMinimap && !Settings->bShowMatrix ? EVisibility::Visible : EVisibility::Collapsed;
+                })
+            ]
+            + SOverlay::Slot()
+            [
+                SAssignNew(MatrixWidget, SNsSpyglassMatrixWidget)
+                .Visibility_Lambda([]()
+                {
+                    return UNsSpyglassSettings::GetSettings()->bShowMatrix ? EVisibility::Visible : EVisibility::Collapsed;
+                })
+            ]
         ]
         + SHorizontalBox::Slot().AutoWidth().Padding(4.f)
         [
             SNew(SVerticalBox)
             + SVerticalBox::Slot().AutoHeight()
+            [
+                SNew(SSearchBox)
+                .HintText(FText::FromString("Search plugins, authors, modules..."))
+                .OnTextChanged_Lambda([WeakGraph](const FText& Text)
+                {
+                    if (const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin())
+                    {
+                        Graph->SetFilter(Text.ToString());
+                    }
+                })
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                SNew(STextBlock)
+                .Text_Lambda([WeakGraph]()
+                {
+                    const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+                    if (!Graph.IsValid() || Graph->GetNumVisibleNodes() == Graph->GetNodes().Num())
+                    {
+                        return FText();
+                    }
+                    return FText::FromString(FString::Printf(TEXT("%d of %d plugins"), Graph->GetNumVisibleNodes(), Graph->GetNodes().Num()));
+                })
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
             [
                 SNew(STextBlock).Text(FText::FromString("Repulsion"))
             ]
@@ -135,6 +222,353 @@ TSharedRef<SDockTab> FNsSpyglassModule::OnSpawnPluginTab(const FSpawnTabArgs& Ar
                     NsSpyglassSettings->SaveConfig();
                 })
             ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SNew(SCheckBox)
+                .IsChecked_Lambda([WeakGraph]()
+                {
+                    const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+                    return Graph.IsValid() && Graph->IsShowingContentEdges() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+                })
+                .OnCheckStateChanged_Lambda([WeakGraph](const ECheckBoxState State)
+                {
+                    if (const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin())
+                    {
+                        Graph->SetShowContentEdges(State == ECheckBoxState::Checked);
+                    }
+                })
+                [
+                    SNew(STextBlock).Text(FText::FromString("Content References"))
+                ]
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                SNew(STextBlock)
+                .Text_Lambda([]()
+                {
+                    const FNsSpyglassContentRollup& Rollup = FNsSpyglassContentRollup::Get();
+                    if (Rollup.IsGathering())
+                    {
+                        return FText::FromString(FString::Printf(TEXT("Scanning content... %d%%"), FMath::RoundToInt(Rollup.GetProgress() * 100.f)));
+                    }
+
+                    const FNsSpyglassContentResultPtr Result = Rollup.GetResult();
+                    if (!Result.IsValid())
+                    {
+                        return FText();
+                    }
+
+                    return FText::FromString(FString::Printf(TEXT("%d content edges, %d undeclared (%d packages)"),
+                        Result->Edges.Num(), Result->NumUndeclared(), Result->NumPackages));
+                })
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SNew(SCheckBox)
+                .IsChecked_Lambda([WeakGraph]()
+                {
+                    const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+                    return Graph.IsValid() && Graph->IsShowingIncludeEdges() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+                })
+                .OnCheckStateChanged_Lambda([WeakGraph](const ECheckBoxState State)
+                {
+                    if (const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin())
+                    {
+                        Graph->SetShowIncludeEdges(State == ECheckBoxState::Checked);
+                    }
+                })
+                [
+                    SNew(STextBlock).Text(FText::FromString("Source Includes"))
+                ]
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                SNew(STextBlock)
+                .Text_Lambda([]()
+                {
+                    const FNsSpyglassIncludeScanner& Scanner = FNsSpyglassIncludeScanner::Get();
+                    if (Scanner.IsGathering())
+                    {
+                        return FText::FromString(FString::Printf(TEXT("Scanning sources... %d%%"), FMath::RoundToInt(Scanner.GetProgress() * 100.f)));
+                    }
+
+                    const FNsSpyglassIncludeResultPtr Result = Scanner.GetResult();
+                    if (!Result.IsValid())
+                    {
+                        return FText();
+                    }
+
+                    return FText::FromString(FString::Printf(TEXT("%d include edges, %d undeclared (%d files, %d scanned)"),
+                        Result->Edges.Num(), Result->NumUndeclared(), Result->NumFiles, Result->NumScanned));
+                })
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SNew(SCheckBox)
+                .IsChecked_Lambda([WeakGraph]()
+                {
+                    const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+                    return Graph.IsValid() && Graph->IsShowingBuildHeat() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+                })
+                .OnCheckStateChanged_Lambda([WeakGraph](const ECheckBoxState State)
+                {
+                    if (const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin())
+                    {
+                        Graph->SetShowBuildHeat(State == ECheckBoxState::Checked);
+                    }
+                })
+                [
+                    SNew(STextBlock).Text(FText::FromString("Build Heat"))
+                ]
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                SNew(SCheckBox)
+                .IsEnabled_Lambda([WeakGraph]()
+                {
+                    const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+                    return Graph.IsValid() && Graph->IsShowingBuildHeat();
+                })
+                .IsChecked_Lambda([WeakGraph]()
+                {
+                    const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+                    return Graph.IsValid() && Graph->IsBuildHeatInclusive() ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+                })
+                .OnCheckStateChanged_Lambda([WeakGraph](const ECheckBoxState State)
+                {
+                    if (const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin())
+                    {
+                        Graph->SetBuildHeatInclusive(State == ECheckBoxState::Checked);
+                    }
+                })
+                [
+                    SNew(STextBlock).Text(FText::FromString("Include Dependencies"))
+                ]
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                SNew(STextBlock)
+                .Text_Lambda([WeakGraph]()
+                {
+                    const FNsSpyglassBuildTimings& Timings = FNsSpyglassBuildTimings::Get();
+                    if (Timings.IsGathering())
+                    {
+                        return FText::FromString(FString::Printf(TEXT("Reading build traces... %d%%"), FMath::RoundToInt(Timings.GetProgress() * 100.f)));
+                    }
+
+                    const FNsSpyglassBuildTimingResultPtr Result = Timings.GetResult();
+                    if (!Result.IsValid())
+                    {
+                        return FText();
+                    }
+                    if (Result->NumTraces == 0)
+                    {
+                        return FText::FromString(TEXT("No build traces, compile with -Timing or -ftime-trace"));
+                    }
+
+                    double TotalSeconds = 0.0;
+                    for (const FNsSpyglassModuleTiming& Module : Result->Modules)
+                    {
+                        TotalSeconds += Module.Seconds;
+                    }
+                    FString Status = FString::Printf(TEXT("%.0f s compiling in %d modules (%d traces, %d parsed)"),
+                        TotalSeconds, Result->Modules.Num(), Result->NumTraces, Result->NumParsed);
+
+                    const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+                    if (Graph.IsValid() && Graph->GetNodes().IsValidIndex(Result->HottestNode)
+                        && Result->PluginSetHash == FNsSpyglassContentRollup::ComputePluginSetHash(Graph->GetNodes()))
+                    {
+                        Status += FString::Printf(TEXT("\nSlowest plugin: %s, %.1f s"), *Graph->GetNodes()[Result->HottestNode].Name, Result->MaxExclusive);
+                    }
+                    return FText::FromString(Status);
+                })
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SNew(SCheckBox)
+                .IsChecked_Lambda([]()
+                {
+                    return UNsSpyglassSettings::GetSettings()->bBundleEdges ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+                })
+                .OnCheckStateChanged_Lambda([](const ECheckBoxState State)
+                {
+                    UNsSpyglassSettings* NsSpyglassSettings = GetMutableDefault<UNsSpyglassSettings>();
+                    check(NsSpyglassSettings);
+
+                    NsSpyglassSettings->bBundleEdges = State == ECheckBoxState::Checked;
+                    NsSpyglassSettings->SaveConfig();
+                })
+                [
+                    SNew(STextBlock).Text(FText::FromString("Bundle Edges"))
+                ]
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                SNew(SCheckBox)
+                .IsChecked_Lambda([WeakGraph]()
+                {
+                    const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+                    return Graph.IsValid() && Graph->GetLayoutMode() == ENsSpyglassLayoutMode::Layered ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+                })
+                .OnCheckStateChanged_Lambda([WeakGraph](const ECheckBoxState State)
+                {
+                    if (const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin())
+                    {
+                        Graph->SetLayoutMode(State == ECheckBoxState::Checked ? ENsSpyglassLayoutMode::Layered : ENsSpyglassLayoutMode::Force);
+                    }
+                })
+                [
+                    SNew(STextBlock).Text(FText::FromString("Layered Layout"))
+                ]
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                SNew(SCheckBox)
+                .IsChecked_Lambda([WeakGraph]()
+                {
+                    const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+                    return Graph.IsValid() && Graph->GetLayoutMode() == ENsSpyglassLayoutMode::Radial ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+                })
+                .OnCheckStateChanged_Lambda([WeakGraph](const ECheckBoxState State)
+                {
+                    if (const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin())
+                    {
+                        Graph->SetLayoutMode(State == ECheckBoxState::Checked ? ENsSpyglassLayoutMode::Radial : ENsSpyglassLayoutMode::Force);
+                    }
+                })
+                [
+                    SNew(STextBlock).Text(FText::FromString("Radial Layout"))
+                ]
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                SNew(SCheckBox)
+                .IsChecked_Lambda([]()
+                {
+                    return UNsSpyglassSettings::GetSettings()->bShowMinimap ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+                })
+                .OnCheckStateChanged_Lambda([](const ECheckBoxState State)
+                {
+                    UNsSpyglassSettings* NsSpyglassSettings = GetMutableDefault<UNsSpyglassSettings>();
+                    check(NsSpyglassSettings);
+
+                    NsSpyglassSettings->bShowMinimap = State == ECheckBoxState::Checked;
+                    NsSpyglassSettings->SaveConfig();
+                })
+                [
+                    SNew(STextBlock).Text(FText::FromString("Minimap"))
+                ]
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                SNew(SCheckBox)
+                .IsChecked_Lambda([]()
+                {
+                    return UNsSpyglassSettings::GetSettings()->bShowMatrix ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+                })
+                .OnCheckStateChanged_Lambda([](const ECheckBoxState State)
+                {
+                    UNsSpyglassSettings* NsSpyglassSettings = GetMutableDefault<UNsSpyglassSettings>();
+                    check(NsSpyglassSettings);
+
+                    NsSpyglassSettings->bShowMatrix = State == ECheckBoxState::Checked;
+                    NsSpyglassSettings->SaveConfig();
+                })
+                [
+                    SNew(STextBlock).Text(FText::FromString("Dependency Matrix"))
+                ]
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                SNew(SCheckBox)
+                .IsChecked_Lambda([]()
+                {
+                    return UNsSpyglassSettings::GetSettings()->bShowStars ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+                })
+                .OnCheckStateChanged_Lambda([](const ECheckBoxState State)
+                {
+                    UNsSpyglassSettings* NsSpyglassSettings = GetMutableDefault<UNsSpyglassSettings>();
+                    check(NsSpyglassSettings);
+
+                    NsSpyglassSettings->bShowStars = State == ECheckBoxState::Checked;
+                    NsSpyglassSettings->SaveConfig();
+                })
+                [
+                    SNew(STextBlock).Text(FText::FromString("Stars"))
+                ]
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Remove Overlaps"))
+                .ToolTipText(FText::FromString("Push overlapping nodes apart. Runs by itself once the layout settles."))
+                .OnClicked_Lambda([WeakGraph]()
+                {
+                    if (const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin())
+                    {
+                        Graph->RemoveOverlaps();
+                    }
+                    return FReply::Handled();
+                })
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SNew(SButton)
+                .Text_Lambda([WeakGraph]()
+                {
+                    const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+                    return FText::FromString(Graph.IsValid() && Graph->IsRecording() ? "Stop Recording" : "Record Session");
+                })
+                .ToolTipText(FText::FromString("Record input and frame timing of this view to Saved/Spyglass/Sessions. Replay with Spyglass.Replay <File>."))
+                .OnClicked_Lambda([WeakGraph]()
+                {
+                    const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+                    if (!Graph.IsValid())
+                    {
+                        return FReply::Handled();
+                    }
+
+                    if (!Graph->IsRecording())
+                    {
+                        Graph->StartRecording();
+                        return FReply::Handled();
+                    }
+
+                    const FString Directory = FNsSpyglassSession::GetDefaultDirectory();
+                    IFileManager::Get().MakeDirectory(*Directory, true);
+                    const FString FilePath = Directory / FString::Printf(TEXT("Session-%s.nssession"), *FDateTime::Now().ToString());
+                    FNotificationInfo Info(FText::FromString(Graph->StopRecording(FilePath)
+                        ? FString::Printf(TEXT("Recorded %s"), *FPaths::GetCleanFilename(FilePath))
+                        : FString(TEXT("Nothing was recorded"))));
+                    Info.ExpireDuration = 5.f;
+                    FSlateNotificationManager::Get().AddNotification(Info);
+                    return FReply::Handled();
+                })
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SAssignNew(CycleListWidget, SNsSpyglassCycleListWidget)
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SAssignNew(UnusedPluginsWidget, SNsSpyglassUnusedPluginsWidget)
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SAssignNew(WhatIfWidget, SNsSpyglassWhatIfWidget)
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SAssignNew(ShippingWidget, SNsSpyglassShippingWidget)
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SAssignNew(SnapshotWidget, SNsSpyglassSnapshotWidget)
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,5,0,0))
+            [
+                SAssignNew(TimelineWidget, SNsSpyglassTimelineWidget)
+            ]
             + SVerticalBox::Slot().AutoHeight()
            [
                SAssignNew(InfoWidget, SPluginInfoWidget)
@@ -147,6 +581,63 @@ TSharedRef<SDockTab> FNsSpyglassModule::OnSpawnPluginTab(const FSpawnTabArgs& Ar
         GraphWidget->SetOnNodeHovered(SNsSpyglassGraphWidget::FOnNodeHovered::CreateSP(InfoWidget.Get(), &SPluginInfoWidget::SetPlugin));
     }
 
+    if (MatrixWidget.IsValid() && InfoWidget.IsValid())
+    {
+        MatrixWidget->SetOnNodeHovered(SNsSpyglassMatrixWidget::FOnNodeHovered::CreateSP(InfoWidget.Get(), &SPluginInfoWidget::SetPlugin));
+    }
+
+    if (GraphWidget.IsValid() && CycleListWidget.IsValid())
+    {
+        CycleListWidget->SetCycles(GraphWidget->GetNodes(), GraphWidget->GetCycleInfo());
+        CycleListWidget->SetOnCycleSelected(SNsSpyglassCycleListWidget::FOnCycleSelected::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::SetSelectedCycle));
+
+        TWeakPtr<SNsSpyglassCycleListWidget> WeakCycleList = CycleListWidget;
+        GraphWidget->SetOnGraphRebuilt(SNsSpyglassGraphWidget::FOnGraphRebuilt::CreateLambda([WeakGraph, WeakCycleList]()
+        {
+            const TSharedPtr<SNsSpyglassGraphWidget> Graph = WeakGraph.Pin();
+            const TSharedPtr<SNsSpyglassCycleListWidget> CycleList = WeakCycleList.Pin();
+            if (Graph.IsValid() && CycleList.IsValid())
+            {
+                CycleList->SetCycles(Graph->GetNodes(), Graph->GetCycleInfo());
+            }
+        }));
+    }
+
+    if (GraphWidget.IsValid() && UnusedPluginsWidget.IsValid())
+    {
+        UnusedPluginsWidget->SetOnFindRequested(SNsSpyglassUnusedPluginsWidget::FOnFindRequested::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::FindUnusedPlugins));
+        GraphWidget->SetOnUnusedPluginsFound(SNsSpyglassGraphWidget::FOnUnusedPluginsFound::CreateSP(UnusedPluginsWidget.Get(), &SNsSpyglassUnusedPluginsWidget::SetResult));
+    }
+
+    if (GraphWidget.IsValid() && WhatIfWidget.IsValid())
+    {
+        WhatIfWidget->SetOnModeChanged(SNsSpyglassWhatIfWidget::FOnModeChanged::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::SetWhatIfMode));
+        WhatIfWidget->SetOnDisableFilteredRequested(SNsSpyglassWhatIfWidget::FOnScenarioRequested::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::DisableVisiblePlugins));
+        WhatIfWidget->SetOnResetRequested(SNsSpyglassWhatIfWidget::FOnScenarioRequested::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::ResetWhatIf));
+        GraphWidget->SetOnWhatIfChanged(SNsSpyglassGraphWidget::FOnWhatIfChanged::CreateSP(WhatIfWidget.Get(), &SNsSpyglassWhatIfWidget::SetResult));
+    }
+
+    if (GraphWidget.IsValid() && ShippingWidget.IsValid())
+    {
+        ShippingWidget->SetOnViewChanged(SNsSpyglassShippingWidget::FOnViewChanged::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::SetShippingView));
+        GraphWidget->SetOnShippingViewChanged(SNsSpyglassGraphWidget::FOnShippingViewChanged::CreateSP(ShippingWidget.Get(), &SNsSpyglassShippingWidget::SetResult));
+    }
+
+    if (GraphWidget.IsValid() && SnapshotWidget.IsValid())
+    {
+        SnapshotWidget->SetOnSaveRequested(SNsSpyglassSnapshotWidget::FOnSaveRequested::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::SaveSnapshot));
+        SnapshotWidget->SetOnDiffReady(SNsSpyglassSnapshotWidget::FOnDiffReady::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::ShowDiff));
+        SnapshotWidget->SetOnLiveRequested(SNsSpyglassSnapshotWidget::FOnLiveRequested::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::RebuildGraph));
+    }
+
+    if (GraphWidget.IsValid() && TimelineWidget.IsValid())
+    {
+        TimelineWidget->SetOnHistoryLoaded(SNsSpyglassTimelineWidget::FOnHistoryLoaded::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::ShowTimeline));
+        TimelineWidget->SetOnCommitSelected(SNsSpyglassTimelineWidget::FOnCommitSelected::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::SetTimelineCommit));
+        TimelineWidget->SetOnLiveRequested(SNsSpyglassTimelineWidget::FOnLiveRequested::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::RebuildGraph));
+        TimelineWidget->SetOnScrubbingChanged(SNsSpyglassTimelineWidget::FOnScrubbingChanged::CreateSP(GraphWidget.Get(), &SNsSpyglassGraphWidget::SetTimelineScrubbing));
+    }
+
     return Tab;
 }
 
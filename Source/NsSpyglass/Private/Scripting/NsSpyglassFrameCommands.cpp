@@ -0,0 +1,98 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassFrameAllocations.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogNsSpyglassFrame, Log, All);
+
+namespace
+{
+    /** Frames skipped before sampling, so scratch buffers reach their steady size first. */
+    constexpr int32 WarmupFrames = 30;
+
+    /** A running allocation check. */
+    struct FFrameCheck
+    {
+        int32 Warmup = WarmupFrames;
+        int32 Remaining = 0;
+        int32 Sampled = 0;
+        int32 FramesWithAllocations = 0;
+        uint32 MaxCount = 0;
+        uint64 TotalCount = 0;
+        uint64 TotalSlateAllocations = 0;
+        bool bWasEnabled = false;
+    };
+
+    TOptional<FFrameCheck> ActiveCheck;
+
+    bool SampleFrame(float)
+    {
+        FFrameCheck& Check = ActiveCheck.GetValue();
+        if (Check.Warmup > 0)
+        {
+            --Check.Warmup;
+            return true;
+        }
+
+        const uint32 Count = FNsSpyglassFrameAllocations::GetLastFrameCount();
+        ++Check.Sampled;
+        Check.FramesWithAllocations += Count > 0 ? 1 : 0;
+        Check.MaxCount = FMath::Max(Check.MaxCount, Count);
+        Check.TotalCount += Count;
+        Check.TotalSlateAllocations += FNsSpyglassFrameAllocations::GetLastFrameSlateAllocations();
+        if (--Check.Remaining > 0)
+        {
+            return true;
+        }
+
+        if (Check.FramesWithAllocations == 0)
+        {
+            UE_LOG(LogNsSpyglassFrame, Display, TEXT("Passed: no allocations in %d frames, %.1f Slate element allocations per frame"),
+                Check.Sampled, static_cast<double>(Check.TotalSlateAllocations) / Check.Sampled);
+        }
+        else
+        {
+            UE_LOG(LogNsSpyglassFrame, Error, TEXT("Failed: %d of %d frames allocated, %llu allocations in total, at most %u in one frame"),
+                Check.FramesWithAllocations, Check.Sampled, Check.TotalCount, Check.MaxCount);
+        }
+
+        FNsSpyglassFrameAllocations::SetEnabled(Check.bWasEnabled);
+        ActiveCheck.Reset();
+        return false;
+    }
+
+    void CheckFrameAllocations(const TArray<FString>& Args)
+    {
+        if (ActiveCheck.IsSet())
+        {
+            UE_LOG(LogNsSpyglassFrame, Display, TEXT("A check is already running"));
+            return;
+        }
+
+        FFrameCheck& Check = ActiveCheck.Emplace();
+        Check.Remaining = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 120;
+        Check.bWasEnabled = FNsSpyglassFrameAllocations::IsEnabled();
+        FNsSpyglassFrameAllocations::SetEnabled(true);
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&SampleFrame));
+
+        UE_LOG(LogNsSpyglassFrame, Display, TEXT("Counting graph view allocations over %d frames after %d warmup frames"), Check.Remaining, WarmupFrames);
+    }
+
+    void CountFrameAllocations(const TArray<FString>& Args)
+    {
+        const bool bEnable = Args.Num() > 0 ? FCString::Atoi(*Args[0]) != 0 : !FNsSpyglassFrameAllocations::IsEnabled();
+        FNsSpyglassFrameAllocations::SetEnabled(bEnable);
+        UE_LOG(LogNsSpyglassFrame, Display, TEXT("Frame allocation counting %s, see 'stat Spyglass'"), bEnable ? TEXT("on") : TEXT("off"));
+    }
+
+    FAutoConsoleCommand CheckFrameAllocationsCommand(
+        TEXT("Spyglass.CheckFrameAllocations"),
+        TEXT("Count heap allocations of open graph views over a number of frames and fail if any frame allocated. Works while the layout is still moving. Usage: Spyglass.CheckFrameAllocations [Frames]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&CheckFrameAllocations));
+
+    FAutoConsoleCommand CountFrameAllocationsCommand(
+        TEXT("Spyglass.CountFrameAllocations"),
+        TEXT("Toggle counting graph view heap allocations into the Spyglass stat group. Usage: Spyglass.CountFrameAllocations [0|1]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&CountFrameAllocations));
+}
@@ -0,0 +1,154 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Graph/NsSpyglassGraphQuery.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogNsSpyglassQuery, Log, All);
+
+namespace
+{
+    /** Resolve a plugin name argument, logging when it is unknown. */
+    int32 ResolvePlugin(const FNsSpyglassGraphQuery& Query, const FString& Name)
+    {
+        const int32 Node = Query.FindNode(Name);
+        if (Node == INDEX_NONE)
+        {
+            UE_LOG(LogNsSpyglassQuery, Warning, TEXT("Unknown or disabled plugin '%s'"), *Name);
+        }
+        return Node;
+    }
+
+    /** Format a node list as "A -> B -> C". */
+    FString JoinPath(const FNsSpyglassGraphQuery& Query, const TArray<int32>& Path, const TCHAR* Separator)
+    {
+        TArray<FString> Names;
+        for (int32 Node : Path)
+        {
+            Names.Add(Query.GetName(Node));
+        }
+        return FString::Join(Names, Separator);
+    }
+
+    void Why(const TArray<FString>& Args)
+    {
+        if (Args.Num() < 2)
+        {
+            UE_LOG(LogNsSpyglassQuery, Display, TEXT("Usage: Spyglass.Why <From> <To> [MaxPaths]"));
+            return;
+        }
+
+        const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+        const int32 From = ResolvePlugin(*Query, Args[0]);
+        const int32 To = ResolvePlugin(*Query, Args[1]);
+        if (From == INDEX_NONE || To == INDEX_NONE)
+        {
+            return;
+        }
+
+        const int32 MaxPaths = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 1;
+        const double StartTime = FPlatformTime::Seconds();
+
+        TArray<TArray<int32>> Paths;
+        if (MaxPaths <= 1)
+        {
+            TArray<int32>& Path = Paths.AddDefaulted_GetRef();
+            if (!Query->FindShortestPath(From, To, Path))
+            {
+                Paths.Reset();
+            }
+        }
+        else
+        {
+            Query->FindAllPaths(From, To, MaxPaths, Paths);
+        }
+
+        const double Micro = (FPlatformTime::Seconds() - StartTime) * 1000000.0;
+        if (Paths.Num() == 0)
+        {
+            UE_LOG(LogNsSpyglassQuery, Display, TEXT("%s does not depend on %s (%.1f us)"), *Args[0], *Args[1], Micro);
+            return;
+        }
+
+        for (const TArray<int32>& Path : Paths)
+        {
+            UE_LOG(LogNsSpyglassQuery, Display, TEXT("%s"), *JoinPath(*Query, Path, TEXT(" -> ")));
+        }
+        UE_LOG(LogNsSpyglassQuery, Display, TEXT("%d path(s) in %.1f us"), Paths.Num(), Micro);
+    }
+
+    void Neighbours(const TArray<FString>& Args)
+    {
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogNsSpyglassQuery, Display, TEXT("Usage: Spyglass.Neighbours <Plugin> [Hops] [down|up|both]"));
+            return;
+        }
+
+        const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+        const int32 Node = ResolvePlugin(*Query, Args[0]);
+        if (Node == INDEX_NONE)
+        {
+            return;
+        }
+
+        const int32 Hops = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 1;
+        ENsSpyglassQueryDirection Direction = ENsSpyglassQueryDirection::Both;
+        if (Args.Num() > 2)
+        {
+            Direction = Args[2] == TEXT("down") ? ENsSpyglassQueryDirection::Down
+                : Args[2] == TEXT("up") ? ENsSpyglassQueryDirection::Up
+                : ENsSpyglassQueryDirection::Both;
+        }
+
+        TArray<int32> Nodes;
+        Query->GetNeighbourhood(Node, Hops, Direction, Nodes);
+        UE_LOG(LogNsSpyglassQuery, Display, TEXT("%d plugin(s) within %d hop(s) of %s: %s"), Nodes.Num(), Hops, *Args[0], *JoinPath(*Query, Nodes, TEXT(", ")));
+    }
+
+    void Dependents(const TArray<FString>& Args)
+    {
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogNsSpyglassQuery, Display, TEXT("Usage: Spyglass.Dependents <Plugin>"));
+            return;
+        }
+
+        const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+        const int32 Node = ResolvePlugin(*Query, Args[0]);
+        if (Node == INDEX_NONE)
+        {
+            return;
+        }
+
+        TArray<int32> Nodes;
+        Query->GetTransitiveDependents(Node, Nodes);
+        UE_LOG(LogNsSpyglassQuery, Display, TEXT("%d plugin(s) depend on %s (%d transitively required): %s"),
+            Query->GetTransitiveDependentCount(Node), *Args[0], Query->GetTransitiveDependencyCount(Node), *JoinPath(*Query, Nodes, TEXT(", ")));
+    }
+
+    void TopoOrder(const TArray<FString>& Args)
+    {
+        const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+        UE_LOG(LogNsSpyglassQuery, Display, TEXT("%s"), *JoinPath(*Query, Query->GetTopologicalOrder(), TEXT(", ")));
+    }
+
+    FAutoConsoleCommand WhyCommand(
+        TEXT("Spyglass.Why"),
+        TEXT("Explain why one plugin depends on another. Usage: Spyglass.Why <From> <To> [MaxPaths]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Why));
+
+    FAutoConsoleCommand NeighboursCommand(
+        TEXT("Spyglass.Neighbours"),
+        TEXT("List plugins within K hops. Usage: Spyglass.Neighbours <Plugin> [Hops] [down|up|both]"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Neighbours));
+
+    FAutoConsoleCommand DependentsCommand(
+        TEXT("Spyglass.Dependents"),
+        TEXT("List every plugin that depends on a plugin. Usage: Spyglass.Dependents <Plugin>"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Dependents));
+
+    FAutoConsoleCommand TopoOrderCommand(
+        TEXT("Spyglass.TopoOrder"),
+        TEXT("List enabled plugins with dependencies first"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&TopoOrder));
+}
@@ -0,0 +1,95 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Scripting/NsSpyglassQueryLibrary.h"
+#include "Graph/NsSpyglassGraphQuery.h"
+
+namespace
+{
+    /** Map node indices to plugin names. */
+    TArray<FString> ToNames(const FNsSpyglassGraphQuery& Query, const TArray<int32>& Nodes)
+    {
+        TArray<FString> Names;
+        Names.Reserve(Nodes.Num());
+        for (int32 Node : Nodes)
+        {
+            Names.Add(Query.GetName(Node));
+        }
+        return Names;
+    }
+}
+
+bool UNsSpyglassQueryLibrary::DependsOn(const FString& From, const FString& To)
+{
+    const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+    return Query->DependsOn(Query->FindNode(From), Query->FindNode(To));
+}
+
+TArray<FString> UNsSpyglassQueryLibrary::GetWhyPath(const FString& From, const FString& To)
+{
+    const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+
+    TArray<int32> Path;
+    Query->FindShortestPath(Query->FindNode(From), Query->FindNode(To), Path);
+    return ToNames(*Query, Path);
+}
+
+TArray<FString> UNsSpyglassQueryLibrary::GetAllWhyPaths(const FString& From, const FString& To, const int32 MaxPaths)
+{
+    const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+
+    TArray<TArray<int32>> Paths;
+    Query->FindAllPaths(Query->FindNode(From), Query->FindNode(To), MaxPaths, Paths);
+
+    TArray<FString> Result;
+    for (const TArray<int32>& Path : Paths)
+    {
+        Result.Add(FString::Join(ToNames(*Query, Path), TEXT(" -> ")));
+    }
+    return Result;
+}
+
+TArray<FString> UNsSpyglassQueryLibrary::GetNeighbourhood(const FString& Plugin, const int32 Hops, const bool bDependencies, const bool bDependents)
+{
+    if (!bDependencies && !bDependents)
+    {
+        return TArray<FString>();
+    }
+
+    const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+    const ENsSpyglassQueryDirection Direction = !bDependents ? ENsSpyglassQueryDirection::Down
+        : !bDependencies ? ENsSpyglassQueryDirection::Up
+        : ENsSpyglassQueryDirection::Both;
+
+    TArray<int32> Nodes;
+    Query->GetNeighbourhood(Query->FindNode(Plugin), Hops, Direction, Nodes);
+    return ToNames(*Query, Nodes);
+}
+
+TArray<FString> UNsSpyglassQueryLibrary::GetTransitiveDependents(const FString& Plugin)
+{
+    const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+
+    TArray<int32> Nodes;
+    Query->GetTransitiveDependents(Query->FindNode(Plugin), Nodes);
+    return ToNames(*Query, Nodes);
+}
+
+int32 UNsSpyglassQueryLibrary::GetTransitiveDependentCount(const FString& Plugin)
+{
+    const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+    const int32 Node = Query->FindNode(Plugin);
+    return Node != INDEX_NONE ? Query->GetTransitiveDependentCount(Node) : INDEX_NONE;
+}
+
+int32 UNsSpyglassQueryLibrary::GetTransitiveDependencyCount(const FString& Plugin)
+{
+    const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+    const int32 Node = Query->FindNode(Plugin);
+    return Node != INDEX_NONE ? Query->GetTransitiveDependencyCount(Node) : INDEX_NONE;
+}
+
+TArray<FString> UNsSpyglassQueryLibrary::GetTopologicalOrder()
+{
+    const TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query = FNsSpyglassGraphQuery::GetLive();
+    return ToNames(*Query, Query->GetTopologicalOrder());
+}
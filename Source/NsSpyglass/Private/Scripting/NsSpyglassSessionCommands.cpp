@@ -0,0 +1,37 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassSessionReplay.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogNsSpyglassSession, Log, All);
+
+namespace
+{
+    void Replay(const TArray<FString>& Args)
+    {
+        if (Args.Num() < 1)
+        {
+            UE_LOG(LogNsSpyglassSession, Display, TEXT("Usage: Spyglass.Replay <File.nssession>"));
+            return;
+        }
+
+        // Bare file names are looked up in the default session folder
+        FString Path = Args[0];
+        if (FPaths::IsRelative(Path) && !FPaths::FileExists(Path))
+        {
+            Path = FNsSpyglassSession::GetDefaultDirectory() / Path;
+        }
+
+        FString Error;
+        if (!FNsSpyglassSessionReplay::Start(Path, Error))
+        {
+            UE_LOG(LogNsSpyglassSession, Error, TEXT("Could not replay %s: %s"), *Path, *Error);
+        }
+    }
+
+    FAutoConsoleCommand ReplayCommand(
+        TEXT("Spyglass.Replay"),
+        TEXT("Re-run a recorded graph session offscreen and report per-frame solver and paint timings. Usage: Spyglass.Replay <File.nssession>"),
+        FConsoleCommandWithArgsDelegate::CreateStatic(&Replay));
+}
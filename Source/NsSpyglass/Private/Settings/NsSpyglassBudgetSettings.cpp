@@ -0,0 +1,23 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Settings/NsSpyglassBudgetSettings.h"
+
+UNsSpyglassBudgetSettings::UNsSpyglassBudgetSettings()
+    : MaxTransitiveDependencies(0)
+    , MaxDepth(0)
+    , MaxEnabledModules(0)
+    , bForbidCycles(false)
+{
+    CategoryName = FName(TEXTVIEW("Plugins"));
+    SectionName = FName(TEXTVIEW("SpyglassBudgets"));
+}
+
+const UNsSpyglassBudgetSettings* UNsSpyglassBudgetSettings::GetSettings()
+{
+    return GetDefault<UNsSpyglassBudgetSettings>();
+}
+
+FName UNsSpyglassBudgetSettings::GetContainerName() const
+{
+    return FName{TEXTVIEW("Project")};
+}
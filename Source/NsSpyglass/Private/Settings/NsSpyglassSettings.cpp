@@ -6,6 +6,13 @@ UNsSpyglassSettings::UNsSpyglassSettings()
     : Repulsion(1000.f)
     , CenterForce(0.05f)
     , AttractionScale(1.f)
+    , FocusHops(2)
+    , FocusDirection(ENsSpyglassFocusDirection::Both)
+    , bBundleEdges(false)
+    , bShowMinimap(true)
+    , bShowMatrix(false)
+    , bShowStars(true)
+    , StarDensity(1.f)
 {
     CategoryName = FName(TEXTVIEW("Plugins"));
 }
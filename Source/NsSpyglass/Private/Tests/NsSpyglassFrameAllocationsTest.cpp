@@ -0,0 +1,265 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Analysis/NsSpyglassFrameAllocations.h"
+#include "Analysis/NsSpyglassSession.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Graph/NsSpyglassGitHistory.h"
+#include "Graph/NsSpyglassGraphSubsystem.h"
+#include "Input/HittestGrid.h"
+#include "Misc/AutomationTest.h"
+#include "Rendering/DrawElements.h"
+#include "Types/PaintArgs.h"
+#include "Widgets/SNsSpyglassGraphWidget.h"
+#include "Widgets/SWindow.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNsSpyglassFrameAllocationsTest, "NsSpyglass.FrameAllocations", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+namespace
+{
+    /** Size of the synthetic graph: a ring with a chord from every node, enough to exercise every buffer. */
+    constexpr int32 NumTestNodes = 64;
+
+    /** Frames the live graph may take to build and appear, frames run while dragging and frames then sampled. */
+    constexpr int32 MaxBuildFrames = 3000;
+    constexpr int32 WarmupFrames = 60;
+    constexpr int32 SampleFrames = 120;
+
+    /** A one-commit history, shown through the timeline so the view lays it out privately. */
+    FNsSpyglassHistoryPtr MakeTestHistory()
+    {
+        TSharedPtr<FNsSpyglassHistory, ESPMode::ThreadSafe> History = MakeShared<FNsSpyglassHistory, ESPMode::ThreadSafe>();
+        History->IsLocal.Init(true, NumTestNodes);
+        for (int32 i = 0; i < NumTestNodes; ++i)
+        {
+            History->NodeNames.Add(FString::Printf(TEXT("SpyglassTestPlugin%d"), i));
+            History->Ops.Add(FNsSpyglassHistory::PackOp(ENsSpyglassHistoryOp::AddNode, i));
+        }
+        for (int32 i = 0; i < NumTestNodes; ++i)
+        {
+            History->Ops.Add(FNsSpyglassHistory::PackOp(ENsSpyglassHistoryOp::AddEdge, i, (i + 1) % NumTestNodes));
+            History->Ops.Add(FNsSpyglassHistory::PackOp(ENsSpyglassHistoryOp::AddEdge, i, (i * 7 + 3) % NumTestNodes));
+        }
+
+        FNsSpyglassHistoryCommit& Commit = History->Commits.AddDefaulted_GetRef();
+        Commit.Summary = TEXT("Frame allocation test graph");
+        History->OpStart = { 0, History->Ops.Num() };
+        return History;
+    }
+
+    /** An offscreen view painted frame by frame, with the shared simulation ticked alongside it. */
+    struct FViewHarness
+    {
+        const FVector2D ViewSize{ 1280.0, 720.0 };
+        const float Delta = 1.f / 60.f;
+
+        TSharedRef<SNsSpyglassGraphWidget> Widget = SNew(SNsSpyglassGraphWidget);
+        TSharedRef<SWindow> Window = SNew(SWindow).ClientSize(ViewSize);
+        FSlateWindowElementList Elements{ Window };
+        FHittestGrid HittestGrid;
+        FGeometry Geometry = FGeometry::MakeRoot(ViewSize, FSlateLayoutTransform(1.f));
+        FSlateRect CullingRect{ FVector2D::ZeroVector, ViewSize };
+        double Time = 0.0;
+
+        /** Drag state: the node held and where the cursor went down. */
+        int32 DraggedNode = INDEX_NONE;
+        FVector2D DragOrigin = FVector2D::ZeroVector;
+
+        void RunFrame()
+        {
+            Time += Delta;
+
+            // Model batches are published from the task graph, which nothing else pumps during a test
+            FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+            UNsSpyglassGraphSubsystem::Get().Tick(Delta);
+
+            // Keep the held node moving so neither the private nor the shared solver settles
+            if (DraggedNode != INDEX_NONE)
+            {
+                const double Angle = Time * 2.0;
+                SendMouse(DragOrigin + FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * 40.0, EKeys::Invalid);
+            }
+
+            Widget->Tick(Geometry, Time, Delta);
+            Elements.ResetElementList();
+            const FPaintArgs Args(nullptr, HittestGrid, FVector2D::ZeroVector, Time, Delta);
+            Widget->OnPaint(Args, Geometry, CullingRect, Elements, 0, FWidgetStyle(), true);
+            FNsSpyglassFrameAllocations::EndFrame();
+        }
+
+        /** Press on a fully shown node other than the first, which is often the root. False when there is none. */
+        bool BeginDrag()
+        {
+            const TArray<FPluginNode>& Nodes = Widget->GetNodes();
+            for (const int32 i : Widget->GetVisibleNodes())
+            {
+                if (i > 0 && Nodes[i].bActive && Nodes[i].AppearAlpha >= 1.f)
+                {
+                    DragOrigin = ViewSize * 0.5 + Widget->GetViewOffset() + Nodes[i].Position * Widget->GetZoomAmount();
+                    SendMouse(DragOrigin, EKeys::LeftMouseButton);
+                    DraggedNode = i;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void EndDrag()
+        {
+            if (DraggedNode != INDEX_NONE)
+            {
+                DraggedNode = INDEX_NONE;
+                SendMouse(DragOrigin, EKeys::LeftMouseButton, true);
+            }
+        }
+
+        /** A press when Button is set, a release when bUp is, a move otherwise. */
+        void SendMouse(const FVector2D& Pos, const FKey& Button, const bool bUp = false)
+        {
+            const FPointerEvent Event(0, Pos, Pos, Button.IsValid() ? TSet<FKey>{ Button } : TSet<FKey>{ EKeys::LeftMouseButton }, Button, 0.f, FModifierKeysState());
+            if (!Button.IsValid())
+            {
+                Widget->OnMouseMove(Geometry, Event);
+            }
+            else if (bUp)
+            {
+                Widget->OnMouseButtonUp(Geometry, Event);
+            }
+            else
+            {
+                Widget->OnMouseButtonDown(Geometry, Event);
+            }
+        }
+
+        /** Whether every node of the view has finished its intro fade. */
+        bool IsFullyShown() const
+        {
+            const TArray<FPluginNode>& Nodes = Widget->GetNodes();
+            return Nodes.Num() > 1 && !Nodes.ContainsByPredicate([](const FPluginNode& Node) { return Node.AppearAlpha < 1.f; });
+        }
+    };
+
+    /** Counts of a sampled run. */
+    struct FSampleResult
+    {
+        int32 FramesWithAllocations = 0;
+        uint32 MaxCount = 0;
+        uint64 SlateAllocations = 0;
+        bool bLayoutMoved = false;
+    };
+
+    /** Drag a node while warming up and then while counting allocations over the sampled frames. */
+    bool SampleWhileDragging(FAutomationTestBase& Test, FViewHarness& View, FSampleResult& OutResult)
+    {
+        if (!View.BeginDrag())
+        {
+            Test.AddError(TEXT("No node to drag"));
+            return false;
+        }
+
+        // Scratch buffers, the frame arena and the layout snapshots reach their steady size here
+        for (int32 Frame = 0; Frame < WarmupFrames; ++Frame)
+        {
+            View.RunFrame();
+        }
+
+        // Copied before counting starts, to tell afterwards whether the solver kept moving the other nodes
+        TArray<FVector2D> StartPositions;
+        for (const FPluginNode& Node : View.Widget->GetNodes())
+        {
+            StartPositions.Add(Node.Position);
+        }
+
+        FNsSpyglassFrameAllocations::SetEnabled(true);
+        for (int32 Frame = 0; Frame < SampleFrames; ++Frame)
+        {
+            View.RunFrame();
+            const uint32 Count = FNsSpyglassFrameAllocations::GetLastFrameCount();
+            OutResult.FramesWithAllocations += Count > 0 ? 1 : 0;
+            OutResult.MaxCount = FMath::Max(OutResult.MaxCount, Count);
+            OutResult.SlateAllocations += FNsSpyglassFrameAllocations::GetLastFrameSlateAllocations();
+        }
+        FNsSpyglassFrameAllocations::SetEnabled(false);
+
+        const TArray<FPluginNode>& Nodes = View.Widget->GetNodes();
+        for (int32 i = 0; i < Nodes.Num() && i < StartPositions.Num(); ++i)
+        {
+            OutResult.bLayoutMoved |= i != View.DraggedNode && !Nodes[i].Position.Equals(StartPositions[i], 0.01);
+        }
+        View.EndDrag();
+        return true;
+    }
+
+    void Report(FAutomationTestBase& Test, const TCHAR* Name, const FSampleResult& Result)
+    {
+        Test.TestTrue(FString::Printf(TEXT("%s layout kept moving while sampled"), Name), Result.bLayoutMoved);
+        if (Result.FramesWithAllocations > 0)
+        {
+            Test.AddError(FString::Printf(TEXT("%s: %d of %d frames allocated, at most %u times in one frame"), Name, Result.FramesWithAllocations, SampleFrames, Result.MaxCount));
+        }
+        Test.AddInfo(FString::Printf(TEXT("%s: %.1f Slate element allocations per frame"), Name, static_cast<double>(Result.SlateAllocations) / SampleFrames));
+    }
+}
+
+bool FNsSpyglassFrameAllocationsTest::RunTest(const FString& Parameters)
+{
+    // Bundles are rerouted on a worker whenever the layout moves, and every route is a new result
+    const FNsSpyglassSessionSettings SavedSettings = FNsSpyglassSessionSettings::Capture();
+    FNsSpyglassSessionSettings TestSettings = SavedSettings;
+    TestSettings.bBundleEdges = false;
+    TestSettings.Apply();
+
+    bool bSuccess = true;
+
+    // A timeline view simulates its own layout
+    {
+        FViewHarness View;
+        View.Widget->ShowTimeline(MakeTestHistory());
+        while (!View.IsFullyShown() && View.Time < MaxBuildFrames * View.Delta)
+        {
+            View.RunFrame();
+        }
+
+        FSampleResult Result;
+        bSuccess &= SampleWhileDragging(*this, View, Result);
+        bSuccess &= TestTrue(TEXT("Private solver ran"), View.Widget->GetLastSolverSeconds() > 0.0);
+        Report(*this, TEXT("Private layout"), Result);
+        bSuccess &= Result.FramesWithAllocations == 0 && Result.bLayoutMoved;
+    }
+
+    // A live view follows the layout the subsystem simulates for every open view
+    {
+        FViewHarness View;
+        UNsSpyglassGraphSubsystem& Graph = UNsSpyglassGraphSubsystem::Get();
+        if (!Graph.IsBuilding() && Graph.GetModel()->Nodes.Num() < 2)
+        {
+            Graph.Rebuild();
+        }
+
+        int32 Frame = 0;
+        while ((Graph.IsBuilding() || View.Widget->GetNodes().Num() != Graph.GetModel()->Nodes.Num() || !View.IsFullyShown()) && Frame++ < MaxBuildFrames)
+        {
+            View.RunFrame();
+            FPlatformProcess::Sleep(0.001f);
+        }
+
+        if (!View.IsFullyShown())
+        {
+            AddError(TEXT("The live graph did not build, or has fewer than two plugins"));
+            bSuccess = false;
+        }
+        else
+        {
+            FSampleResult Result;
+            bSuccess &= SampleWhileDragging(*this, View, Result);
+            Report(*this, TEXT("Shared layout"), Result);
+            bSuccess &= Result.FramesWithAllocations == 0 && Result.bLayoutMoved;
+        }
+    }
+
+    SavedSettings.Apply();
+    return bSuccess;
+}
+
+#endif
@@ -0,0 +1,84 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Widgets/SNsSpyglassCycleListWidget.h"
+#include "Graph/NsSpyglassCycleDetector.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+void SNsSpyglassCycleListWidget::Construct(const FArguments& InArgs)
+{
+    ChildSlot
+    [
+        SNew(SVerticalBox)
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SAssignNew(HeaderText, STextBlock)
+        ]
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SNew(SBox)
+            .MaxDesiredHeight(150.f)
+            [
+                SAssignNew(ListView, SListView<TSharedPtr<FNsSpyglassCycleEntry>>)
+                .ListItemsSource(&Entries)
+                .SelectionMode(ESelectionMode::Single)
+                .OnGenerateRow(this, &SNsSpyglassCycleListWidget::OnGenerateRow)
+                .OnSelectionChanged(this, &SNsSpyglassCycleListWidget::OnSelectionChanged)
+            ]
+        ]
+    ];
+
+    HeaderText->SetText(FText::FromString("Circular dependencies: none"));
+}
+
+void SNsSpyglassCycleListWidget::SetCycles(const TArray<FPluginNode>& Nodes, const FNsSpyglassCycleInfo& CycleInfo)
+{
+    Entries.Reset();
+
+    for (int32 CycleIndex = 0; CycleIndex < CycleInfo.Cycles.Num(); ++CycleIndex)
+    {
+        TArray<FString> Names;
+        for (int32 Member : CycleInfo.Cycles[CycleIndex])
+        {
+            if (Nodes.IsValidIndex(Member))
+            {
+                Names.Add(Nodes[Member].Name);
+            }
+        }
+        Names.Sort();
+
+        TSharedPtr<FNsSpyglassCycleEntry> Entry = MakeShared<FNsSpyglassCycleEntry>();
+        Entry->CycleIndex = CycleIndex;
+        Entry->Label = FString::Join(Names, TEXT(" <-> "));
+        Entries.Add(Entry);
+    }
+
+    HeaderText->SetText(Entries.Num() > 0
+        ? FText::FromString(FString::Printf(TEXT("Circular dependencies: %d"), Entries.Num()))
+        : FText::FromString("Circular dependencies: none"));
+
+    ListView->ClearSelection();
+    ListView->RequestListRefresh();
+}
+
+void SNsSpyglassCycleListWidget::SetOnCycleSelected(FOnCycleSelected InDelegate)
+{
+    OnCycleSelected = InDelegate;
+}
+
+TSharedRef<ITableRow> SNsSpyglassCycleListWidget::OnGenerateRow(TSharedPtr<FNsSpyglassCycleEntry> Item, const TSharedRef<STableViewBase>& OwnerTable) const
+{
+    return SNew(STableRow<TSharedPtr<FNsSpyglassCycleEntry>>, OwnerTable)
+    [
+        SNew(STextBlock)
+        .ColorAndOpacity(FLinearColor(1.f, 0.35f, 0.25f))
+        .AutoWrapText(true)
+        .Text(FText::FromString(Item->Label))
+    ];
+}
+
+void SNsSpyglassCycleListWidget::OnSelectionChanged(TSharedPtr<FNsSpyglassCycleEntry> Item, ESelectInfo::Type SelectInfo)
+{
+    OnCycleSelected.ExecuteIfBound(Item.IsValid() ? Item->CycleIndex : INDEX_NONE);
+}
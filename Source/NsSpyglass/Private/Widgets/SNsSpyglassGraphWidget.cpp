@@ -1,154 +1,562 @@
 // Copyright (C) 2025 nulled.softworks. All rights reserved.
 
 #include "Widgets/SNsSpyglassGraphWidget.h"
+#include "Algo/BinarySearch.h"
+#include "Analysis/NsSpyglassFrameAllocations.h"
+#include "Async/Async.h"
 #include "Brushes/SlateColorBrush.h"
 #include "Brushes/SlateRoundedBoxBrush.h"
+#include "Editor.h"
 #include "Fonts/FontMeasure.h"
 #include "Framework/Application/SlateApplication.h"
+#include "Graph/NsSpyglassForceLayout.h"
+#include "Graph/NsSpyglassLayeredLayout.h"
+#include "Graph/NsSpyglassOverlapRemoval.h"
+#include "Graph/NsSpyglassRadialLayout.h"
 #include "Interfaces/IPluginManager.h"
+#include "Misc/MemStack.h"
 #include "Rendering/DrawElements.h"
+#include "Rendering/SlateRenderer.h"
 #include "Settings/NsSpyglassSettings.h"
 #include "Styling/CoreStyle.h"
 
+/** Color used for edges that belong to a circular dependency. */
+static const FLinearColor CycleEdgeColor(1.f, 0.25f, 0.15f, 1.f);
+
+/** Colors used for content references that are declared or missing in the descriptor. */
+static const FLinearColor ContentEdgeColor(0.2f, 0.8f, 0.9f, 1.f);
+static const FLinearColor UndeclaredContentEdgeColor(1.f, 0.2f, 0.9f, 1.f);
+
+// Source include edge colors
+static const FLinearColor IncludeEdgeColor(0.9f, 0.8f, 0.4f, 1.f);
+static const FLinearColor UndeclaredIncludeEdgeColor(1.f, 0.45f, 0.1f, 1.f);
+
+/** Outline color for plugins reported as unused. */
+static const FLinearColor UnusedNodeColor(1.f, 0.85f, 0.1f, 0.8f);
+
+/** Outline colors of plugins a what-if scenario disables, breaks or orphans. */
+static const FLinearColor WhatIfDisabledColor(0.55f, 0.55f, 0.55f, 1.f);
+static const FLinearColor WhatIfBrokenColor(1.f, 0.35f, 0.2f, 1.f);
+static const FLinearColor WhatIfOrphanedColor(1.f, 0.6f, 0.15f, 1.f);
+
+/** Node colors at the cold and hot end of the compile time heat. */
+static const FLinearColor BuildHeatColdColor(0.2f, 0.3f, 0.9f, 1.f);
+static const FLinearColor BuildHeatHotColor(1.f, 0.2f, 0.05f, 1.f);
+
+/** Color of the dependency chain between two selected nodes. */
+static const FLinearColor SelectedPathColor(0.35f, 0.75f, 1.f, 1.f);
+
+/** Color of bundled edges. Overlapping bundles add up, so each one stays faint. */
+static const FLinearColor BundledEdgeColor(0.5f, 0.5f, 0.5f, 0.08f);
+
+/** Seconds the layout must stay still to count as settled. */
+static constexpr float LayoutSettleSeconds = 0.5f;
+
+/** How far nodes may drift before edge bundles are dropped. */
+static constexpr float BundleDriftTolerance = 2.f;
+
+/** Zoom range of the view. */
+static constexpr float MinZoom = 0.2f;
+static constexpr float MaxZoom = 10.f;
+
+/** Screen area of one star at density 1, as the side of a square cell. */
+static constexpr float StarCellSize = 180.f;
+
+/** Thickest edge line. Lines are batched per whole thickness up to it. */
+static constexpr int32 MaxLineThickness = 6;
+
+/** Upper bound on stars per frame, whatever the density and view size. */
+static constexpr int32 MaxStars = 4096;
+
+/** Seconds a timeline plugin or edge takes to fade in or out. */
+static constexpr float TimelineFadeSeconds = 0.35f;
+
+/** Range of a star's fade in and out cycle in seconds. */
+static constexpr float MinStarPeriod = 3.f;
+static constexpr float MaxStarPeriod = 8.f;
+
+/** Integer hash with good avalanche, used to derive every star property. */
+static uint32 HashStar(uint32 Value)
+{
+    Value ^= Value >> 16;
+    Value *= 0x7feb352dU;
+    Value ^= Value >> 15;
+    Value *= 0x846ca68bU;
+    Value ^= Value >> 16;
+    return Value;
+}
+
+/** Uniform value in [0, 1) from a hash and a salt selecting the property. */
+static float HashStarUnit(uint32 Hash, uint32 Salt)
+{
+    return static_cast<float>(HashStar(Hash + Salt * 0x9e3779b9U) >> 8) / static_cast<float>(1 << 24);
+}
+
+/** Colors used for nodes and edges when comparing snapshots. */
+static const FLinearColor DiffAddedColor(0.2f, 0.9f, 0.3f, 1.f);
+static const FLinearColor DiffRemovedColor(1.f, 0.25f, 0.25f, 1.f);
+static const FLinearColor DiffChangedColor(1.f, 0.75f, 0.2f, 1.f);
+
+/** Color of timeline plugins that are only referenced, without a descriptor in the repository. */
+static const FLinearColor TimelineExternalColor(0.5f, 0.5f, 0.5f, 1.f);
+
+/** Key of a directed edge in the timeline fades. */
+static uint64 TimelineEdgeKey(const int32 From, const int32 To)
+{
+    return (static_cast<uint64>(static_cast<uint32>(From)) << 32) | static_cast<uint32>(To);
+}
+
 SNsSpyglassGraphWidget::SNsSpyglassGraphWidget()
     : ViewOffset(FVector2D::ZeroVector)
     , LastMousePos(FVector2D::ZeroVector)
+    , Random(static_cast<int32>(FPlatformTime::Cycles()))
+{
+    StarSeed = Random.GetUnsignedInt();
+}
+
+SNsSpyglassGraphWidget::~SNsSpyglassGraphWidget()
 {
+    // The tab can outlive the editor subsystems during shutdown
+    if (UNsSpyglassGraphSubsystem* Graph = GEditor ? GEditor->GetEditorSubsystem<UNsSpyglassGraphSubsystem>() : nullptr)
+    {
+        Graph->OnModelChanged().RemoveAll(this);
+        Graph->RemoveViewer();
+    }
 }
 
 void SNsSpyglassGraphWidget::Construct(const FArguments& InArgs)
 {
+    UNsSpyglassGraphSubsystem& Graph = UNsSpyglassGraphSubsystem::Get();
+    Graph.AddViewer();
+    Graph.OnModelChanged().AddSP(this, &SNsSpyglassGraphWidget::HandleModelChanged);
+
     RecenterView();
-    BuildNodes(FVector2D(960.f, 540.f));
 
-    // Start intro animation (first time only)
-    bIntroRunning = true;
-    IntroElapsed = 0.f;
+    // Nodes are picked up from Tick one batch at a time, so the tab paints before much of the graph is copied
+}
+
+void SNsSpyglassGraphWidget::BuildNodes(const FNsSpyglassGraphModel& Model)
+{
+    RootIndex = INDEX_NONE;
 
-    // Default: everything hidden/inactive, will appear over time
-    for (FPluginNode& N : Nodes)
+    // The scan, cycles and query are shared, only view state is per widget
+    Nodes = Model.Nodes;
+    CycleInfo = Model.CycleInfo;
+    PluginSetHash = Model.PluginSetHash;
+    ++NodesRevision;
+    Query = Model.Query;
+    ModelVersion = Model.Version;
+    ModelBuildId = Model.BuildId;
+
+    // A view opened after the simulation started joins it where it is
+    const FNsSpyglassGraphLayoutRef Layout = UNsSpyglassGraphSubsystem::Get().GetLayout();
+    if (Layout->ModelVersion == ModelVersion && Layout->Positions.Num() == Nodes.Num())
     {
-        N.bActive = false;
-        N.AppearAlpha = 0.f;
-        N.Velocity = FVector2D::ZeroVector;
+        for (int32 i = 0; i < Nodes.Num(); ++i)
+        {
+            Nodes[i].Position = Layout->Positions[i];
+        }
     }
 
-    // Assign delays (nice: high-degree nodes appear first)
-    TArray<int32> Order;
-    Order.Reserve(Nodes.Num());
-    for (int32 i = 0; i < Nodes.Num(); ++i) Order.Add(i);
+    SearchIndex.Build(Nodes);
+    ApplyFilter();
+}
 
-    Order.Sort([this](int32 A, int32 B)
+void SNsSpyglassGraphWidget::AppendNodes(const FNsSpyglassGraphModel& Model)
+{
+    // Indices stay valid within a build, the nodes on screen only gain links to the new ones
+    const int32 NumShown = Nodes.Num();
+    for (int32 i = 0; i < NumShown; ++i)
     {
-        return Nodes[A].Links.Num() > Nodes[B].Links.Num();
-    });
+        Nodes[i].Links = Model.Nodes[i].Links;
+        Nodes[i].Dependencies = Model.Nodes[i].Dependencies;
+        Nodes[i].Dependents = Model.Nodes[i].Dependents;
+    }
+    Nodes.Reserve(Model.Nodes.Num());
+    for (int32 i = NumShown; i < Model.Nodes.Num(); ++i)
+    {
+        Nodes.Add(Model.Nodes[i]);
+    }
+
+    CycleInfo = Model.CycleInfo;
+    PluginSetHash = Model.PluginSetHash;
+    ++NodesRevision;
+    Query = Model.Query;
+    ModelVersion = Model.Version;
+
+    RevealNodes(NumShown);
+    SearchIndex.Build(Nodes);
+    ApplyFilter();
+}
+
+void SNsSpyglassGraphWidget::RevealNodes(const int32 FirstNode)
+{
+    if (!bIntroRunning)
+    {
+        bIntroRunning = true;
+        IntroElapsed = 0.f;
+        NextAppearDelay = 0.f;
+    }
 
-    for (int32 k = 0; k < Order.Num(); ++k)
+    // Nodes arrive most connected first, so the stagger brings in hubs before their leaves.
+    // A late batch queues behind the nodes still waiting, but never starts in the past.
+    float Delay = FMath::Max(NextAppearDelay, IntroElapsed);
+    for (int32 i = FirstNode; i < Nodes.Num(); ++i)
     {
-        Nodes[Order[k]].AppearDelay = k * IntroStagger;
+        Nodes[i].bActive = false;
+        Nodes[i].AppearAlpha = 0.f;
+        Nodes[i].Velocity = FVector2D::ZeroVector;
+        Nodes[i].AppearDelay = Delay;
+        Delay += IntroStagger;
     }
+    NextAppearDelay = Delay;
 }
 
-void SNsSpyglassGraphWidget::BuildNodes(const FVector2D& ViewSize) const
+void SNsSpyglassGraphWidget::ApplyFilter() const
 {
-    Nodes.Reset();
-    RootIndex = INDEX_NONE;
+    SearchIndex.Search(FilterText, VisibleMask);
+    if (FocusNode != INDEX_NONE && FocusMask.Num() == VisibleMask.Num())
+    {
+        VisibleMask.CombineWithBitwiseAND(FocusMask, EBitwiseOperatorFlags::MaintainSize);
+    }
+    if (bShippingView && ShippingResult.Ships.Num() == VisibleMask.Num())
+    {
+        VisibleMask.CombineWithBitwiseAND(ShippingResult.Ships, EBitwiseOperatorFlags::MaintainSize);
+    }
+    if (History.IsValid() && TimelineShown.Num() == VisibleMask.Num())
+    {
+        FilterMask = VisibleMask;
+        VisibleMask.CombineWithBitwiseAND(TimelineShown, EBitwiseOperatorFlags::MaintainSize);
+    }
 
-    const TArray<TSharedRef<IPlugin>>& Plugins = IPluginManager::Get().GetEnabledPlugins();
+    bLocalSettled = false;
 
-    TMap<FString, int32> NameToIndex;
-    TMap<FString, FLinearColor> CategoryColors;
+    VisibleNodes.Reset();
+    for (TConstSetBitIterator<> It(VisibleMask); It; ++It)
+    {
+        VisibleNodes.Add(It.GetIndex());
+    }
 
-    // Create nodes for plugins
-    for (const TSharedRef<IPlugin>& Plugin : Plugins)
+    if (HoveredNode != INDEX_NONE && (!VisibleMask.IsValidIndex(HoveredNode) || !VisibleMask[HoveredNode]))
     {
-        FPluginNode Node;
-        Node.Name = Plugin->GetName();
-        Node.Plugin = Plugin;
-        Node.bIsEngine = Plugin->GetLoadedFrom() == EPluginLoadedFrom::Engine;
-        Node.Position = FVector2D::ZeroVector;
-        Node.bFixed = false;
+        HoveredNode = INDEX_NONE;
+        OnNodeHovered.ExecuteIfBound(nullptr);
+    }
+}
+
+void SNsSpyglassGraphWidget::SetTimelineShown(const int32 NodeIndex, const bool bShown)
+{
+    TimelineShown[NodeIndex] = bShown;
+    bLocalSettled = false;
 
-        const FPluginDescriptor& Desc = Plugin->GetDescriptor();
-        const FString Category = Desc.Category.IsEmpty() ? TEXT("Misc") : Desc.Category;
+    // The other filters do not change with the commit, so only this node's bit can
+    if (!VisibleMask.IsValidIndex(NodeIndex) || !FilterMask.IsValidIndex(NodeIndex))
+    {
+        return;
+    }
+    const bool bVisible = bShown && FilterMask[NodeIndex];
+    if (VisibleMask[NodeIndex] == bVisible)
+    {
+        return;
+    }
 
-        FLinearColor* Existing = CategoryColors.Find(Category);
-        if (!Existing)
+    VisibleMask[NodeIndex] = bVisible;
+    if (bVisible)
+    {
+        VisibleNodes.Insert(NodeIndex, Algo::LowerBound(VisibleNodes, NodeIndex));
+    }
+    else
+    {
+        VisibleNodes.RemoveSingle(NodeIndex);
+        if (HoveredNode == NodeIndex)
         {
-            const int32 Index = CategoryColors.Num();
-            const float Hue = FMath::Fmod(static_cast<float>(Index) * 50.f, 360.f);
-            FLinearColor NewColor = FLinearColor::MakeFromHSV8(static_cast<uint8>(Hue), 160, 255);
-            NewColor.A = 0.1f;
-            CategoryColors.Add(Category, NewColor);
-            Existing = CategoryColors.Find(Category);
+            HoveredNode = INDEX_NONE;
+            OnNodeHovered.ExecuteIfBound(nullptr);
         }
-        Node.Color = *Existing;
-        Node.Color.A = 0.1f;
+    }
+}
+
+void SNsSpyglassGraphWidget::SetFilter(const FString& InFilterText)
+{
+    FNsSpyglassSessionEvent Event;
+    Event.Type = ENsSpyglassSessionEventType::Filter;
+    Event.Text = InFilterText;
+    RecordEvent(MoveTemp(Event));
+
+    FilterText = InFilterText;
+    ApplyFilter();
+    RefreshLayout();
+}
+
+void SNsSpyglassGraphWidget::EnterFocus(const int32 NodeIndex)
+{
+    if (!Nodes.IsValidIndex(NodeIndex) || !Query.IsValid())
+    {
+        return;
+    }
 
-        int32 Idx = Nodes.Add(Node);
-        NameToIndex.Add(Node.Name, Idx);
+    // Refocusing keeps the positions saved when focus was first entered
+    if (FocusNode == INDEX_NONE)
+    {
+        SavedPositions.SetNumUninitialized(Nodes.Num());
+        for (int32 i = 0; i < Nodes.Num(); ++i)
+        {
+            SavedPositions[i] = Nodes[i].Position;
+        }
+        SavedRootIndex = RootIndex;
     }
 
-    // Fill in links
+    const UNsSpyglassSettings* Settings = UNsSpyglassSettings::GetSettings();
+    const bool bDown = Settings->FocusDirection != ENsSpyglassFocusDirection::Dependents;
+    const bool bUp = Settings->FocusDirection != ENsSpyglassFocusDirection::Dependencies;
+
+    FocusNode = NodeIndex;
+    FocusMask.Init(false, Nodes.Num());
+    FocusMask[NodeIndex] = true;
+
+    TArray<FVector2D> Targets;
+    Targets.SetNumUninitialized(Nodes.Num());
     for (int32 i = 0; i < Nodes.Num(); ++i)
     {
-        const TSharedRef<IPlugin>& Plugin = Plugins[i];
-        const FPluginDescriptor& Desc = Plugin->GetDescriptor();
-        for (const FPluginReferenceDescriptor& Ref : Desc.Plugins)
+        Targets[i] = Nodes[i].Position;
+    }
+    Targets[NodeIndex] = FVector2D::ZeroVector;
+
+    // Rings by hop count, dependencies below the focused node and dependents above it
+    const auto PlaceRings = [this, &Targets](const TArray<int32>& Ring, const TArray<int32>& Distances, const float StartAngle, const float Sweep)
+    {
+        for (int32 Begin = 0; Begin < Ring.Num();)
         {
-            if (Ref.bEnabled)
+            int32 End = Begin;
+            while (End < Ring.Num() && Distances[End] == Distances[Begin])
             {
-                if (int32* DepIdx = NameToIndex.Find(Ref.Name))
-                {
-                    Nodes[i].Links.AddUnique(*DepIdx);
-                    Nodes[*DepIdx].Links.AddUnique(i); // undirected for layout
+                ++End;
+            }
 
-                    // Store directed dependency
-                    Nodes[i].Dependencies.AddUnique(*DepIdx);
-                    Nodes[*DepIdx].Dependents.AddUnique(i);
+            const int32 Count = End - Begin;
+            const float Radius = 160.f * static_cast<float>(Distances[Begin]);
+            for (int32 k = 0; k < Count; ++k)
+            {
+                const int32 Node = Ring[Begin + k];
+                if (FocusMask[Node])
+                {
+                    continue;
                 }
+
+                const float Angle = StartAngle + Sweep * (static_cast<float>(k) + 0.5f) / static_cast<float>(Count);
+                Targets[Node] = FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * Radius;
+                FocusMask[Node] = true;
             }
+            Begin = End;
         }
+    };
+
+    TArray<int32> Ring;
+    TArray<int32> Distances;
+    const float Sweep = bDown && bUp ? PI : 2.f * PI;
+    if (bDown)
+    {
+        Query->GetNeighbourhood(NodeIndex, Settings->FocusHops, ENsSpyglassQueryDirection::Down, Ring, &Distances);
+        PlaceRings(Ring, Distances, 0.f, Sweep);
+    }
+    if (bUp)
+    {
+        Query->GetNeighbourhood(NodeIndex, Settings->FocusHops, ENsSpyglassQueryDirection::Up, Ring, &Distances);
+        PlaceRings(Ring, Distances, bDown ? PI : 0.f, Sweep);
+    }
+
+    for (FPluginNode& Node : Nodes)
+    {
+        Node.Velocity = FVector2D::ZeroVector;
+    }
+
+    RootIndex = NodeIndex;
+    ClearSelection();
+    RecenterView();
+    ApplyFilter();
+
+    // Layered and radial views lay the neighbourhood out their own way
+    if (LayoutMode != ENsSpyglassLayoutMode::Force)
+    {
+        RefreshLayout();
+    }
+    else
+    {
+        BeginTransition(MoveTemp(Targets));
+    }
+}
+
+void SNsSpyglassGraphWidget::ExitFocus()
+{
+    if (FocusNode == INDEX_NONE)
+    {
+        return;
     }
 
-    // Arrange nodes in a circle to avoid overlapping at the origin
-    if (Nodes.Num() > 1)
+    if (SavedPositions.Num() == Nodes.Num())
     {
-        constexpr float Radius = 200.f;
-        const float Step = 2.f * PI / static_cast<float>(Nodes.Num());
         for (int32 i = 0; i < Nodes.Num(); ++i)
         {
-            const float Angle = Step * static_cast<float>(i - 1);
-            Nodes[i].Position = FVector2D(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius);
+            Nodes[i].Position = SavedPositions[i];
+            Nodes[i].Velocity = FVector2D::ZeroVector;
+        }
+    }
+
+    RootIndex = SavedRootIndex;
+    ResetFocus();
+    ApplyFilter();
+    RefreshLayout();
+}
+
+void SNsSpyglassGraphWidget::ResetFocus()
+{
+    FocusNode = INDEX_NONE;
+    FocusMask.Empty();
+    SavedPositions.Reset();
+    TransitionStart.Reset();
+    TransitionTarget.Reset();
+    TransitionBlend = 1.f;
+}
+
+void SNsSpyglassGraphWidget::BeginTransition(TArray<FVector2D>&& Targets)
+{
+    TransitionStart.SetNumUninitialized(Nodes.Num());
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        TransitionStart[i] = Nodes[i].Position;
+    }
+    TransitionTarget = MoveTemp(Targets);
+    TransitionBlend = 0.f;
+    bLocalSettled = false;
+}
+
+void SNsSpyglassGraphWidget::SetLayoutMode(const ENsSpyglassLayoutMode InMode)
+{
+    if (LayoutMode == InMode)
+    {
+        return;
+    }
+
+    FNsSpyglassSessionEvent Event;
+    Event.Type = ENsSpyglassSessionEventType::LayoutMode;
+    Event.Button = static_cast<uint8>(InMode);
+    RecordEvent(MoveTemp(Event));
+
+    LayoutMode = InMode;
+    ++LayeredGeneration;
+
+    if (LayoutMode != ENsSpyglassLayoutMode::Force)
+    {
+        RefreshLayout();
+        return;
+    }
+
+    // Ease back into the shared simulation instead of jumping to it
+    if (UsesSharedLayout())
+    {
+        const FNsSpyglassGraphLayoutRef Layout = UNsSpyglassGraphSubsystem::Get().GetLayout();
+        if (Layout->ModelVersion == ModelVersion && Layout->Positions.Num() == Nodes.Num())
+        {
+            BeginTransition(TArray<FVector2D>(Layout->Positions));
         }
     }
 }
 
-void SNsSpyglassGraphWidget::InitStars(const FVector2D& ViewSize) const
+void SNsSpyglassGraphWidget::RequestLayeredLayout()
 {
-    if (Stars.Num() == 0 || !ViewSize.Equals(StarsViewSize))
+    const uint32 Generation = ++LayeredGeneration;
+
+    // The layout runs once per request, so the view costs nothing per frame once it arrived
+    TWeakPtr<SNsSpyglassGraphWidget> WeakThis = SharedThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Generation, NodesCopy = Nodes, Subset = VisibleNodes]()
+    {
+        TArray<FVector2D> Positions;
+        FNsSpyglassLayeredLayout::Compute(NodesCopy, Subset, Positions);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Generation, Positions = MoveTemp(Positions)]() mutable
+        {
+            const TSharedPtr<SNsSpyglassGraphWidget> This = WeakThis.Pin();
+            if (This.IsValid() && This->LayoutMode == ENsSpyglassLayoutMode::Layered && This->LayeredGeneration == Generation && Positions.Num() == This->Nodes.Num())
+            {
+                // Nodes outside the subset keep their place
+                for (int32 i = 0; i < Positions.Num(); ++i)
+                {
+                    if (!This->VisibleMask[i])
+                    {
+                        Positions[i] = This->Nodes[i].Position;
+                    }
+                }
+                This->BeginTransition(MoveTemp(Positions));
+            }
+        });
+    });
+}
+
+void SNsSpyglassGraphWidget::ApplyRadialLayout()
+{
+    if (VisibleNodes.Num() == 0)
+    {
+        return;
+    }
+
+    // Without a root, start from the most connected visible plugin
+    if (!Nodes.IsValidIndex(RootIndex) || !VisibleMask[RootIndex])
+    {
+        RootIndex = VisibleNodes[0];
+        for (const int32 i : VisibleNodes)
+        {
+            RootIndex = Nodes[i].Links.Num() > Nodes[RootIndex].Links.Num() ? i : RootIndex;
+        }
+    }
+
+    const UNsSpyglassSettings* Settings = UNsSpyglassSettings::GetSettings();
+    const bool bDown = Settings->FocusDirection != ENsSpyglassFocusDirection::Dependents;
+    const bool bUp = Settings->FocusDirection != ENsSpyglassFocusDirection::Dependencies;
+
+    // Direct placement is cheap enough for the game thread even on large graphs
+    TArray<FVector2D> Positions;
+    FNsSpyglassRadialLayout::Compute(Nodes, VisibleNodes, RootIndex, bDown, bUp, Positions);
+    for (int32 i = 0; i < Positions.Num(); ++i)
     {
-        StarsViewSize = ViewSize;
-        Stars.Empty();
-        const int32 NumStars = 250;
-        for (int32 i = 0; i < NumStars; ++i)
+        if (!VisibleMask[i])
         {
-            FBackgroundStar Star;
-            Star.Position.X = FMath::FRandRange(-ViewSize.X, ViewSize.X);
-            Star.Position.Y = FMath::FRandRange(-ViewSize.Y, ViewSize.Y);
-            Star.Alpha = 0.f;
-            Star.TargetAlpha = FMath::FRandRange(0.2f, 1.f);
-            Star.FadeSpeed = FMath::FRandRange(0.5f, 1.5f);
-            Stars.Add(Star);
+            Positions[i] = Nodes[i].Position;
         }
     }
+    BeginTransition(MoveTemp(Positions));
+}
+
+void SNsSpyglassGraphWidget::RefreshLayout()
+{
+    if (LayoutMode == ENsSpyglassLayoutMode::Layered)
+    {
+        RequestLayeredLayout();
+    }
+    else if (LayoutMode == ENsSpyglassLayoutMode::Radial)
+    {
+        ApplyRadialLayout();
+    }
+}
+
+void SNsSpyglassGraphWidget::SetRadialRoot(const int32 NodeIndex)
+{
+    if (!Nodes.IsValidIndex(NodeIndex) || NodeIndex == RootIndex)
+    {
+        return;
+    }
+
+    RootIndex = NodeIndex;
+    if (LayoutMode == ENsSpyglassLayoutMode::Radial)
+    {
+        ApplyRadialLayout();
+    }
 }
 
 int32 SNsSpyglassGraphWidget::HitTestNode(const FVector2D& LocalPos, const FVector2D& ViewSize) const
 {
     const FVector2D Center = ViewSize * 0.5f;
 
-    for (int32 i = 0; i < Nodes.Num(); ++i)
+    for (int32 i : VisibleNodes)
     {
         if (!Nodes[i].bActive || Nodes[i].AppearAlpha < 0.15f)
         {
@@ -169,136 +577,391 @@ int32 SNsSpyglassGraphWidget::HitTestNode(const FVector2D& LocalPos, const FVect
     return INDEX_NONE;
 }
 
-int32 SNsSpyglassGraphWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+int32 SNsSpyglassGraphWidget::PaintStars(const FPaintArgs& Args, const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 LayerId) const
 {
-    if (Nodes.Num() == 0)
+    const UNsSpyglassSettings* Settings = UNsSpyglassSettings::GetSettings();
+    if (!Settings->bShowStars || Settings->StarDensity <= 0.f || !FSlateApplication::IsInitialized())
     {
-        BuildNodes(AllottedGeometry.GetLocalSize());
+        return LayerId;
     }
 
-    InitStars(AllottedGeometry.GetLocalSize());
-
-    const FVector2D Center = AllottedGeometry.GetLocalSize() * 0.5f;
-
-    const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("WhiteBrush");
-    const FVector2D StarOffset = ViewOffset * 0.1f;
-    for (const FBackgroundStar& Star : Stars)
+    // Star space is tiled into cells holding one star each. The cell and the cycle it is in hash to
+    // its position and brightness, so nothing is simulated and a star moves once it faded out.
+    const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+    const FVector2D Origin = LocalSize * 0.5f + ViewOffset * 0.1f;
+    const float CellSize = StarCellSize / FMath::Sqrt(Settings->StarDensity);
+
+    const int32 MinX = FMath::FloorToInt((0.f - Origin.X) / CellSize);
+    const int32 MinY = FMath::FloorToInt((0.f - Origin.Y) / CellSize);
+    const int32 MaxX = FMath::FloorToInt((LocalSize.X - Origin.X) / CellSize);
+    const int32 MaxY = FMath::FloorToInt((LocalSize.Y - Origin.Y) / CellSize);
+    const int64 NumCells = static_cast<int64>(MaxX - MinX + 1) * (MaxY - MinY + 1);
+    if (NumCells <= 0 || NumCells > MaxStars)
     {
-        const FVector2D DrawPos = Center + StarOffset + Star.Position - FVector2D(1.f, 1.f);
-        FSlateDrawElement::MakeBox(
-            OutDrawElements,
-            LayerId,
-            AllottedGeometry.ToPaintGeometry(FVector2D(2.f, 2.f), FSlateLayoutTransform(DrawPos)),
-            WhiteBrush,
-            ESlateDrawEffect::None,
-            FLinearColor(1.f, 1.f, 1.f, Star.Alpha * 0.5f)
-        );
+        return LayerId;
     }
-    ++LayerId;
 
-    TSet<int32> Downstream;
-    TSet<int32> Upstream;
+    StarVertices.Reset();
+    StarIndices.Reset();
+    StarVertices.Reserve(static_cast<int32>(NumCells) * 4);
+    StarIndices.Reserve(static_cast<int32>(NumCells) * 6);
+
+    const FSlateRenderTransform& Transform = AllottedGeometry.GetAccumulatedRenderTransform();
+    const double Time = Args.GetCurrentTime();
 
-    if (HoveredNode != INDEX_NONE)
+    for (int32 Y = MinY; Y <= MaxY; ++Y)
     {
-        // Downstream dependencies
-        TArray<int32> Stack = Nodes[HoveredNode].Dependencies;
-        TSet<int32> Visited;
-        for (int32 Dep : Stack)
+        for (int32 X = MinX; X <= MaxX; ++X)
         {
-            Downstream.Add(Dep);
-            Visited.Add(Dep);
-        }
-        while (Stack.Num() > 0)
-        {
-            int32 Cur = Stack.Pop();
-            for (int32 Dep : Nodes[Cur].Dependencies)
+            const uint32 CellHash = HashStar(static_cast<uint32>(X) * 73856093U ^ static_cast<uint32>(Y) * 19349663U ^ StarSeed);
+            const float Period = FMath::Lerp(MinStarPeriod, MaxStarPeriod, HashStarUnit(CellHash, 0));
+            const double Cycles = Time / Period + HashStarUnit(CellHash, 1);
+            const double Cycle = FMath::FloorToDouble(Cycles);
+
+            const uint32 StarHash = HashStar(CellHash ^ static_cast<uint32>(static_cast<int64>(Cycle)));
+            const float Fade = FMath::Sin(static_cast<float>(Cycles - Cycle) * PI);
+            const float Alpha = FMath::Lerp(0.2f, 1.f, HashStarUnit(StarHash, 2)) * Fade * Fade * 0.5f;
+            if (Alpha < 0.01f)
             {
-                if (!Visited.Contains(Dep))
-                {
-                    Downstream.Add(Dep);
-                    Visited.Add(Dep);
-                    Stack.Add(Dep);
-                }
+                continue;
             }
-        }
 
-        // Upstream dependents
-        Stack = Nodes[HoveredNode].Dependents;
-        Visited.Empty();
-        for (int32 Dep : Stack)
-        {
-            Upstream.Add(Dep);
-            Visited.Add(Dep);
+            const FVector2f Position(
+                static_cast<float>(Origin.X + (X + HashStarUnit(StarHash, 3)) * CellSize),
+                static_cast<float>(Origin.Y + (Y + HashStarUnit(StarHash, 4)) * CellSize));
+            const FColor Color = FLinearColor(1.f, 1.f, 1.f, Alpha).ToFColor(true);
+
+            const SlateIndex First = static_cast<SlateIndex>(StarVertices.Num());
+            StarVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(Transform, Position + FVector2f(-1.f, -1.f), FVector2f(0.f, 0.f), Color));
+            StarVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(Transform, Position + FVector2f(1.f, -1.f), FVector2f(1.f, 0.f), Color));
+            StarVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(Transform, Position + FVector2f(1.f, 1.f), FVector2f(1.f, 1.f), Color));
+            StarVertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(Transform, Position + FVector2f(-1.f, 1.f), FVector2f(0.f, 1.f), Color));
+            StarIndices.Append({ First, static_cast<SlateIndex>(First + 1), static_cast<SlateIndex>(First + 2), First, static_cast<SlateIndex>(First + 2), static_cast<SlateIndex>(First + 3) });
         }
-        while (Stack.Num() > 0)
+    }
+
+    if (StarIndices.Num() > 0)
+    {
+        const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("WhiteBrush");
+        const FSlateResourceHandle Handle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*WhiteBrush);
+        FNsSpyglassFrameAllocations::FSlateScope SlateElements;
+        FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, Handle, StarVertices, StarIndices, nullptr, 0, 0);
+    }
+
+    return LayerId + 1;
+}
+
+void SNsSpyglassGraphWidget::UpdateHoverMasks() const
+{
+    if (HoverMaskNode == HoveredNode && HoverMaskRevision == NodesRevision && DownstreamMask.Num() == Nodes.Num())
+    {
+        return;
+    }
+
+    HoverMaskNode = HoveredNode;
+    HoverMaskRevision = NodesRevision;
+    DownstreamMask.Init(false, Nodes.Num());
+    UpstreamMask.Init(false, Nodes.Num());
+    if (!Nodes.IsValidIndex(HoveredNode))
+    {
+        return;
+    }
+
+    FMemMark Mark(FMemStack::Get());
+    TArray<int32, TMemStackAllocator<>> Pending;
+    const auto Walk = [this, &Pending](TBitArray<>& Mask, TArray<int32> FPluginNode::* Links)
+    {
+        Pending.Reset();
+        Pending.Add(HoveredNode);
+        for (int32 Head = 0; Head < Pending.Num(); ++Head)
         {
-            int32 Cur = Stack.Pop();
-            for (int32 Dep : Nodes[Cur].Dependents)
+            for (const int32 Link : Nodes[Pending[Head]].*Links)
             {
-                if (!Visited.Contains(Dep))
+                if (!Mask[Link])
                 {
-                    Upstream.Add(Dep);
-                    Visited.Add(Dep);
-                    Stack.Add(Dep);
+                    Mask[Link] = true;
+                    Pending.Add(Link);
                 }
             }
         }
+    };
+
+    // Downstream dependencies
+    Walk(DownstreamMask, &FPluginNode::Dependencies);
+
+    // Upstream dependents
+    Walk(UpstreamMask, &FPluginNode::Dependents);
 
-        Downstream.Add(HoveredNode);
+    DownstreamMask[HoveredNode] = true;
+}
+
+void SNsSpyglassGraphWidget::UpdateLabels(const FSlateFontInfo& Font) const
+{
+    if (LabelRevision == NodesRevision && Labels.Num() == Nodes.Num())
+    {
+        return;
     }
 
-    TSet<int32> Highlight = Downstream;
-    Highlight.Append(Upstream);
+    LabelRevision = NodesRevision;
+    Labels.SetNum(Nodes.Num());
 
-    // Draw edges with arrowheads pointing to dependencies. Node and text sizes
-    // should follow the current zoom factor so zooming in enlarges them.
-    const float ZoomScale = ZoomAmount;
+    const TSharedRef<FSlateFontMeasure> Measure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
     for (int32 i = 0; i < Nodes.Num(); ++i)
     {
-        const FPluginNode& Node = Nodes[i];
+        const FString& Name = Nodes[i].Name;
+        FNodeLabel& Label = Labels[i];
+        Label.FullSize = Measure->Measure(Name, Font);
+        Label.ShortName.Reset();
+        Label.ShortSize = FVector2D::ZeroVector;
 
-        if (!Node.bActive || Node.AppearAlpha <= 0.01f)
+        if (Name.Len() > 12)
         {
-            continue;
+            for (const TCHAR Ch : Name)
+            {
+                if (FChar::IsUpper(Ch))
+                {
+                    Label.ShortName.AppendChar(Ch);
+                }
+            }
+            if (Label.ShortName.IsEmpty())
+            {
+                Label.ShortName = Name.Left(2).ToUpper();
+            }
+            Label.ShortSize = Measure->Measure(Label.ShortName, Font);
         }
+    }
+}
 
-        const FVector2D NodePos = Center + ViewOffset + Node.Position * ZoomAmount;
-        const float NodeRadius = ((Node.Name == TEXT("Root")) ? 60.f : 40.f) * ZoomScale * 0.5f;
+int32 SNsSpyglassGraphWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+    FNsSpyglassFrameAllocations::FCountScope CountAllocations;
+    const FVector2D Center = AllottedGeometry.GetLocalSize() * 0.5f;
 
-        for (int32 Link : Node.Dependencies)
+    LayerId = PaintStars(Args, AllottedGeometry, OutDrawElements, LayerId);
+
+    // Hover masks, lines and labels live in members that keep their memory, so a settled frame does not allocate
+    UpdateHoverMasks();
+    const auto IsHighlighted = [this](const int32 Node) { return DownstreamMask[Node] || UpstreamMask[Node]; };
+
+    LineBatches.SetNum(MaxLineThickness + 1);
+    for (FLineBatch& Batch : LineBatches)
+    {
+        Batch.Points.Reset();
+        Batch.Colors.Reset();
+    }
+
+    // Every segment joins its batch's polyline through fully transparent hops
+    const auto AddLine = [this](const FVector2D& From, const FVector2D& To, const FLinearColor& Color, const float Thickness)
+    {
+        FLineBatch& Batch = LineBatches[FMath::Clamp(FMath::RoundToInt(Thickness), 1, MaxLineThickness)];
+        const FLinearColor Hidden(Color.R, Color.G, Color.B, 0.f);
+        Batch.Points.Append({ From, From, To, To });
+        Batch.Colors.Append({ Hidden, Color, Color, Hidden });
+    };
+
+    // Content references sit underneath the declared edges
+    if (bShowContentEdges && ContentResult.IsValid())
+    {
+        for (const FNsSpyglassContentEdge& Edge : ContentResult->Edges)
         {
-            if (!Nodes.IsValidIndex(Link) || i == Link)
+            if (!Nodes.IsValidIndex(Edge.From) || !Nodes.IsValidIndex(Edge.To) || !VisibleMask[Edge.From] || !VisibleMask[Edge.To])
             {
                 continue;
             }
 
-            const float EdgeAlpha = FMath::Min(Node.AppearAlpha, Nodes[Link].AppearAlpha);
-            if (!Nodes[Link].bActive || EdgeAlpha <= 0.01f)
+            const FPluginNode& FromNode = Nodes[Edge.From];
+            const FPluginNode& ToNode = Nodes[Edge.To];
+            const float EdgeAlpha = FMath::Min(FromNode.AppearAlpha, ToNode.AppearAlpha);
+            if (!FromNode.bActive || !ToNode.bActive || EdgeAlpha <= 0.01f)
             {
                 continue;
             }
 
-            const FPluginNode& DepNode = Nodes[Link];
-            const FVector2D DepPos = Center + ViewOffset + DepNode.Position * ZoomAmount;
-            const float DepRadius = ((DepNode.Name == TEXT("Root")) ? 60.f : 40.f) * ZoomScale * 0.5f;
+            // Undeclared references are the interesting ones, keep declared ones subtle
+            FLinearColor LineColor = Edge.bDeclared ? ContentEdgeColor : UndeclaredContentEdgeColor;
+            LineColor.A = (Edge.bDeclared ? 0.25f : 0.8f) * (Edge.HardReferences > 0 ? 1.f : 0.5f) * EdgeAlpha;
+            const float Thickness = FMath::Min(1.f + FMath::Loge(1.f + Edge.HardReferences + Edge.SoftReferences), 6.f);
 
-            const FVector2D Delta = DepPos - NodePos;
-            const float Dist = FMath::Max(Delta.Size(), 1.f);
-            const FVector2D Dir = Delta / Dist;
-            const FVector2D Start = NodePos + Dir * NodeRadius;
+            AddLine(Center + ViewOffset + FromNode.Position * ZoomAmount, Center + ViewOffset + ToNode.Position * ZoomAmount, LineColor, Thickness);
+        }
+    }
+
+    // Source includes likewise, undeclared ones are where rebuilds cascade without the descriptors saying so
+    if (bShowIncludeEdges && IncludeResult.IsValid())
+    {
+        for (const FNsSpyglassIncludeEdge& Edge : IncludeResult->Edges)
+        {
+            if (!Nodes.IsValidIndex(Edge.From) || !Nodes.IsValidIndex(Edge.To) || !VisibleMask[Edge.From] || !VisibleMask[Edge.To])
+            {
+                continue;
+            }
+
+            const FPluginNode& FromNode = Nodes[Edge.From];
+            const FPluginNode& ToNode = Nodes[Edge.To];
+            const float EdgeAlpha = FMath::Min(FromNode.AppearAlpha, ToNode.AppearAlpha);
+            if (!FromNode.bActive || !ToNode.bActive || EdgeAlpha <= 0.01f)
+            {
+                continue;
+            }
+
+            FLinearColor LineColor = Edge.bDeclared ? IncludeEdgeColor : UndeclaredIncludeEdgeColor;
+            LineColor.A = (Edge.bDeclared ? 0.25f : 0.8f) * EdgeAlpha;
+            const float Thickness = FMath::Min(1.f + FMath::Loge(1.f + Edge.NumIncludes), 6.f);
+
+            AddLine(Center + ViewOffset + FromNode.Position * ZoomAmount, Center + ViewOffset + ToNode.Position * ZoomAmount, LineColor, Thickness);
+        }
+    }
+
+    // Edges a timeline step removed fade out where they were
+    for (const TPair<uint64, FTimelineEdgeFade>& Pair : TimelineEdgeFades)
+    {
+        const int32 From = static_cast<int32>(Pair.Key >> 32);
+        const int32 To = static_cast<int32>(Pair.Key & 0xffffffff);
+        if (Pair.Value.bAdded || !Nodes.IsValidIndex(From) || !Nodes.IsValidIndex(To) || !VisibleMask[From] || !VisibleMask[To])
+        {
+            continue;
+        }
+
+        const FPluginNode& FromNode = Nodes[From];
+        const FPluginNode& ToNode = Nodes[To];
+        const float EdgeAlpha = FMath::Min(FromNode.AppearAlpha, ToNode.AppearAlpha) * Pair.Value.Alpha;
+        if (!FromNode.bActive || !ToNode.bActive || EdgeAlpha <= 0.01f)
+        {
+            continue;
+        }
+
+        FLinearColor LineColor = DiffRemovedColor;
+        LineColor.A = 0.7f * EdgeAlpha;
+        AddLine(Center + ViewOffset + FromNode.Position * ZoomAmount, Center + ViewOffset + ToNode.Position * ZoomAmount, LineColor, 2.f);
+    }
+
+    // Bundled edges replace the faint default edges in the thinnest batch. Hidden hops between polylines are fully transparent
+    // A result routed for other nodes or another filter may still be held, so its endpoints are checked like any edge
+    if (EdgeBundles.IsValid() && EdgeBundles->Points.Num() == EdgeBundles->Edges.Num() * EdgeBundles->PointsPerEdge)
+    {
+        const FNsSpyglassEdgeBundles& Bundles = *EdgeBundles;
+        TArray<FVector2D>& BundlePoints = LineBatches[1].Points;
+        TArray<FLinearColor>& BundleColors = LineBatches[1].Colors;
+
+        for (int32 e = 0; e < Bundles.Edges.Num(); ++e)
+        {
+            const int32 From = Bundles.Edges[e].X;
+            const int32 To = Bundles.Edges[e].Y;
+            if (!Nodes.IsValidIndex(From) || !Nodes.IsValidIndex(To) || !VisibleMask.IsValidIndex(From) || !VisibleMask.IsValidIndex(To) || !VisibleMask[From] || !VisibleMask[To])
+            {
+                continue;
+            }
+
+            const FPluginNode& FromNode = Nodes[From];
+            const FPluginNode& ToNode = Nodes[To];
+            const float EdgeAlpha = FMath::Min(FromNode.AppearAlpha, ToNode.AppearAlpha);
+            if (!FromNode.bActive || !ToNode.bActive || EdgeAlpha <= 0.01f)
+            {
+                continue;
+            }
+
+            FLinearColor Color = BundledEdgeColor;
+            Color.A *= EdgeAlpha;
+            const FLinearColor Hidden(Color.R, Color.G, Color.B, 0.f);
+
+            const FVector2D* Points = Bundles.Points.GetData() + e * Bundles.PointsPerEdge;
+            BundlePoints.Add(Center + ViewOffset + Points[0] * ZoomAmount);
+            BundleColors.Add(Hidden);
+            for (int32 k = 0; k < Bundles.PointsPerEdge; ++k)
+            {
+                BundlePoints.Add(Center + ViewOffset + Points[k] * ZoomAmount);
+                BundleColors.Add(Color);
+            }
+            BundlePoints.Add(BundlePoints.Last());
+            BundleColors.Add(Hidden);
+        }
+    }
+
+    // Draw edges with arrowheads pointing to dependencies. Node and text sizes
+    // should follow the current zoom factor so zooming in enlarges them.
+    const float ZoomScale = ZoomAmount;
+    for (int32 i : VisibleNodes)
+    {
+        const FPluginNode& Node = Nodes[i];
+
+        if (!Node.bActive || Node.AppearAlpha <= 0.01f)
+        {
+            continue;
+        }
+
+        const FVector2D NodePos = Center + ViewOffset + Node.Position * ZoomAmount;
+        const float NodeRadius = ((Node.Name == TEXT("Root")) ? 60.f : 40.f) * ZoomScale * 0.5f;
+
+        for (int32 Link : Node.Dependencies)
+        {
+            if (!Nodes.IsValidIndex(Link) || i == Link || !VisibleMask[Link])
+            {
+                continue;
+            }
+
+            float EdgeAlpha = FMath::Min(Node.AppearAlpha, Nodes[Link].AppearAlpha);
+            if (!Nodes[Link].bActive || EdgeAlpha <= 0.01f)
+            {
+                continue;
+            }
+
+            const FPluginNode& DepNode = Nodes[Link];
+            const FVector2D DepPos = Center + ViewOffset + DepNode.Position * ZoomAmount;
+            const float DepRadius = ((DepNode.Name == TEXT("Root")) ? 60.f : 40.f) * ZoomScale * 0.5f;
+
+            const FVector2D Delta = DepPos - NodePos;
+            const float Dist = FMath::Max(Delta.Size(), 1.f);
+            const FVector2D Dir = Delta / Dist;
+            const FVector2D Start = NodePos + Dir * NodeRadius;
             const FVector2D End = DepPos - Dir * DepRadius;
 
-            const bool bHighlighted = HoveredNode != INDEX_NONE && Highlight.Contains(i) && Highlight.Contains(Link);
+            const bool bHighlighted = HoveredNode != INDEX_NONE && IsHighlighted(i) && IsHighlighted(Link);
+            const bool bCyclic = CycleInfo.IsCyclicEdge(i, Link);
+            const bool bSelectedCycle = bCyclic && CycleInfo.GetCycle(i) == SelectedCycle;
+            ENsSpyglassDiffState EdgeState = bShowingDiff ? Diff.GetEdgeState(i, Link) : ENsSpyglassDiffState::Unchanged;
+            if (TimelineEdgeFades.Num() > 0)
+            {
+                // Edges a timeline step added show as added while they fade in
+                if (const FTimelineEdgeFade* Fade = TimelineEdgeFades.Find(TimelineEdgeKey(i, Link)))
+                {
+                    EdgeState = ENsSpyglassDiffState::Added;
+                    EdgeAlpha *= Fade->Alpha;
+                }
+            }
+            const int32 PathIndex = SelectedPath.Find(i);
+            const bool bOnPath = PathIndex != INDEX_NONE && SelectedPath.IsValidIndex(PathIndex + 1) && SelectedPath[PathIndex + 1] == Link;
 
             FLinearColor LineColor = FLinearColor::Gray;
             float Thickness = 1.f;
 
-            if (bHighlighted)
+            if (bOnPath)
+            {
+                LineColor = SelectedPathColor;
+                Thickness = 4.f;
+            }
+            else if (EdgeState != ENsSpyglassDiffState::Unchanged)
+            {
+                // Changed edges are the point of a diff, keep them visible regardless of hover
+                LineColor = EdgeState == ENsSpyglassDiffState::Added ? DiffAddedColor : DiffRemovedColor;
+                LineColor.A = bHighlighted ? 1.f : 0.7f;
+                Thickness = 2.f;
+            }
+            else if (bCyclic)
+            {
+                // Edges inside a cycle stay visible regardless of hover
+                LineColor = CycleEdgeColor;
+                LineColor.A = bSelectedCycle || bHighlighted ? 1.f : 0.5f;
+                Thickness = bSelectedCycle ? 4.f : 2.f;
+            }
+            else if (bHighlighted)
             {
                 LineColor = Nodes[i].Color;
-                LineColor.A = Upstream.Contains(i) ? 0.3f : 1.f;
-                Thickness = Upstream.Contains(i) ? 2.f : 4.f;
+                LineColor.A = UpstreamMask[i] ? 0.3f : 1.f;
+                Thickness = UpstreamMask[i] ? 2.f : 4.f;
+            }
+            else if (EdgeBundles.IsValid())
+            {
+                continue;
             }
             else
             {
@@ -307,15 +970,18 @@ int32 SNsSpyglassGraphWidget::OnPaint(const FPaintArgs& Args, const FGeometry& A
 
             LineColor.A *= EdgeAlpha;
             // Line body
-            TArray<FVector2D> LinePoints{Start, End};
-            FSlateDrawElement::MakeLines(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), LinePoints, ESlateDrawEffect::None, LineColor, true, Thickness);
+            AddLine(Start, End, LineColor, Thickness);
 
-            if (bHighlighted)
+            const bool bEmphasized = bOnPath || bCyclic || EdgeState != ENsSpyglassDiffState::Unchanged;
+            if (bHighlighted || bEmphasized)
             {
                 // Arrowhead uses the dependency color with upstream arrows dimmer
-                FLinearColor ArrowColor = Nodes[Link].Color;
-                ArrowColor.A = Upstream.Contains(i) ? 0.3f : 1.f;
-                ArrowColor.A *= EdgeAlpha;
+                FLinearColor ArrowColor = bEmphasized ? LineColor : Nodes[Link].Color;
+                if (!bEmphasized)
+                {
+                    ArrowColor.A = UpstreamMask[i] ? 0.3f : 1.f;
+                    ArrowColor.A *= EdgeAlpha;
+                }
 
                 const float ArrowSize = 8.f * ZoomScale;
                 const FVector2D Perp(-Dir.Y, Dir.X);
@@ -323,16 +989,30 @@ int32 SNsSpyglassGraphWidget::OnPaint(const FPaintArgs& Args, const FGeometry& A
                 const FVector2D ArrowP1 = Tip - Dir * ArrowSize + Perp * ArrowSize * 0.5f;
                 const FVector2D ArrowP2 = Tip - Dir * ArrowSize - Perp * ArrowSize * 0.5f;
 
-                TArray<FVector2D> Arrow1{ArrowP1, Tip};
-                TArray<FVector2D> Arrow2{ArrowP2, Tip};
-                FSlateDrawElement::MakeLines(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), Arrow1, ESlateDrawEffect::None, ArrowColor, true, Thickness);
-                FSlateDrawElement::MakeLines(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), Arrow2, ESlateDrawEffect::None, ArrowColor, true, Thickness);
+                AddLine(ArrowP1, Tip, ArrowColor, Thickness);
+                AddLine(ArrowP2, Tip, ArrowColor, Thickness);
+            }
+        }
+    }
+
+    // Slate copies the points into its element list, counted apart from the view's own allocations
+    {
+        FNsSpyglassFrameAllocations::FSlateScope SlateElements;
+        for (int32 Thickness = 1; Thickness < LineBatches.Num(); ++Thickness)
+        {
+            const FLineBatch& Batch = LineBatches[Thickness];
+            if (Batch.Points.Num() > 1)
+            {
+                FSlateDrawElement::MakeLines(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), Batch.Points, Batch.Colors, ESlateDrawEffect::None, FLinearColor::White, true, static_cast<float>(Thickness));
             }
         }
     }
 
+    const FSlateFontInfo Font = FCoreStyle::Get().GetFontStyle("NormalFont");
+    UpdateLabels(Font);
+
     // Draw nodes
-    for (int32 i = 0; i < Nodes.Num(); ++i)
+    for (int32 i : VisibleNodes)
     {
         const FPluginNode& Node = Nodes[i];
 
@@ -354,11 +1034,11 @@ int32 SNsSpyglassGraphWidget::OnPaint(const FPaintArgs& Args, const FGeometry& A
             LerpColor.A = BoxColor.A;
             BoxColor = LerpColor;
         }
-        if (Downstream.Contains(i))
+        if (DownstreamMask[i])
         {
             BoxColor.A = 0.2f;
         }
-        else if (Upstream.Contains(i))
+        else if (UpstreamMask[i])
         {
             BoxColor.A = 0.1f;
         }
@@ -367,21 +1047,62 @@ int32 SNsSpyglassGraphWidget::OnPaint(const FPaintArgs& Args, const FGeometry& A
             BoxColor.A = 0.05f;
         }
 
-        const bool bOutlined = Highlight.Contains(i);
+        if (bShowBuildHeat && BuildTimings.IsValid() && !bShowingDiff)
+        {
+            const TArray<double>& Heat = bBuildHeatInclusive ? BuildTimings->InclusiveSeconds : BuildTimings->ExclusiveSeconds;
+            const double MaxHeat = bBuildHeatInclusive ? BuildTimings->MaxInclusive : BuildTimings->MaxExclusive;
+            if (MaxHeat > 0.0 && Heat.IsValidIndex(i) && Heat[i] > 0.0)
+            {
+                // The square root keeps a few very slow plugins from washing out the rest
+                const float Alpha = FMath::Sqrt(static_cast<float>(Heat[i] / MaxHeat));
+                const float Opacity = FMath::Max(BoxColor.A, FMath::Lerp(0.2f, 0.7f, Alpha));
+                BoxColor = FLinearColor::LerpUsingHSV(BuildHeatColdColor, BuildHeatHotColor, Alpha);
+                BoxColor.A = Opacity;
+            }
+        }
+
+        const bool bInSelectedCycle = SelectedCycle != INDEX_NONE && CycleInfo.GetCycle(i) == SelectedCycle;
+        const bool bUnused = UnusedResult.IsValid() && UnusedResult->Contains(i);
+        const ENsSpyglassDiffState NodeState = bShowingDiff && Diff.NodeStates.IsValidIndex(i) ? Diff.NodeStates[i] : ENsSpyglassDiffState::Unchanged;
+        const bool bSelected = SelectedNodes.Contains(i) || SelectedPath.Contains(i);
+        const ENsSpyglassWhatIfState WhatIfState = WhatIf.IsValid() ? WhatIf->GetState(i) : ENsSpyglassWhatIfState::Enabled;
+        const bool bOutlined = IsHighlighted(i) || bInSelectedCycle || bUnused || bSelected || NodeState != ENsSpyglassDiffState::Unchanged || WhatIfState != ENsSpyglassWhatIfState::Enabled;
         FLinearColor OutlineColor = bOutlined ? Node.Color : FLinearColor::Transparent;
-        if (bOutlined)
+        if (bSelected)
+        {
+            OutlineColor = SelectedPathColor;
+        }
+        else if (bInSelectedCycle)
+        {
+            OutlineColor = CycleEdgeColor;
+        }
+        else if (NodeState != ENsSpyglassDiffState::Unchanged && !IsHighlighted(i))
+        {
+            OutlineColor = NodeState == ENsSpyglassDiffState::Added ? DiffAddedColor : NodeState == ENsSpyglassDiffState::Removed ? DiffRemovedColor : DiffChangedColor;
+        }
+        else if (WhatIfState != ENsSpyglassWhatIfState::Enabled)
+        {
+            OutlineColor = WhatIfState == ENsSpyglassWhatIfState::Disabled ? WhatIfDisabledColor : WhatIfState == ENsSpyglassWhatIfState::Broken ? WhatIfBrokenColor : WhatIfOrphanedColor;
+        }
+        else if (bUnused && !IsHighlighted(i))
+        {
+            OutlineColor = UnusedNodeColor;
+        }
+        else if (bOutlined)
         {
-            if (Upstream.Contains(i))
+            if (UpstreamMask[i])
             {
                 OutlineColor.A = 0.2f;
             }
-            else if (Downstream.Contains(i))
+            else if (DownstreamMask[i])
             {
                 OutlineColor.A = 1.0f;
             }
         }
         const float OutlineThickness = bOutlined ? 4.f : 0.f;
 
+        // The rest of the node only emits draw elements, whose brush and strings Slate copies
+        FNsSpyglassFrameAllocations::FSlateScope SlateElements;
         FSlateRoundedBoxBrush CircleBrush(FLinearColor::White, Size * 0.5f, OutlineColor, OutlineThickness);
         FSlateDrawElement::MakeBox(
             OutDrawElements,
@@ -392,323 +1113,1209 @@ int32 SNsSpyglassGraphWidget::OnPaint(const FPaintArgs& Args, const FGeometry& A
             BoxColor
         );
 
-        const FSlateFontInfo Font = FCoreStyle::Get().GetFontStyle("NormalFont");
-        const TSharedRef<FSlateFontMeasure> Measure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+        const FNodeLabel& Label = Labels[i];
+        if (!Label.ShortName.IsEmpty())
+        {
+            const FVector2D& ShortSize = Label.ShortSize;
+            const FVector2D& FullSize = Label.FullSize;
+            const float BaseScale = FMath::Min(1.f, (BaseSize - 8.f) / FMath::Max(ShortSize.X, FullSize.X));
+            const float ShortScale = BaseScale * ZoomScale;
+            const float FullScale = BaseScale * 0.6f * ZoomScale;
+            const float TextAlpha = FMath::Clamp(ZoomAmount, 0.f, 1.f) * Node.AppearAlpha;
+
+            const float TotalHeight = ShortSize.Y * ShortScale + FullSize.Y * FullScale;
+            const float StartY = (Size - TotalHeight) * 0.5f;
+
+            FVector2D Offset((Size - ShortSize.X * ShortScale) * 0.5f, StartY);
+            FSlateDrawElement::MakeText(
+                OutDrawElements,
+                LayerId + 2,
+                AllottedGeometry.ToPaintGeometry(ShortSize, FSlateLayoutTransform(ShortScale, DrawPos + Offset)),
+                Label.ShortName,
+                Font,
+                ESlateDrawEffect::None,
+                FLinearColor(1.f, 1.f, 1.f, TextAlpha)
+            );
+
+            Offset.X = (Size - FullSize.X * FullScale) * 0.5f;
+            Offset.Y = StartY + ShortSize.Y * ShortScale;
+            FSlateDrawElement::MakeText(
+                OutDrawElements,
+                LayerId + 2,
+                AllottedGeometry.ToPaintGeometry(FullSize, FSlateLayoutTransform(FullScale, DrawPos + Offset)),
+                Node.Name,
+                Font,
+                ESlateDrawEffect::None,
+                FLinearColor(1.f, 1.f, 1.f, TextAlpha)
+            );
+        }
+        else
+        {
+            const FVector2D& TextSize = Label.FullSize;
+            const float BaseScale = FMath::Min(1.f, (BaseSize - 8.f) / TextSize.X);
+            const float TextScale = BaseScale * ZoomScale;
+            const float TextAlpha = FMath::Clamp(ZoomAmount, 0.f, 1.f) * Node.AppearAlpha;
+            const FVector2D Offset((Size - TextSize.X * TextScale) * 0.5f, (Size - TextSize.Y * TextScale) * 0.5f);
+
+            FSlateDrawElement::MakeText(
+                OutDrawElements,
+                LayerId + 2,
+                AllottedGeometry.ToPaintGeometry(TextSize, FSlateLayoutTransform(TextScale, DrawPos + Offset)),
+                Node.Name,
+                Font,
+                ESlateDrawEffect::None,
+                FLinearColor(1.f, 1.f, 1.f, TextAlpha)
+            );
+        }
+    }
+
+    return LayerId + 3;
+}
+
+FReply SNsSpyglassGraphWidget::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    RecordEvent(ENsSpyglassSessionEventType::MouseDown, MyGeometry, MouseEvent);
+    const FVector2D LocalPos = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+
+    if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
+    {
+        PressPos = LocalPos;
+        int32 Hit = HitTestNode(LocalPos, MyGeometry.GetLocalSize());
+        if (Hit != INDEX_NONE)
+        {
+            bIsDragging = true;
+            DraggedNode = Hit;
+            Nodes[Hit].bFixed = true;
+            Nodes[Hit].Velocity = FVector2D::ZeroVector;
+            bLocalSettled = false;
+            if (UsesSharedLayout())
+            {
+                UNsSpyglassGraphSubsystem::Get().SetNodePinned(Hit, Nodes[Hit].Position, true);
+            }
+            LastMousePos = LocalPos;
+            return FReply::Handled().CaptureMouse(SharedThis(this));
+        }
+
+        bIsPanning = true;
+        LastMousePos = MouseEvent.GetScreenSpacePosition();
+        return FReply::Handled().CaptureMouse(SharedThis(this));
+    }
+    else if (MouseEvent.GetEffectingButton() == EKeys::RightMouseButton)
+    {
+        bIsPanning = true;
+        LastMousePos = MouseEvent.GetScreenSpacePosition();
+        return FReply::Handled().CaptureMouse(SharedThis(this));
+    }
+
+    return FReply::Unhandled();
+}
+
+FReply SNsSpyglassGraphWidget::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    RecordEvent(ENsSpyglassSessionEventType::MouseUp, MyGeometry, MouseEvent);
+    if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
+    {
+        // A press that barely moved is a click: select the node, or clear the selection on empty space
+        const FVector2D LocalPos = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+        const bool bClick = (LocalPos - PressPos).SizeSquared() < FMath::Square(4.f);
+
+        if (bIsDragging && Nodes.IsValidIndex(DraggedNode))
+        {
+            Nodes[DraggedNode].bFixed = false;
+            Nodes[DraggedNode].Velocity = FVector2D::ZeroVector;
+            if (UsesSharedLayout())
+            {
+                UNsSpyglassGraphSubsystem::Get().SetNodePinned(DraggedNode, Nodes[DraggedNode].Position, false);
+            }
+            if (bClick && WhatIf.IsValid())
+            {
+                WhatIf->SetDisabled({ DraggedNode }, !WhatIf->IsDisabled(DraggedNode));
+                NotifyWhatIfChanged();
+            }
+            else if (bClick)
+            {
+                ToggleSelection(DraggedNode);
+            }
+        }
+        else if (bIsPanning && bClick)
+        {
+            ClearSelection();
+        }
+        bIsDragging = false;
+        DraggedNode = INDEX_NONE;
+        bIsPanning = false;
+        return FReply::Handled().ReleaseMouseCapture();
+    }
+    else if (MouseEvent.GetEffectingButton() == EKeys::RightMouseButton)
+    {
+        bIsPanning = false;
+        return FReply::Handled().ReleaseMouseCapture();
+    }
+
+    return FReply::Unhandled();
+}
+
+FReply SNsSpyglassGraphWidget::OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    RecordEvent(ENsSpyglassSessionEventType::DoubleClick, MyGeometry, MouseEvent);
+    if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton)
+    {
+        return FReply::Unhandled();
+    }
+
+    const int32 Hit = HitTestNode(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()), MyGeometry.GetLocalSize());
+    if (Hit != INDEX_NONE && LayoutMode == ENsSpyglassLayoutMode::Radial && FocusNode == INDEX_NONE)
+    {
+        // A radial view re-roots on the plugin instead of narrowing down to it
+        SetRadialRoot(Hit);
+    }
+    else if (Hit != INDEX_NONE)
+    {
+        EnterFocus(Hit);
+    }
+    else
+    {
+        ExitFocus();
+    }
+
+    return FReply::Handled();
+}
+
+FReply SNsSpyglassGraphWidget::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    RecordEvent(ENsSpyglassSessionEventType::MouseMove, MyGeometry, MouseEvent);
+    const FVector2D LocalPos = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
 
-        const bool bSplitName = Node.Name.Len() > 12;
-        if (bSplitName)
+    if (bIsDragging && Nodes.IsValidIndex(DraggedNode))
+    {
+        const FVector2D Delta = (LocalPos - LastMousePos) / ZoomAmount;
+        Nodes[DraggedNode].Position += Delta;
+        if (UsesSharedLayout())
         {
-            FString ShortName;
-            for (const TCHAR Ch : Node.Name)
+            UNsSpyglassGraphSubsystem::Get().SetNodePinned(DraggedNode, Nodes[DraggedNode].Position, true);
+        }
+        LastMousePos = LocalPos;
+        return FReply::Handled();
+    }
+    else if (bIsPanning)
+    {
+        const FVector2D Delta = MouseEvent.GetScreenSpacePosition() - LastMousePos;
+        ViewOffset += Delta;
+        LastMousePos = MouseEvent.GetScreenSpacePosition();
+        return FReply::Handled();
+    }
+
+    const int32 NewHover = HitTestNode(LocalPos, MyGeometry.GetLocalSize());
+    if (HoveredNode != NewHover)
+    {
+        HoveredNode = NewHover;
+        if (HoveredNode != INDEX_NONE)
+        {
+            SetToolTipText(FText::FromString(Nodes[HoveredNode].Name));
+            OnNodeHovered.ExecuteIfBound(Nodes[HoveredNode].Plugin);
+        }
+        else
+        {
+            SetToolTipText(FText());
+            OnNodeHovered.ExecuteIfBound(nullptr);
+        }
+    }
+
+    return FReply::Unhandled();
+}
+
+FReply SNsSpyglassGraphWidget::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    RecordEvent(ENsSpyglassSessionEventType::Wheel, MyGeometry, MouseEvent);
+    const FVector2D LocalMousePos = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+    const FVector2D Center = MyGeometry.GetLocalSize() * 0.5f;
+
+    const float OldZoom = ZoomAmount;
+    ZoomAmount *= FMath::Pow(1.1f, MouseEvent.GetWheelDelta());
+    ZoomAmount = FMath::Clamp(ZoomAmount, MinZoom, MaxZoom);
+
+    const float ZoomRatio = ZoomAmount / OldZoom;
+    ViewOffset = LocalMousePos - Center - (LocalMousePos - Center - ViewOffset) * ZoomRatio;
+
+    return FReply::Handled();
+}
+
+void SNsSpyglassGraphWidget::ToggleSelection(const int32 NodeIndex)
+{
+    if (SelectedNodes.Remove(NodeIndex) == 0)
+    {
+        SelectedNodes.Add(NodeIndex);
+        if (SelectedNodes.Num() > 2)
+        {
+            SelectedNodes.RemoveAt(0);
+        }
+    }
+
+    UpdateSelectedPath();
+}
+
+void SNsSpyglassGraphWidget::UpdateSelectedPath()
+{
+    SelectedPath.Reset();
+    if (SelectedNodes.Num() == 2 && Query.IsValid())
+    {
+        // Either node may be the dependent one
+        if (!Query->FindShortestPath(SelectedNodes[0], SelectedNodes[1], SelectedPath))
+        {
+            Query->FindShortestPath(SelectedNodes[1], SelectedNodes[0], SelectedPath);
+        }
+    }
+}
+
+void SNsSpyglassGraphWidget::ClearSelection()
+{
+    SelectedNodes.Reset();
+    SelectedPath.Reset();
+}
+
+void SNsSpyglassGraphWidget::RecenterView()
+{
+    ViewOffset = FVector2D::ZeroVector;
+    ZoomAmount = 0.75f;
+}
+
+void SNsSpyglassGraphWidget::CenterViewOn(const FVector2D& GraphPos, const float InZoomAmount)
+{
+    ZoomAmount = FMath::Clamp(InZoomAmount, MinZoom, MaxZoom);
+    ViewOffset = -GraphPos * ZoomAmount;
+}
+
+void SNsSpyglassGraphWidget::RebuildGraph()
+{
+    bShowingDiff = false;
+    Diff = FNsSpyglassGraphDiff();
+    ClearTimeline();
+
+    // The nodes on screen may be a diff, take the next model whole instead of appending to them
+    ModelBuildId = 0;
+
+    // Every view picks the new model up through HandleModelChanged
+    UNsSpyglassGraphSubsystem::Get().Rebuild();
+}
+
+void SNsSpyglassGraphWidget::HandleModelChanged()
+{
+    // A displayed diff, timeline or replay does not follow the live graph
+    if (bShowingDiff || History.IsValid() || bReplaying)
+    {
+        return;
+    }
+
+    // One batch per call, so a view opened on a large finished build catches up over a few frames
+    const FNsSpyglassGraphModelRef Model = UNsSpyglassGraphSubsystem::Get().GetNextBatch(ModelBuildId, Nodes.Num());
+    if (Model->Version == ModelVersion)
+    {
+        return;
+    }
+
+    // The recorded snapshot no longer matches the nodes
+    Recording.Reset();
+    SelectedCycle = INDEX_NONE;
+    UnusedResult.Reset();
+    bUnusedSearchPending = false;
+
+    if (ModelBuildId != 0 && Model->BuildId == ModelBuildId && Model->Nodes.Num() > Nodes.Num())
+    {
+        // Focus positions and masks are sized for the old node count
+        ExitFocus();
+        AppendNodes(*Model);
+    }
+    else
+    {
+        ResetFocus();
+        bIsDragging = false;
+        DraggedNode = INDEX_NONE;
+        if (HoveredNode != INDEX_NONE)
+        {
+            HoveredNode = INDEX_NONE;
+            OnNodeHovered.ExecuteIfBound(nullptr);
+        }
+
+        BuildNodes(*Model);
+        bIntroRunning = false;
+        RevealNodes(0);
+        ClearSelection();
+        RecenterView();
+        ContentResult.Reset();
+        ContentResultVersion = 0;
+    }
+
+    if (bShippingView)
+    {
+        UpdateShippingView();
+    }
+
+    // Content is gathered once, for the whole plugin set
+    if (bShowContentEdges && Model->bComplete)
+    {
+        FNsSpyglassContentRollup::Get().Request(Nodes);
+    }
+    if (bShowBuildHeat && Model->bComplete)
+    {
+        FNsSpyglassBuildTimings::Get().Request(Nodes);
+    }
+    if (bShowIncludeEdges && Model->bComplete)
+    {
+        FNsSpyglassIncludeScanner::Get().Request(Nodes);
+    }
+    RefreshLayout();
+    if (WhatIf.IsValid())
+    {
+        // Binaries are measured once the whole plugin set arrived
+        RestartWhatIf(Model->bComplete);
+    }
+    OnGraphRebuilt.ExecuteIfBound();
+}
+
+void SNsSpyglassGraphWidget::SetOnNodeHovered(FOnNodeHovered InDelegate)
+{
+    OnNodeHovered = InDelegate;
+}
+
+void SNsSpyglassGraphWidget::SetOnGraphRebuilt(FOnGraphRebuilt InDelegate)
+{
+    OnGraphRebuilt = InDelegate;
+}
+
+void SNsSpyglassGraphWidget::SetSelectedCycle(int32 CycleIndex)
+{
+    SelectedCycle = CycleInfo.Cycles.IsValidIndex(CycleIndex) ? CycleIndex : INDEX_NONE;
+}
+
+void SNsSpyglassGraphWidget::SetOnUnusedPluginsFound(FOnUnusedPluginsFound InDelegate)
+{
+    OnUnusedPluginsFound = InDelegate;
+}
+
+void SNsSpyglassGraphWidget::FindUnusedPlugins()
+{
+    if (bShowingDiff || History.IsValid())
+    {
+        return;
+    }
+
+    // Content references are part of the criteria, the search starts once they are gathered
+    bUnusedSearchPending = true;
+    FNsSpyglassContentRollup::Get().Request(Nodes);
+}
+
+void SNsSpyglassGraphWidget::SetOnShippingViewChanged(FOnShippingViewChanged InDelegate)
+{
+    OnShippingViewChanged = InDelegate;
+}
+
+void SNsSpyglassGraphWidget::SetShippingView(const bool bEnable, const ENsSpyglassShipTarget Target, const FString& Platform)
+{
+    bShippingView = bEnable;
+    ShipTarget = Target;
+    ShipPlatform = Platform;
+    UpdateShippingView();
+    RefreshLayout();
+}
+
+void SNsSpyglassGraphWidget::UpdateShippingView()
+{
+    if (bShippingView)
+    {
+        // Descriptors are only read when the plugin set changes, switching targets reuses the masks
+        if (ShippingFilterHash != PluginSetHash || ShippingFilter.NumNodes() != Nodes.Num())
+        {
+            ShippingFilter.Build(Nodes);
+            ShippingFilterHash = PluginSetHash;
+        }
+        ShippingFilter.Evaluate(ShipTarget, ShipPlatform, ShippingResult);
+    }
+    else
+    {
+        ShippingResult = FNsSpyglassShippingResult();
+    }
+
+    ApplyFilter();
+    OnShippingViewChanged.ExecuteIfBound(bShippingView ? &ShippingResult : nullptr);
+}
+
+void SNsSpyglassGraphWidget::SetOnWhatIfChanged(FOnWhatIfChanged InDelegate)
+{
+    OnWhatIfChanged = InDelegate;
+}
+
+void SNsSpyglassGraphWidget::SetWhatIfMode(const bool bEnable)
+{
+    if (bEnable == WhatIf.IsValid())
+    {
+        return;
+    }
+
+    if (bEnable)
+    {
+        WhatIf = MakeUnique<FNsSpyglassWhatIf>();
+        RestartWhatIf(true);
+    }
+    else
+    {
+        WhatIf.Reset();
+        ++WhatIfGeneration;
+        OnWhatIfChanged.ExecuteIfBound(nullptr);
+    }
+}
+
+void SNsSpyglassGraphWidget::DisableVisiblePlugins()
+{
+    // Without a filter every node is visible, which is never a useful proposal
+    if (WhatIf.IsValid() && !FilterText.IsEmpty())
+    {
+        WhatIf->SetDisabled(VisibleNodes, true);
+        NotifyWhatIfChanged();
+    }
+}
+
+void SNsSpyglassGraphWidget::ResetWhatIf()
+{
+    if (!WhatIf.IsValid())
+    {
+        return;
+    }
+
+    TArray<int32> DisabledNodes;
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        if (WhatIf->IsDisabled(i))
+        {
+            DisabledNodes.Add(i);
+        }
+    }
+    WhatIf->SetDisabled(DisabledNodes, false);
+    NotifyWhatIfChanged();
+}
+
+void SNsSpyglassGraphWidget::RestartWhatIf(const bool bMeasureBinaries)
+{
+    // Node indices change with the graph, disabled plugins carry over by name
+    FNsSpyglassWhatIfResult Previous;
+    WhatIf->MakeResult(Previous);
+    TSet<FString> DisabledNames;
+    for (const FNsSpyglassWhatIfEntry& Entry : Previous.Entries)
+    {
+        if (Entry.State == ENsSpyglassWhatIfState::Disabled)
+        {
+            DisabledNames.Add(Entry.Name);
+        }
+    }
+
+    WhatIf->Initialize(Nodes);
+    TArray<int32> DisabledNodes;
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        if (DisabledNames.Contains(Nodes[i].Name))
+        {
+            DisabledNodes.Add(i);
+        }
+    }
+    WhatIf->SetDisabled(DisabledNodes, true);
+    NotifyWhatIfChanged();
+
+    const uint32 Generation = ++WhatIfGeneration;
+    if (!bMeasureBinaries)
+    {
+        return;
+    }
+
+    // Sizes come from the disk, the scenario is usable without them until they arrive
+    TWeakPtr<SNsSpyglassGraphWidget> WeakThis = SharedThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Generation, NodesCopy = Nodes]()
+    {
+        TArray<int64> Bytes;
+        FNsSpyglassWhatIf::MeasureBinaries(NodesCopy, Bytes);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Generation, Bytes = MoveTemp(Bytes)]()
+        {
+            const TSharedPtr<SNsSpyglassGraphWidget> This = WeakThis.Pin();
+            if (This.IsValid() && This->WhatIf.IsValid() && This->WhatIfGeneration == Generation)
+            {
+                This->WhatIf->SetBinarySizes(Bytes);
+                This->NotifyWhatIfChanged();
+            }
+        });
+    });
+}
+
+void SNsSpyglassGraphWidget::NotifyWhatIfChanged()
+{
+    if (!WhatIf.IsValid())
+    {
+        return;
+    }
+
+    TSharedRef<FNsSpyglassWhatIfResult, ESPMode::ThreadSafe> Result = MakeShared<FNsSpyglassWhatIfResult, ESPMode::ThreadSafe>();
+    WhatIf->MakeResult(*Result);
+    OnWhatIfChanged.ExecuteIfBound(Result);
+}
+
+bool SNsSpyglassGraphWidget::SaveSnapshot(const FString& FilePath) const
+{
+    return FNsSpyglassSnapshot::Save(FilePath, Nodes);
+}
+
+void SNsSpyglassGraphWidget::ShowDiff(const FNsSpyglassGraphDiff& InDiff)
+{
+    ResetFocus();
+    Recording.Reset();
+    Diff = InDiff;
+    Nodes = MoveTemp(Diff.Nodes);
+    Diff.Nodes.Reset();
+    bShowingDiff = true;
+    ClearTimeline();
+
+    RootIndex = INDEX_NONE;
+    HoveredNode = INDEX_NONE;
+    DraggedNode = INDEX_NONE;
+    bIsDragging = false;
+    bIntroRunning = false;
+    SelectedCycle = INDEX_NONE;
+    ContentResult.Reset();
+    UnusedResult.Reset();
+    bUnusedSearchPending = false;
+
+    // Snapshots written by the commandlet carry no layout, spread them like a fresh build
+    const bool bHasLayout = Nodes.ContainsByPredicate([](const FPluginNode& Node) { return !Node.Position.IsNearlyZero(); });
+    for (int32 i = 0; i < Nodes.Num(); ++i)
+    {
+        FPluginNode& Node = Nodes[i];
+        if (!bHasLayout)
+        {
+            const float Angle = 2.f * PI * static_cast<float>(i) / static_cast<float>(Nodes.Num());
+            Node.Position = FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * 200.f;
+        }
+
+        switch (Diff.NodeStates[i])
+        {
+        case ENsSpyglassDiffState::Added:   Node.Color = DiffAddedColor; break;
+        case ENsSpyglassDiffState::Removed: Node.Color = DiffRemovedColor; break;
+        case ENsSpyglassDiffState::Changed: Node.Color = DiffChangedColor; break;
+        default:                            Node.Color = FLinearColor::White; break;
+        }
+        Node.Color.A = 0.1f;
+    }
+
+    FNsSpyglassCycleDetector::Compute(Nodes, CycleInfo);
+    PluginSetHash = FNsSpyglassContentRollup::ComputePluginSetHash(Nodes);
+    ++NodesRevision;
+    Query = MakeShared<FNsSpyglassGraphQuery, ESPMode::ThreadSafe>(Nodes);
+    SearchIndex.Build(Nodes);
+    ApplyFilter();
+    ClearSelection();
+    if (bShippingView)
+    {
+        UpdateShippingView();
+    }
+    RefreshLayout();
+    if (WhatIf.IsValid())
+    {
+        RestartWhatIf(true);
+    }
+    OnGraphRebuilt.ExecuteIfBound();
+}
+
+void SNsSpyglassGraphWidget::ShowTimeline(FNsSpyglassHistoryPtr InHistory)
+{
+    if (!InHistory.IsValid() || InHistory->Commits.Num() == 0)
+    {
+        return;
+    }
+
+    ResetFocus();
+    Recording.Reset();
+    bShowingDiff = false;
+    Diff = FNsSpyglassGraphDiff();
+    History = MoveTemp(InHistory);
+    TimelineCommit = INDEX_NONE;
+    TimelineEdgeFades.Reset();
+
+    // Every plugin of the range gets a node up front, commits only switch nodes and edges on and off
+    const int32 NumNodes = History->NodeNames.Num();
+    Nodes.Reset(NumNodes);
+    Nodes.SetNum(NumNodes);
+    for (int32 i = 0; i < NumNodes; ++i)
+    {
+        FPluginNode& Node = Nodes[i];
+        Node.Name = History->NodeNames[i];
+        Node.Plugin = IPluginManager::Get().FindPlugin(Node.Name);
+        Node.bIsEngine = Node.Plugin.IsValid() && Node.Plugin->GetLoadedFrom() == EPluginLoadedFrom::Engine;
+
+        const float Angle = 2.f * PI * static_cast<float>(i) / static_cast<float>(NumNodes);
+        Node.Position = FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * 200.f;
+        Node.Color = History->IsLocal[i] ? FLinearColor::White : TimelineExternalColor;
+        Node.Color.A = 0.1f;
+        Node.bActive = false;
+        Node.AppearAlpha = 0.f;
+    }
+    TimelinePresent.Init(false, NumNodes);
+    TimelineShown.Init(false, NumNodes);
+    TimelineAppeared.Reset();
+    bTimelineCyclesStale = true;
+
+    RootIndex = INDEX_NONE;
+    HoveredNode = INDEX_NONE;
+    DraggedNode = INDEX_NONE;
+    bIsDragging = false;
+    bIntroRunning = false;
+    ContentResult.Reset();
+    UnusedResult.Reset();
+    bUnusedSearchPending = false;
+
+    PluginSetHash = FNsSpyglassContentRollup::ComputePluginSetHash(Nodes);
+    SearchIndex.Build(Nodes);
+    ApplyFilter();
+    ClearSelection();
+    if (bShippingView)
+    {
+        UpdateShippingView();
+    }
+    SetTimelineCommit(0);
+    UpdateTimelineGraph();
+    if (WhatIf.IsValid())
+    {
+        RestartWhatIf(true);
+    }
+}
+
+void SNsSpyglassGraphWidget::SetTimelineCommit(int32 Commit)
+{
+    if (!History.IsValid())
+    {
+        return;
+    }
+
+    Commit = FMath::Clamp(Commit, 0, History->Commits.Num() - 1);
+    if (Commit == TimelineCommit)
+    {
+        return;
+    }
+
+    // A single step updates the components in place: added edges only walk what they can reach, and removed edges
+    // only matter inside a cycle, which they may split. Jumps and such splits leave them for one linear pass in
+    // UpdateTimelineGraph
+    bool bCyclesCurrent = !bTimelineCyclesStale && TimelineCommit != INDEX_NONE && FMath::Abs(Commit - TimelineCommit) == 1;
+
+    // Scrubbing replays or undoes the commits in between, touching only the nodes and edges they changed
+    while (TimelineCommit < Commit)
+    {
+        ApplyHistoryOps(++TimelineCommit, false, bCyclesCurrent);
+    }
+    while (TimelineCommit > Commit)
+    {
+        ApplyHistoryOps(TimelineCommit--, true, bCyclesCurrent);
+    }
+    bTimelineCyclesStale |= !bCyclesCurrent;
+
+    // Plugins that appear start next to a neighbour already on screen
+    for (const int32 i : TimelineAppeared)
+    {
+        FPluginNode& Node = Nodes[i];
+        if (!TimelinePresent[i] || Node.bActive)
+        {
+            continue;
+        }
+
+        for (const int32 Link : Node.Links)
+        {
+            if (Nodes[Link].bActive)
+            {
+                const float Angle = Random.FRandRange(0.f, 2.f * PI);
+                Node.Position = Nodes[Link].Position + FVector2D(FMath::Cos(Angle), FMath::Sin(Angle)) * 60.f;
+                break;
+            }
+        }
+        Node.bActive = true;
+        Node.Velocity = FVector2D::ZeroVector;
+        SetTimelineShown(i, true);
+    }
+    TimelineAppeared.Reset();
+
+    ++NodesRevision;
+    SelectedCycle = INDEX_NONE;
+    bLocalSettled = false;
+
+    // Bundles were routed for the old edges
+    EdgeBundles.Reset();
+    bBundlePending = false;
+    ++BundleGeneration;
+
+    bTimelineDirty = true;
+    if (!bTimelineScrubbing)
+    {
+        UpdateTimelineGraph();
+    }
+}
+
+void SNsSpyglassGraphWidget::SetTimelineScrubbing(const bool bScrubbing)
+{
+    bTimelineScrubbing = bScrubbing;
+    if (!bTimelineScrubbing)
+    {
+        UpdateTimelineGraph();
+    }
+}
+
+void SNsSpyglassGraphWidget::UpdateTimelineGraph()
+{
+    if (!bTimelineDirty || !History.IsValid())
+    {
+        return;
+    }
+    bTimelineDirty = false;
+
+    // The query is rebuilt whole, a linear pass per step outside a scrub. Only the ops, the placement of new
+    // nodes and the cycle update of a single step scale with what the step changed
+
+    if (bTimelineCyclesStale)
+    {
+        FNsSpyglassCycleDetector::Compute(Nodes, CycleInfo);
+        bTimelineCyclesStale = false;
+    }
+    Query = MakeShared<FNsSpyglassGraphQuery, ESPMode::ThreadSafe>(Nodes);
+    UpdateSelectedPath();
+    RefreshLayout();
+    OnGraphRebuilt.ExecuteIfBound();
+}
+
+void SNsSpyglassGraphWidget::ApplyHistoryOps(const int32 Commit, const bool bUndo, bool& bInOutCyclesCurrent)
+{
+    const TConstArrayView<uint64> Ops = History->GetOps(Commit);
+    for (int32 k = 0; k < Ops.Num(); ++k)
+    {
+        // Undoing runs the ops backwards as their inverse, so edges still leave before their nodes
+        const uint64 Op = Ops[bUndo ? Ops.Num() - 1 - k : k];
+        const int32 From = FNsSpyglassHistory::GetOpFrom(Op);
+        const int32 To = FNsSpyglassHistory::GetOpTo(Op);
+        ENsSpyglassHistoryOp Type = FNsSpyglassHistory::GetOpType(Op);
+        if (bUndo)
+        {
+            switch (Type)
+            {
+            case ENsSpyglassHistoryOp::AddNode:    Type = ENsSpyglassHistoryOp::RemoveNode; break;
+            case ENsSpyglassHistoryOp::RemoveNode: Type = ENsSpyglassHistoryOp::AddNode; break;
+            case ENsSpyglassHistoryOp::AddEdge:    Type = ENsSpyglassHistoryOp::RemoveEdge; break;
+            case ENsSpyglassHistoryOp::RemoveEdge: Type = ENsSpyglassHistoryOp::AddEdge; break;
+            }
+        }
+
+        switch (Type)
+        {
+        case ENsSpyglassHistoryOp::AddNode:
+        case ENsSpyglassHistoryOp::RemoveNode:
+            TimelinePresent[From] = Type == ENsSpyglassHistoryOp::AddNode;
+            if (TimelinePresent[From] && !Nodes[From].bActive)
+            {
+                TimelineAppeared.Add(From);
+            }
+            break;
+
+        case ENsSpyglassHistoryOp::AddEdge:
+        {
+            Nodes[From].Dependencies.AddUnique(To);
+            Nodes[To].Dependents.AddUnique(From);
+            Nodes[From].Links.AddUnique(To);
+            Nodes[To].Links.AddUnique(From);
+            if (bInOutCyclesCurrent)
+            {
+                FNsSpyglassCycleDetector::AddEdge(Nodes, From, To, CycleInfo);
+            }
+
+            // An edge that comes back while its removal still fades out is simply there again
+            const uint64 Key = TimelineEdgeKey(From, To);
+            const FTimelineEdgeFade* Fade = TimelineEdgeFades.Find(Key);
+            if (Fade && !Fade->bAdded)
             {
-                if (FChar::IsUpper(Ch))
-                {
-                    ShortName.AppendChar(Ch);
-                }
+                TimelineEdgeFades.Remove(Key);
             }
-            if (ShortName.IsEmpty())
+            else
             {
-                ShortName = Node.Name.Left(2).ToUpper();
+                TimelineEdgeFades.Add(Key, FTimelineEdgeFade{ 0.f, true });
             }
+            break;
+        }
 
-            const FVector2D ShortSize = Measure->Measure(ShortName, Font);
-            const FVector2D FullSize = Measure->Measure(Node.Name, Font);
-            const float BaseScale = FMath::Min(1.f, (BaseSize - 8.f) / FMath::Max(ShortSize.X, FullSize.X));
-            const float ShortScale = BaseScale * ZoomScale;
-            const float FullScale = BaseScale * 0.6f * ZoomScale;
-            const float TextAlpha = FMath::Clamp(ZoomAmount, 0.f, 1.f) * Node.AppearAlpha;
-
-            const float TotalHeight = ShortSize.Y * ShortScale + FullSize.Y * FullScale;
-            const float StartY = (Size - TotalHeight) * 0.5f;
+        case ENsSpyglassHistoryOp::RemoveEdge:
+        {
+            Nodes[From].Dependencies.Remove(To);
+            Nodes[To].Dependents.Remove(From);
+            bInOutCyclesCurrent &= !CycleInfo.IsCyclicEdge(From, To);
 
-            FVector2D Offset((Size - ShortSize.X * ShortScale) * 0.5f, StartY);
-            FSlateDrawElement::MakeText(
-                OutDrawElements,
-                LayerId + 2,
-                AllottedGeometry.ToPaintGeometry(ShortSize, FSlateLayoutTransform(ShortScale, DrawPos + Offset)),
-                ShortName,
-                Font,
-                ESlateDrawEffect::None,
-                FLinearColor(1.f, 1.f, 1.f, TextAlpha)
-            );
+            // Layout links are undirected, they stay while the reverse edge exists
+            if (!Nodes[To].Dependencies.Contains(From))
+            {
+                Nodes[From].Links.Remove(To);
+                Nodes[To].Links.Remove(From);
+            }
 
-            Offset.X = (Size - FullSize.X * FullScale) * 0.5f;
-            Offset.Y = StartY + ShortSize.Y * ShortScale;
-            FSlateDrawElement::MakeText(
-                OutDrawElements,
-                LayerId + 2,
-                AllottedGeometry.ToPaintGeometry(FullSize, FSlateLayoutTransform(FullScale, DrawPos + Offset)),
-                Node.Name,
-                Font,
-                ESlateDrawEffect::None,
-                FLinearColor(1.f, 1.f, 1.f, TextAlpha)
-            );
+            const uint64 Key = TimelineEdgeKey(From, To);
+            const FTimelineEdgeFade* Fade = TimelineEdgeFades.Find(Key);
+            if (Fade && Fade->bAdded)
+            {
+                TimelineEdgeFades.Remove(Key);
+            }
+            else
+            {
+                TimelineEdgeFades.Add(Key, FTimelineEdgeFade{ 1.f, false });
+            }
+            break;
         }
-        else
-        {
-            const FVector2D TextSize = Measure->Measure(Node.Name, Font);
-            const float BaseScale = FMath::Min(1.f, (BaseSize - 8.f) / TextSize.X);
-            const float TextScale = BaseScale * ZoomScale;
-            const float TextAlpha = FMath::Clamp(ZoomAmount, 0.f, 1.f) * Node.AppearAlpha;
-            const FVector2D Offset((Size - TextSize.X * TextScale) * 0.5f, (Size - TextSize.Y * TextScale) * 0.5f);
-
-            FSlateDrawElement::MakeText(
-                OutDrawElements,
-                LayerId + 2,
-                AllottedGeometry.ToPaintGeometry(TextSize, FSlateLayoutTransform(TextScale, DrawPos + Offset)),
-                Node.Name,
-                Font,
-                ESlateDrawEffect::None,
-                FLinearColor(1.f, 1.f, 1.f, TextAlpha)
-            );
         }
     }
-
-    return LayerId + 3;
 }
 
-FReply SNsSpyglassGraphWidget::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+void SNsSpyglassGraphWidget::TickTimeline(const float DeltaTime)
 {
-    const FVector2D LocalPos = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+    const float Step = DeltaTime / TimelineFadeSeconds;
 
-    if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
+    for (int32 i = 0; i < Nodes.Num(); ++i)
     {
-        int32 Hit = HitTestNode(LocalPos, MyGeometry.GetLocalSize());
-        if (Hit != INDEX_NONE)
+        FPluginNode& Node = Nodes[i];
+        const float Target = TimelinePresent[i] ? 1.f : 0.f;
+        if (Node.AppearAlpha == Target)
         {
-            bIsDragging = true;
-            DraggedNode = Hit;
-            Nodes[Hit].bFixed = true;
-            Nodes[Hit].Velocity = FVector2D::ZeroVector;
-            LastMousePos = LocalPos;
-            return FReply::Handled().CaptureMouse(SharedThis(this));
+            continue;
         }
 
-        bIsPanning = true;
-        LastMousePos = MouseEvent.GetScreenSpacePosition();
-        return FReply::Handled().CaptureMouse(SharedThis(this));
+        Node.AppearAlpha = Target > Node.AppearAlpha ? FMath::Min(Node.AppearAlpha + Step, 1.f) : FMath::Max(Node.AppearAlpha - Step, 0.f);
+        if (Node.AppearAlpha <= 0.f)
+        {
+            // Faded out plugins leave the solver and the visible set
+            Node.bActive = false;
+            SetTimelineShown(i, false);
+        }
     }
-    else if (MouseEvent.GetEffectingButton() == EKeys::RightMouseButton)
+
+    for (auto It = TimelineEdgeFades.CreateIterator(); It; ++It)
     {
-        bIsPanning = true;
-        LastMousePos = MouseEvent.GetScreenSpacePosition();
-        return FReply::Handled().CaptureMouse(SharedThis(this));
+        FTimelineEdgeFade& Fade = It.Value();
+        Fade.Alpha += Fade.bAdded ? Step : -Step;
+        if (Fade.Alpha >= 1.f || Fade.Alpha <= 0.f)
+        {
+            It.RemoveCurrent();
+        }
     }
+}
 
-    return FReply::Unhandled();
+void SNsSpyglassGraphWidget::ClearTimeline()
+{
+    History.Reset();
+    TimelineCommit = INDEX_NONE;
+    TimelinePresent.Empty();
+    TimelineShown.Empty();
+    TimelineAppeared.Reset();
+    TimelineEdgeFades.Reset();
+    bTimelineDirty = false;
+    bTimelineCyclesStale = false;
+    bTimelineScrubbing = false;
 }
 
-FReply SNsSpyglassGraphWidget::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+void SNsSpyglassGraphWidget::SetShowBuildHeat(const bool bShow)
 {
-    if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
+    bShowBuildHeat = bShow;
+    if (bShowBuildHeat && !bShowingDiff && !History.IsValid())
     {
-        if (bIsDragging && Nodes.IsValidIndex(DraggedNode))
-        {
-            Nodes[DraggedNode].bFixed = false;
-            Nodes[DraggedNode].Velocity = FVector2D::ZeroVector;
-        }
-        bIsDragging = false;
-        DraggedNode = INDEX_NONE;
-        bIsPanning = false;
-        return FReply::Handled().ReleaseMouseCapture();
+        // A build may have run since the last scan, only the new traces are parsed
+        FNsSpyglassBuildTimings::Get().Request(Nodes, true);
     }
-    else if (MouseEvent.GetEffectingButton() == EKeys::RightMouseButton)
+    else
     {
-        bIsPanning = false;
-        return FReply::Handled().ReleaseMouseCapture();
+        BuildTimings.Reset();
     }
-
-    return FReply::Unhandled();
 }
 
-FReply SNsSpyglassGraphWidget::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+void SNsSpyglassGraphWidget::SetShowContentEdges(bool bShow)
 {
-    const FVector2D LocalPos = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+    bShowContentEdges = bShow;
+    if (bShowContentEdges && !bShowingDiff && !History.IsValid())
+    {
+        FNsSpyglassContentRollup::Get().Request(Nodes);
+    }
+}
 
-    if (bIsDragging && Nodes.IsValidIndex(DraggedNode))
+void SNsSpyglassGraphWidget::SetShowIncludeEdges(const bool bShow)
+{
+    bShowIncludeEdges = bShow;
+    if (bShowIncludeEdges && !bShowingDiff && !History.IsValid())
     {
-        const FVector2D Delta = (LocalPos - LastMousePos) / ZoomAmount;
-        Nodes[DraggedNode].Position += Delta;
-        LastMousePos = LocalPos;
-        return FReply::Handled();
+        // Sources may have changed since the last scan, only those files are read again
+        FNsSpyglassIncludeScanner::Get().Request(Nodes, true);
     }
-    else if (bIsPanning)
+    else
     {
-        const FVector2D Delta = MouseEvent.GetScreenSpacePosition() - LastMousePos;
-        ViewOffset += Delta;
-        LastMousePos = MouseEvent.GetScreenSpacePosition();
-        return FReply::Handled();
+        IncludeResult.Reset();
     }
+}
 
-    const int32 NewHover = HitTestNode(LocalPos, MyGeometry.GetLocalSize());
-    if (HoveredNode != NewHover)
+void SNsSpyglassGraphWidget::PrepareSession()
+{
+    if (TransitionBlend < 1.f && TransitionTarget.Num() == Nodes.Num())
     {
-        HoveredNode = NewHover;
-        if (HoveredNode != INDEX_NONE)
-        {
-            SetToolTipText(FText::FromString(Nodes[HoveredNode].Name));
-            OnNodeHovered.ExecuteIfBound(Nodes[HoveredNode].Plugin);
-        }
-        else
+        for (int32 i : VisibleNodes)
         {
-            SetToolTipText(FText());
-            OnNodeHovered.ExecuteIfBound(nullptr);
+            Nodes[i].Position = TransitionTarget[i];
         }
     }
+    TransitionStart.Reset();
+    TransitionTarget.Reset();
+    TransitionBlend = 1.f;
 
-    return FReply::Unhandled();
+    bIntroRunning = false;
+    for (FPluginNode& Node : Nodes)
+    {
+        Node.bActive = true;
+        Node.AppearAlpha = 1.f;
+        Node.bFixed = false;
+        Node.Velocity = FVector2D::ZeroVector;
+    }
+
+    HoveredNode = INDEX_NONE;
+    DraggedNode = INDEX_NONE;
+    bIsDragging = false;
+    bIsPanning = false;
+    bLocalSettled = false;
+    EdgeBundles.Reset();
+    bBundlePending = false;
+    ++BundleGeneration;
+    PrevPositions.Reset();
+    SettleTime = 0.f;
+    LastSolverSeconds = 0.0;
 }
 
-FReply SNsSpyglassGraphWidget::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+void SNsSpyglassGraphWidget::StartRecording()
 {
-    const FVector2D LocalMousePos = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
-    const FVector2D Center = MyGeometry.GetLocalSize() * 0.5f;
-
-    const float OldZoom = ZoomAmount;
-    ZoomAmount *= FMath::Pow(1.1f, MouseEvent.GetWheelDelta());
-    ZoomAmount = FMath::Clamp(ZoomAmount, 0.2f, 10.f);
-
-    const float ZoomRatio = ZoomAmount / OldZoom;
-    ViewOffset = LocalMousePos - Center - (LocalMousePos - Center - ViewOffset) * ZoomRatio;
-
-    return FReply::Handled();
+    ExitFocus();
+    PrepareSession();
+
+    Recording = MakeUnique<FNsSpyglassSession>();
+    Recording->Seed = static_cast<int32>(FPlatformTime::Cycles());
+    Random.Initialize(Recording->Seed);
+    StarSeed = Random.GetUnsignedInt();
+    Recording->Settings = FNsSpyglassSessionSettings::Capture();
+    RecordedSettings = Recording->Settings;
+    Recording->ViewSize = LastViewSize;
+    Recording->ViewScale = LastViewScale;
+    Recording->ViewOffset = ViewOffset;
+    Recording->ZoomAmount = ZoomAmount;
+    Recording->LayoutMode = static_cast<uint8>(LayoutMode);
+    Recording->FilterText = FilterText;
+    FNsSpyglassSnapshot::Write(Nodes, Recording->Snapshot);
 }
 
-void SNsSpyglassGraphWidget::RecenterView()
+bool SNsSpyglassGraphWidget::StopRecording(const FString& FilePath)
 {
-    ViewOffset = FVector2D::ZeroVector;
-    ZoomAmount = 0.75f;
+    if (!Recording.IsValid())
+    {
+        return false;
+    }
+
+    const TUniquePtr<FNsSpyglassSession> Session = MoveTemp(Recording);
+    return Session->FrameDeltas.Num() > 0 && Session->Save(FilePath);
 }
 
-void SNsSpyglassGraphWidget::RebuildGraph()
+void SNsSpyglassGraphWidget::RecordEvent(const ENsSpyglassSessionEventType Type, const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
-    BuildNodes(FVector2D(960.f, 540.f));
-    RecenterView();
+    if (!Recording.IsValid())
+    {
+        return;
+    }
+
+    FNsSpyglassSessionEvent Event;
+    Event.Type = Type;
+    Event.Position = FVector2f(MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()));
+    Event.Button = MouseEvent.GetEffectingButton() == EKeys::RightMouseButton ? 1 : 0;
+    Event.WheelDelta = MouseEvent.GetWheelDelta();
+    RecordEvent(MoveTemp(Event));
 }
 
-void SNsSpyglassGraphWidget::SetOnNodeHovered(FOnNodeHovered InDelegate)
+void SNsSpyglassGraphWidget::RecordEvent(FNsSpyglassSessionEvent&& Event)
 {
-    OnNodeHovered = InDelegate;
+    if (Recording.IsValid())
+    {
+        Event.Frame = Recording->FrameDeltas.Num();
+        Recording->Events.Add(MoveTemp(Event));
+    }
 }
 
-void SNsSpyglassGraphWidget::RunForceAtlas2Step(TArray<FPluginNode>& InNodes, int32 InRootIndex, float Repulsion, float Gravity, float DeltaTime)
+bool SNsSpyglassGraphWidget::BeginReplay(const FNsSpyglassSession& Session, FString& OutError)
 {
-    const int32 Num = InNodes.Num();
-    if (Num <= 1) return;
-
-    const float MinDist = 25.f;
+    TArray64<uint8> Bytes;
+    Bytes.Append(Session.Snapshot.GetData(), Session.Snapshot.Num());
+    FNsSpyglassSnapshotView View;
+    if (!View.OpenMemory(MoveTemp(Bytes), OutError))
+    {
+        return false;
+    }
 
-    // Feel tuning
-    const float Damping  = 0.90f;
-    const float MaxSpeed = 1000.f;
-    const float SimSpeed = bIsDragging ? 60.f : 40.f;
+    ResetFocus();
+    Recording.Reset();
+    bReplaying = true;
+    bShowingDiff = false;
+    Diff = FNsSpyglassGraphDiff();
+    ClearTimeline();
+    FNsSpyglassSnapshot::Read(View, Nodes);
 
-    const float EdgeStrength = UNsSpyglassSettings::GetSettings()->AttractionScale;
-    const float RestLength = 140.f;   // edges only pull when stretched
+    RootIndex = INDEX_NONE;
+    SelectedCycle = INDEX_NONE;
+    ContentResult.Reset();
+    UnusedResult.Reset();
+    bUnusedSearchPending = false;
+    PrepareSession();
+    Random.Initialize(Session.Seed);
+    StarSeed = Random.GetUnsignedInt();
+
+    ViewOffset = Session.ViewOffset;
+    ZoomAmount = Session.ZoomAmount;
+    LayoutMode = static_cast<ENsSpyglassLayoutMode>(Session.LayoutMode);
+    ++LayeredGeneration;
+    FilterText = Session.FilterText;
+
+    FNsSpyglassCycleDetector::Compute(Nodes, CycleInfo);
+    PluginSetHash = FNsSpyglassContentRollup::ComputePluginSetHash(Nodes);
+    ++NodesRevision;
+    Query = MakeShared<FNsSpyglassGraphQuery, ESPMode::ThreadSafe>(Nodes);
+    SearchIndex.Build(Nodes);
+    ApplyFilter();
+    ClearSelection();
+    RefreshLayout();
+    OnGraphRebuilt.ExecuteIfBound();
+    return true;
+}
 
-    TArray<float> Mass;
-    Mass.SetNumUninitialized(Num);
-    for (int32 i = 0; i < Num; ++i)
+void SNsSpyglassGraphWidget::TrackLayoutMotion(const float DeltaTime)
+{
+    float MaxMoveSqr = PrevPositions.Num() == Nodes.Num() ? 0.f : MAX_flt;
+    for (int32 i = 0; i < PrevPositions.Num() && i < Nodes.Num(); ++i)
     {
-        Mass[i] = 1.f + InNodes[i].Links.Num();
+        MaxMoveSqr = FMath::Max(MaxMoveSqr, FVector2D::DistSquared(Nodes[i].Position, PrevPositions[i]));
     }
-
-    TArray<FVector2D> Force;
-    Force.Init(FVector2D::ZeroVector, Num);
-
-    // --- Repulsion (pairwise) ---
-    for (int32 i = 0; i < Num; ++i)
+    PrevPositions.SetNumUninitialized(Nodes.Num());
+    for (int32 i = 0; i < Nodes.Num(); ++i)
     {
-        if (!InNodes[i].bActive) continue;
-
-        for (int32 j = i + 1; j < Num; ++j)
-        {
-            if (!InNodes[j].bActive) continue;
-
-            FVector2D Delta = InNodes[i].Position - InNodes[j].Position;
-
-            float DistSqr = Delta.SizeSquared();
-            DistSqr = FMath::Max(DistSqr, MinDist * MinDist);
-
-            const float Dist = FMath::Sqrt(DistSqr);
-            const FVector2D Dir = Delta / Dist;
-
-            const float F = Repulsion * Mass[i] * Mass[j] / DistSqr;
-
-            Force[i] += Dir * F;
-            Force[j] -= Dir * F;
-        }
+        PrevPositions[i] = Nodes[i].Position;
     }
+    SettleTime = MaxMoveSqr < FMath::Square(0.1f) ? SettleTime + DeltaTime : 0.f;
+}
 
-    // --- Attraction (edges) ---
-    for (int32 i = 0; i < Num; ++i)
+void SNsSpyglassGraphWidget::RemoveOverlaps()
+{
+    if (UsesSharedLayout())
     {
-        if (!InNodes[i].bActive) continue;
-
-        for (int32 Link : InNodes[i].Links)
-        {
-            if (!InNodes.IsValidIndex(Link)) continue;
-            if (!InNodes[Link].bActive) continue;
-
-            // critical: process each undirected edge once
-            if (Link <= i) continue;
-
-            FVector2D Delta = InNodes[i].Position - InNodes[Link].Position;
-
-            float Dist = Delta.Size();
-            Dist = FMath::Max(Dist, MinDist);
+        UNsSpyglassGraphSubsystem::Get().RemoveOverlaps();
+        return;
+    }
 
-            const FVector2D Dir = Delta / Dist;
+    FNsSpyglassOverlapRemoval::Resolve(Nodes, VisibleNodes, RootIndex);
+}
 
-            // only pull when stretched past rest length
-            const float Stretch = FMath::Max(0.f, Dist - RestLength);
-            const float F = Stretch * EdgeStrength;
+void SNsSpyglassGraphWidget::UpdateEdgeBundles(const float DeltaTime)
+{
+    if (!UNsSpyglassSettings::GetSettings()->bBundleEdges)
+    {
+        EdgeBundles.Reset();
+        bBundlePending = false;
+        return;
+    }
 
-            Force[i] -= Dir * F;
-            Force[Link] += Dir * F;
-        }
+    // Bundles are drawn at the positions they were computed for, drop them once the layout moves on
+    bool bStale = BundleSource.Num() != Nodes.Num() || BundleMask != VisibleMask;
+    for (int32 i = 0; i < VisibleNodes.Num() && !bStale; ++i)
+    {
+        const int32 Node = VisibleNodes[i];
+        bStale = FVector2D::DistSquared(Nodes[Node].Position, BundleSource[Node]) > FMath::Square(BundleDriftTolerance);
+    }
+    if (bStale && (EdgeBundles.IsValid() || bBundlePending))
+    {
+        EdgeBundles.Reset();
+        bBundlePending = false;
+        ++BundleGeneration;
     }
 
-    // --- Gravity (toward origin) ---
-    for (int32 i = 0; i < Num; ++i)
+    if (EdgeBundles.IsValid() || bBundlePending || SettleTime < LayoutSettleSeconds || bIsDragging)
     {
-        if (!InNodes[i].bActive) continue;
-        Force[i] -= InNodes[i].Position * Gravity * Mass[i];
+        return;
     }
 
-    // --- Integrate with damping ---
-    for (int32 i = 0; i < Num; ++i)
+    TArray<FIntPoint> Edges;
+    for (int32 i : VisibleNodes)
     {
-        if (!InNodes[i].bActive) continue;
-        if (i == InRootIndex || InNodes[i].bFixed) continue;
+        for (int32 Link : Nodes[i].Dependencies)
+        {
+            if (Nodes.IsValidIndex(Link) && Link != i && VisibleMask[Link])
+            {
+                Edges.Add(FIntPoint(i, Link));
+            }
+        }
+    }
 
-        const FVector2D Accel = Force[i] / Mass[i];
+    BundleSource = PrevPositions;
+    BundleMask = VisibleMask;
+    bBundlePending = true;
 
-        InNodes[i].Velocity += Accel * DeltaTime * SimSpeed;
-        InNodes[i].Velocity *= Damping;
-        InNodes[i].Velocity = ClampToMaxSize2D(InNodes[i].Velocity, MaxSpeed);
+    // Bundling is quadratic in the edge count, keep it off the game thread
+    TWeakPtr<SNsSpyglassGraphWidget> WeakThis = SharedThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Generation = BundleGeneration, Positions = BundleSource, Edges = MoveTemp(Edges)]()
+    {
+        TSharedPtr<FNsSpyglassEdgeBundles, ESPMode::ThreadSafe> Bundles = MakeShared<FNsSpyglassEdgeBundles, ESPMode::ThreadSafe>();
+        FNsSpyglassEdgeBundler::Compute(Positions, Edges, *Bundles);
 
-        InNodes[i].Position += InNodes[i].Velocity * DeltaTime;
-    }
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Generation, Bundles]()
+        {
+            const TSharedPtr<SNsSpyglassGraphWidget> This = WeakThis.Pin();
+            if (This.IsValid() && This->bBundlePending && This->BundleGeneration == Generation)
+            {
+                This->EdgeBundles = Bundles;
+                This->bBundlePending = false;
+            }
+        });
+    });
 }
 
-FVector2D SNsSpyglassGraphWidget::ClampToMaxSize2D(const FVector2D& V, float MaxSize)
+void SNsSpyglassGraphWidget::RunForceAtlas2Step(const float DeltaTime)
 {
-    const float MaxSqr = MaxSize * MaxSize;
-    const float Sqr = V.SizeSquared();
+    const UNsSpyglassSettings* Settings = UNsSpyglassSettings::GetSettings();
 
-    if (Sqr <= MaxSqr || Sqr <= KINDA_SMALL_NUMBER)
-    {
-        return V;
-    }
+    FNsSpyglassForceParams Params;
+    Params.Repulsion = Settings->Repulsion * 100.f;
+    Params.Gravity = Settings->CenterForce;
+    Params.EdgeStrength = Settings->AttractionScale;
+    Params.SimSpeed = bIsDragging ? 60.f : 40.f;
 
-    return V * (MaxSize / FMath::Sqrt(Sqr));
+    // Filtered-out nodes are skipped entirely, so a narrow filter shrinks the O(n^2) repulsion pass
+    FNsSpyglassForceLayout::Step(Nodes, VisibleNodes, VisibleMask, RootIndex, Params, DeltaTime);
 }
 
 void SNsSpyglassGraphWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
 {
-    const UNsSpyglassSettings* Settings = UNsSpyglassSettings::GetSettings();
+    FNsSpyglassFrameAllocations::FCountScope CountAllocations;
     const float Delta = FMath::Min(InDeltaTime, 0.05f);
+    LastViewSize = AllottedGeometry.GetLocalSize();
+    LastViewScale = AllottedGeometry.Scale;
+    LastSolverSeconds = 0.0;
+
+    // Batches of the shared build stream in one per frame until the view caught up
+    HandleModelChanged();
+
+    if (Recording.IsValid())
+    {
+        // Events are stamped with the index of the frame they precede, so settings changes go in before this delta
+        const FNsSpyglassSessionSettings Current = FNsSpyglassSessionSettings::Capture();
+        if (Current != RecordedSettings)
+        {
+            RecordedSettings = Current;
+            FNsSpyglassSessionEvent Event;
+            Event.Type = ENsSpyglassSessionEventType::Settings;
+            Event.Settings = Current;
+            RecordEvent(MoveTemp(Event));
+        }
+        Recording->FrameDeltas.Add(InDeltaTime);
+    }
 
     if (bIntroRunning)
     {
@@ -742,25 +2349,100 @@ void SNsSpyglassGraphWidget::Tick(const FGeometry& AllottedGeometry, const doubl
         }
     }
 
-    RunForceAtlas2Step(Nodes, RootIndex, Settings->Repulsion * 100.f, Settings->CenterForce, Delta);
+    if (History.IsValid())
+    {
+        TickTimeline(Delta);
+    }
 
-    for (FBackgroundStar& Star : Stars)
+    if (TransitionBlend < 1.f && TransitionTarget.Num() == Nodes.Num() && TransitionStart.Num() == Nodes.Num())
     {
-        Star.Alpha = FMath::FInterpTo(Star.Alpha, Star.TargetAlpha, Delta, Star.FadeSpeed);
-        if (FMath::IsNearlyEqual(Star.Alpha, Star.TargetAlpha, 0.01f))
+        // Ease into the new layout before simulating it
+        TransitionBlend = FMath::Min(TransitionBlend + Delta / 0.4f, 1.f);
+        const float Alpha = FMath::InterpEaseInOut(0.f, 1.f, TransitionBlend, 2.f);
+        for (int32 i : VisibleNodes)
         {
-            if (Star.TargetAlpha > 0.f)
-            {
-                Star.TargetAlpha = 0.f;
-            }
-            else
+            Nodes[i].Position = FMath::Lerp(TransitionStart[i], TransitionTarget[i], Alpha);
+        }
+    }
+    else if (UsesSharedLayout())
+    {
+        const FNsSpyglassGraphLayoutRef Layout = UNsSpyglassGraphSubsystem::Get().GetLayout();
+        if (Layout->ModelVersion == ModelVersion && Layout->Positions.Num() == Nodes.Num())
+        {
+            for (int32 i = 0; i < Nodes.Num(); ++i)
             {
-                Star.Position.X = FMath::FRandRange(-StarsViewSize.X, StarsViewSize.X);
-                Star.Position.Y = FMath::FRandRange(-StarsViewSize.Y, StarsViewSize.Y);
-                Star.TargetAlpha = FMath::FRandRange(0.2f, 1.f);
-                Star.FadeSpeed = FMath::FRandRange(0.5f, 1.5f);
+                // The dragged node follows the mouse rather than the last published step
+                if (i != DraggedNode)
+                {
+                    Nodes[i].Position = Layout->Positions[i];
+                }
             }
         }
     }
+    else if (LayoutMode == ENsSpyglassLayoutMode::Force && !bLocalSettled)
+    {
+        const double SolverStart = FPlatformTime::Seconds();
+        RunForceAtlas2Step(Delta);
+        LastSolverSeconds = FPlatformTime::Seconds() - SolverStart;
+    }
+
+    TrackLayoutMotion(Delta);
+
+    // A private force layout stops once it settled, after one pass that separates overlapping nodes
+    if (!UsesSharedLayout() && LayoutMode == ENsSpyglassLayoutMode::Force && !bLocalSettled && !bIsDragging && SettleTime >= LayoutSettleSeconds)
+    {
+        RemoveOverlaps();
+        bLocalSettled = true;
+    }
+
+    UpdateEdgeBundles(Delta);
+
+    // Pick up finished content gathers, ignoring results for another plugin set
+    if (bShowContentEdges || bUnusedSearchPending)
+    {
+        FNsSpyglassContentRollup& Rollup = FNsSpyglassContentRollup::Get();
+        if (Rollup.GetResultVersion() != ContentResultVersion)
+        {
+            ContentResultVersion = Rollup.GetResultVersion();
+            FNsSpyglassContentResultPtr Result = Rollup.GetResult();
+            ContentResult = (Result.IsValid() && Result->PluginSetHash == PluginSetHash) ? Result : nullptr;
+        }
+    }
+
+    // Timings are published for a plugin set, a view showing another set keeps none
+    if (bShowBuildHeat)
+    {
+        const FNsSpyglassBuildTimingResultPtr Result = FNsSpyglassBuildTimings::Get().GetResult();
+        BuildTimings = (Result.IsValid() && Result->PluginSetHash == PluginSetHash) ? Result : nullptr;
+    }
+    if (bShowIncludeEdges)
+    {
+        const FNsSpyglassIncludeResultPtr Result = FNsSpyglassIncludeScanner::Get().GetResult();
+        IncludeResult = (Result.IsValid() && Result->PluginSetHash == PluginSetHash) ? Result : nullptr;
+    }
+
+    if (bUnusedSearchPending && !FNsSpyglassContentRollup::Get().IsGathering())
+    {
+        bUnusedSearchPending = false;
+
+        // Build rule scanning touches the disk, keep it off the game thread
+        TWeakPtr<SNsSpyglassGraphWidget> WeakThis = SharedThis(this);
+        Async(EAsyncExecution::ThreadPool, [WeakThis, NodesCopy = Nodes, Content = ContentResult]()
+        {
+            TSharedPtr<FNsSpyglassUnusedResult, ESPMode::ThreadSafe> Result = MakeShared<FNsSpyglassUnusedResult, ESPMode::ThreadSafe>();
+            FNsSpyglassUnusedPluginFinder::Find(NodesCopy, Content.Get(), *Result);
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Result]()
+            {
+                const TSharedPtr<SNsSpyglassGraphWidget> This = WeakThis.Pin();
+                if (This.IsValid() && Result->PluginSetHash == This->PluginSetHash)
+                {
+                    This->UnusedResult = Result;
+                    This->OnUnusedPluginsFound.ExecuteIfBound(Result);
+                }
+            });
+        });
+    }
+
 }
 
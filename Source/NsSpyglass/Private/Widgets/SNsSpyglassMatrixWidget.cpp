@@ -0,0 +1,422 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Widgets/SNsSpyglassMatrixWidget.h"
+#include "Algo/BinarySearch.h"
+#include "Async/Async.h"
+#include "Fonts/FontMeasure.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Rendering/DrawElements.h"
+#include "Rendering/SlateRenderer.h"
+#include "Styling/CoreStyle.h"
+
+namespace
+{
+    const FLinearColor BackgroundColor(0.01f, 0.01f, 0.015f, 1.f);
+    const FLinearColor FrameColor(1.f, 1.f, 1.f, 0.25f);
+    const FLinearColor DiagonalColor(1.f, 1.f, 1.f, 0.08f);
+    const FLinearColor CellColor(0.35f, 0.75f, 1.f, 1.f);
+    const FLinearColor CycleCellColor(1.f, 0.25f, 0.15f, 1.f);
+    const FLinearColor CycleBlockColor(1.f, 0.25f, 0.15f, 0.6f);
+    const FLinearColor HoverBandColor(1.f, 1.f, 1.f, 0.06f);
+
+    /** Blocks narrower than this on screen are merged into the next level. */
+    constexpr float MinBlockPixels = 6.f;
+
+    /** Zoom limits, the smallest cell is relative to fitting the whole matrix into the view. */
+    constexpr float MinFitFraction = 0.5f;
+    constexpr float MaxCellSize = 40.f;
+
+    /** Cells at least this tall get the name of their row beside the diagonal. */
+    constexpr float LabelCellSize = 12.f;
+
+    /** Margin kept around the matrix when fitting it into the view. */
+    constexpr float FitMargin = 16.f;
+
+    /** Smallest block alpha, so single edges stay visible next to dense blocks. */
+    constexpr float MinBlockAlpha = 0.3f;
+
+    /** Append a quad of one color to a vertex batch. */
+    void AddQuad(TArray<FSlateVertex>& Vertices, TArray<SlateIndex>& Indices, const FSlateRenderTransform& Transform, const FVector2f& Min, const FVector2f& Max, const FColor& Color)
+    {
+        const SlateIndex First = static_cast<SlateIndex>(Vertices.Num());
+        Vertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(Transform, Min, FVector2f(0.f, 0.f), Color));
+        Vertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(Transform, FVector2f(Max.X, Min.Y), FVector2f(1.f, 0.f), Color));
+        Vertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(Transform, Max, FVector2f(1.f, 1.f), Color));
+        Vertices.Add(FSlateVertex::Make<ESlateVertexRounding::Disabled>(Transform, FVector2f(Min.X, Max.Y), FVector2f(0.f, 1.f), Color));
+        Indices.Append({ First, static_cast<SlateIndex>(First + 1), static_cast<SlateIndex>(First + 2), First, static_cast<SlateIndex>(First + 2), static_cast<SlateIndex>(First + 3) });
+    }
+}
+
+void SNsSpyglassMatrixWidget::Construct(const FArguments& InArgs)
+{
+}
+
+void SNsSpyglassMatrixWidget::SetOnNodeHovered(FOnNodeHovered InDelegate)
+{
+    OnNodeHovered = InDelegate;
+}
+
+FVector2D SNsSpyglassMatrixWidget::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+    return FVector2D(400.f, 400.f);
+}
+
+void SNsSpyglassMatrixWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+    LastViewSize = AllottedGeometry.GetLocalSize();
+
+    // Hidden widgets are not ticked, so the matrix is only kept up to date while it is shown
+    RequestMatrix();
+
+    if (bFitPending && Matrix.IsValid() && LastViewSize.X > 0.f && LastViewSize.Y > 0.f)
+    {
+        FitToView(LastViewSize);
+        bFitPending = false;
+    }
+}
+
+void SNsSpyglassMatrixWidget::RequestMatrix()
+{
+    if (bBuildPending)
+    {
+        return;
+    }
+
+    const FNsSpyglassGraphModelRef Latest = UNsSpyglassGraphSubsystem::Get().GetModel();
+    if (Model.IsValid() && Model->Version == Latest->Version)
+    {
+        return;
+    }
+
+    bBuildPending = true;
+    TWeakPtr<SNsSpyglassMatrixWidget> WeakThis = SharedThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Latest]()
+    {
+        TSharedPtr<FNsSpyglassDependencyMatrix, ESPMode::ThreadSafe> Built = MakeShared<FNsSpyglassDependencyMatrix, ESPMode::ThreadSafe>();
+        Built->Build(Latest->Nodes, Latest->CycleInfo);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Latest, Built]()
+        {
+            const TSharedPtr<SNsSpyglassMatrixWidget> This = WeakThis.Pin();
+            if (!This.IsValid())
+            {
+                return;
+            }
+
+            // A different plugin set starts over at the fitted view, a rebuild of the same set keeps zoom and pan
+            This->bFitPending |= !This->Model.IsValid() || This->Model->PluginSetHash != Latest->PluginSetHash;
+            This->bBuildPending = false;
+            This->Model = Latest;
+            This->Matrix = Built;
+            This->HoveredRow = INDEX_NONE;
+            This->HoveredColumn = INDEX_NONE;
+        });
+    });
+}
+
+void SNsSpyglassMatrixWidget::FitToView(const FVector2D& ViewSize)
+{
+    const int32 Num = Matrix.IsValid() ? FMath::Max(1, Matrix->Num()) : 1;
+    const float Available = FMath::Max(1.f, static_cast<float>(FMath::Min(ViewSize.X, ViewSize.Y)) - FitMargin * 2.f);
+    CellSize = FMath::Min(MaxCellSize, Available / Num);
+    ViewOffset = (ViewSize - FVector2D(CellSize * Num)) * 0.5f;
+}
+
+int32 SNsSpyglassMatrixWidget::GetDrawLevel() const
+{
+    int32 Level = 0;
+    while (Level + 1 < Matrix->GetNumLevels() && CellSize * (1 << Level) < MinBlockPixels)
+    {
+        ++Level;
+    }
+    return Level;
+}
+
+void SNsSpyglassMatrixWidget::SetHoveredCell(const int32 Row, const int32 Column)
+{
+    HoveredColumn = Column;
+    if (Row == HoveredRow)
+    {
+        return;
+    }
+
+    HoveredRow = Row;
+    TSharedPtr<IPlugin> Plugin;
+    if (Row != INDEX_NONE)
+    {
+        Plugin = Model->Nodes[Matrix->GetNode(Row)].Plugin;
+    }
+    OnNodeHovered.ExecuteIfBound(Plugin);
+}
+
+FString SNsSpyglassMatrixWidget::DescribeHover() const
+{
+    if (!Matrix.IsValid() || HoveredRow == INDEX_NONE || HoveredColumn == INDEX_NONE)
+    {
+        return FString();
+    }
+
+    const int32 Level = GetDrawLevel();
+    if (Level == 0)
+    {
+        const FString& RowName = Model->Nodes[Matrix->GetNode(HoveredRow)].Name;
+        const FString& ColumnName = Model->Nodes[Matrix->GetNode(HoveredColumn)].Name;
+        if (HoveredRow == HoveredColumn)
+        {
+            return RowName;
+        }
+        return FString::Printf(TEXT("%s %s %s"), *RowName, Matrix->HasEdge(HoveredRow, HoveredColumn) ? TEXT("depends on") : TEXT("does not depend on"), *ColumnName);
+    }
+
+    // Aggregated blocks name the plugin range on both sides
+    const int32 BlockRow = HoveredRow >> Level;
+    const int32 BlockColumn = HoveredColumn >> Level;
+    int32 Count = 0;
+    Matrix->ForEachBlock(Level, BlockRow, BlockRow + 1, BlockColumn, BlockColumn + 1, [&Count](int32, int32, const int32 BlockCount)
+    {
+        Count = BlockCount;
+    });
+
+    const auto Range = [this, Level](const int32 Block)
+    {
+        const int32 First = Block << Level;
+        const int32 Last = FMath::Min(((Block + 1) << Level), Matrix->Num()) - 1;
+        return FString::Printf(TEXT("%s .. %s"), *Model->Nodes[Matrix->GetNode(First)].Name, *Model->Nodes[Matrix->GetNode(Last)].Name);
+    };
+    return FString::Printf(TEXT("%d %s from [%s] to [%s]"), Count, Count == 1 ? TEXT("dependency") : TEXT("dependencies"), *Range(BlockRow), *Range(BlockColumn));
+}
+
+int32 SNsSpyglassMatrixWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+    const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+    const FSlateBrush* WhiteBrush = FCoreStyle::Get().GetBrush("WhiteBrush");
+    const FSlateFontInfo Font = FCoreStyle::Get().GetFontStyle("NormalFont");
+
+    FSlateDrawElement::MakeBox(OutDrawElements, LayerId, AllottedGeometry.ToPaintGeometry(), WhiteBrush, ESlateDrawEffect::None, BackgroundColor);
+
+    if (!Matrix.IsValid() || Matrix->Num() == 0)
+    {
+        FSlateDrawElement::MakeText(
+            OutDrawElements,
+            LayerId + 1,
+            AllottedGeometry.ToPaintGeometry(LocalSize, FSlateLayoutTransform(FVector2D(12.f, 12.f))),
+            bBuildPending ? TEXT("Building dependency matrix...") : TEXT("No plugins"),
+            Font,
+            ESlateDrawEffect::None,
+            FLinearColor::White
+        );
+        return LayerId + 2;
+    }
+
+    const int32 Num = Matrix->Num();
+    const int32 Level = GetDrawLevel();
+    const float BlockSize = CellSize * (1 << Level);
+    const int32 NumBlocks = ((Num - 1) >> Level) + 1;
+
+    // Blocks intersecting the view, everything else is never visited
+    const int32 RowBegin = FMath::Max(0, FMath::FloorToInt(-ViewOffset.Y / BlockSize));
+    const int32 RowEnd = FMath::Min(NumBlocks, FMath::CeilToInt((LocalSize.Y - ViewOffset.Y) / BlockSize));
+    const int32 ColumnBegin = FMath::Max(0, FMath::FloorToInt(-ViewOffset.X / BlockSize));
+    const int32 ColumnEnd = FMath::Min(NumBlocks, FMath::CeilToInt((LocalSize.X - ViewOffset.X) / BlockSize));
+
+    const FSlateRenderTransform& Transform = AllottedGeometry.GetAccumulatedRenderTransform();
+    const FVector2f Origin(ViewOffset);
+    const float Gap = BlockSize >= 4.f ? 1.f : 0.f;
+
+    Vertices.Reset();
+    Indices.Reset();
+
+    // Hovered row and column bands go under the cells
+    if (HoveredRow != INDEX_NONE && HoveredColumn != INDEX_NONE)
+    {
+        const float Extent = CellSize * Num;
+        const FColor Band = HoverBandColor.ToFColor(true);
+        const float RowY = Origin.Y + (HoveredRow >> Level) * BlockSize;
+        const float ColumnX = Origin.X + (HoveredColumn >> Level) * BlockSize;
+        AddQuad(Vertices, Indices, Transform, FVector2f(Origin.X, RowY), FVector2f(Origin.X + Extent, RowY + BlockSize), Band);
+        AddQuad(Vertices, Indices, Transform, FVector2f(ColumnX, Origin.Y), FVector2f(ColumnX + BlockSize, Origin.Y + Extent), Band);
+    }
+
+    // Faint diagonal, the cells of a plugin against itself
+    const FColor Diagonal = DiagonalColor.ToFColor(true);
+    for (int32 Block = FMath::Max(RowBegin, ColumnBegin); Block < FMath::Min(RowEnd, ColumnEnd); ++Block)
+    {
+        const FVector2f Min = Origin + FVector2f(Block * BlockSize);
+        AddQuad(Vertices, Indices, Transform, Min, Min + FVector2f(BlockSize - Gap), Diagonal);
+    }
+
+    // Single cells are colored by whether the edge closes a cycle, blocks by how many edges they hold
+    const float LogMax = FMath::Loge(1.f + FMath::Max(1, Matrix->GetMaxCount(Level)));
+    Matrix->ForEachBlock(Level, RowBegin, RowEnd, ColumnBegin, ColumnEnd, [this, Level, BlockSize, Gap, LogMax, &Origin, &Transform](const int32 Row, const int32 Column, const int32 Count)
+    {
+        FLinearColor Color = CellColor;
+        if (Level == 0)
+        {
+            if (Model->CycleInfo.IsCyclicEdge(Matrix->GetNode(Row), Matrix->GetNode(Column)))
+            {
+                Color = CycleCellColor;
+            }
+        }
+        else
+        {
+            Color.A = FMath::Lerp(MinBlockAlpha, 1.f, FMath::Loge(1.f + Count) / LogMax);
+        }
+
+        const FVector2f Min = Origin + FVector2f(Column * BlockSize, Row * BlockSize);
+        AddQuad(Vertices, Indices, Transform, Min, Min + FVector2f(BlockSize - Gap), Color.ToFColor(true));
+    });
+
+    if (Indices.Num() > 0)
+    {
+        const FSlateResourceHandle Handle = FSlateApplication::Get().GetRenderer()->GetResourceHandle(*WhiteBrush);
+        FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId + 1, Handle, Vertices, Indices, nullptr, 0, 0);
+    }
+
+    // Matrix frame and the outlines of cycle blocks on screen
+    const float Extent = CellSize * Num;
+    FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 2, AllottedGeometry.ToPaintGeometry(),
+        TArray<FVector2D>{ ViewOffset, ViewOffset + FVector2D(Extent, 0.f), ViewOffset + FVector2D(Extent), ViewOffset + FVector2D(0.f, Extent), ViewOffset },
+        ESlateDrawEffect::None, FrameColor, true, 1.f);
+
+    const TArray<FIntPoint>& CycleBlocks = Matrix->GetCycleBlocks();
+    const int32 VisibleBegin = FMath::Max(RowBegin, ColumnBegin) << Level;
+    const int32 VisibleEnd = FMath::Min(RowEnd, ColumnEnd) << Level;
+    for (int32 k = Algo::LowerBoundBy(CycleBlocks, VisibleBegin, [](const FIntPoint& CycleBlock) { return CycleBlock.X + CycleBlock.Y; }); k < CycleBlocks.Num() && CycleBlocks[k].X < VisibleEnd; ++k)
+    {
+        const FVector2D Min = ViewOffset + FVector2D(CycleBlocks[k].X * CellSize);
+        const FVector2D Max = Min + FVector2D(CycleBlocks[k].Y * CellSize);
+        FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 2, AllottedGeometry.ToPaintGeometry(),
+            TArray<FVector2D>{ Min, FVector2D(Max.X, Min.Y), Max, FVector2D(Min.X, Max.Y), Min },
+            ESlateDrawEffect::None, CycleBlockColor, true, 1.5f);
+    }
+
+    // Row names beside the diagonal, where acyclic graphs leave the upper triangle empty
+    const TSharedRef<FSlateFontMeasure> Measure = FSlateApplication::Get().GetRenderer()->GetFontMeasureService();
+    if (Level == 0 && CellSize >= LabelCellSize)
+    {
+        const float TextScale = FMath::Min(1.f, CellSize / static_cast<float>(Measure->GetMaxCharacterHeight(Font)));
+        for (int32 Row = RowBegin; Row < RowEnd; ++Row)
+        {
+            const FVector2D Position = ViewOffset + FVector2D((Row + 1) * CellSize + 4.f, Row * CellSize);
+            if (Position.X >= LocalSize.X)
+            {
+                continue;
+            }
+
+            const FString& Name = Model->Nodes[Matrix->GetNode(Row)].Name;
+            FSlateDrawElement::MakeText(
+                OutDrawElements,
+                LayerId + 3,
+                AllottedGeometry.ToPaintGeometry(Measure->Measure(Name, Font), FSlateLayoutTransform(TextScale, Position)),
+                Name,
+                Font,
+                ESlateDrawEffect::None,
+                FLinearColor(1.f, 1.f, 1.f, Row == HoveredRow ? 1.f : 0.7f)
+            );
+        }
+    }
+
+    const FString Hover = DescribeHover();
+    if (!Hover.IsEmpty())
+    {
+        const FVector2D TextSize = Measure->Measure(Hover, Font);
+        FSlateDrawElement::MakeBox(OutDrawElements, LayerId + 3,
+            AllottedGeometry.ToPaintGeometry(TextSize + FVector2D(12.f, 8.f), FSlateLayoutTransform(FVector2D(8.f, 8.f))),
+            WhiteBrush, ESlateDrawEffect::None, FLinearColor(0.f, 0.f, 0.f, 0.75f));
+        FSlateDrawElement::MakeText(
+            OutDrawElements,
+            LayerId + 4,
+            AllottedGeometry.ToPaintGeometry(TextSize, FSlateLayoutTransform(FVector2D(14.f, 12.f))),
+            Hover,
+            Font,
+            ESlateDrawEffect::None,
+            FLinearColor::White
+        );
+    }
+
+    return LayerId + 5;
+}
+
+FReply SNsSpyglassMatrixWidget::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton && MouseEvent.GetEffectingButton() != EKeys::RightMouseButton)
+    {
+        return FReply::Unhandled();
+    }
+
+    bIsPanning = true;
+    LastMousePos = MouseEvent.GetScreenSpacePosition();
+    return FReply::Handled().CaptureMouse(SharedThis(this));
+}
+
+FReply SNsSpyglassMatrixWidget::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (!bIsPanning)
+    {
+        return FReply::Unhandled();
+    }
+
+    bIsPanning = false;
+    return FReply::Handled().ReleaseMouseCapture();
+}
+
+FReply SNsSpyglassMatrixWidget::OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    FitToView(MyGeometry.GetLocalSize());
+    return FReply::Handled();
+}
+
+FReply SNsSpyglassMatrixWidget::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (bIsPanning)
+    {
+        const FVector2D ScreenPos = MouseEvent.GetScreenSpacePosition();
+        ViewOffset += (ScreenPos - LastMousePos) / MyGeometry.Scale;
+        LastMousePos = ScreenPos;
+    }
+
+    if (!Matrix.IsValid())
+    {
+        return bIsPanning ? FReply::Handled() : FReply::Unhandled();
+    }
+
+    const FVector2D Cell = (MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition()) - ViewOffset) / CellSize;
+    const int32 Row = FMath::FloorToInt(Cell.Y);
+    const int32 Column = FMath::FloorToInt(Cell.X);
+    if (Row >= 0 && Row < Matrix->Num() && Column >= 0 && Column < Matrix->Num())
+    {
+        SetHoveredCell(Row, Column);
+    }
+    else
+    {
+        SetHoveredCell(INDEX_NONE, INDEX_NONE);
+    }
+    return FReply::Handled();
+}
+
+FReply SNsSpyglassMatrixWidget::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (!Matrix.IsValid())
+    {
+        return FReply::Unhandled();
+    }
+
+    // Zoom around the cursor, the cell under it stays in place
+    const FVector2D LocalPos = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+    const float FitCellSize = static_cast<float>(FMath::Min(LastViewSize.X, LastViewSize.Y)) / FMath::Max(1, Matrix->Num());
+    const float MinCellSize = FMath::Min(MaxCellSize, FitCellSize * MinFitFraction);
+    const float NewCellSize = FMath::Clamp(CellSize * FMath::Pow(1.25f, MouseEvent.GetWheelDelta()), MinCellSize, MaxCellSize);
+
+    ViewOffset = LocalPos - (LocalPos - ViewOffset) * (NewCellSize / CellSize);
+    CellSize = NewCellSize;
+    return FReply::Handled();
+}
+
+void SNsSpyglassMatrixWidget::OnMouseLeave(const FPointerEvent& MouseEvent)
+{
+    SLeafWidget::OnMouseLeave(MouseEvent);
+    if (!bIsPanning && Matrix.IsValid())
+    {
+        SetHoveredCell(INDEX_NONE, INDEX_NONE);
+    }
+}
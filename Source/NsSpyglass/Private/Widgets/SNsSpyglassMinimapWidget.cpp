@@ -0,0 +1,295 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Widgets/SNsSpyglassMinimapWidget.h"
+#include "Brushes/SlateDynamicImageBrush.h"
+#include "Rendering/DrawElements.h"
+#include "Styling/CoreStyle.h"
+#include "Widgets/SNsSpyglassGraphWidget.h"
+
+namespace
+{
+    /** Size of the widget and resolution of the density image, stretched over it. */
+    const FVector2D MinimapSize(200.f, 140.f);
+    constexpr int32 ImageWidth = 100;
+    constexpr int32 ImageHeight = 70;
+
+    /** Seconds between checks whether the image is stale. */
+    constexpr float CheckInterval = 0.2f;
+
+    /** Fraction of the graph bounds added around the nodes. */
+    constexpr float BoundsPadding = 0.08f;
+
+    /** How quickly texels saturate as more nodes land on them. */
+    constexpr float DensityGain = 0.9f;
+
+    const FLinearColor BackgroundColor(0.02f, 0.02f, 0.03f, 0.75f);
+    const FLinearColor ViewportColor(1.f, 1.f, 1.f, 0.8f);
+}
+
+void SNsSpyglassMinimapWidget::Construct(const FArguments& InArgs, const TSharedRef<SNsSpyglassGraphWidget>& InGraph)
+{
+    Graph = InGraph;
+}
+
+FVector2D SNsSpyglassMinimapWidget::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+    return MinimapSize;
+}
+
+bool SNsSpyglassMinimapWidget::NeedsUpdate() const
+{
+    const TSharedPtr<SNsSpyglassGraphWidget> GraphPin = Graph.Pin();
+    if (!GraphPin.IsValid())
+    {
+        return false;
+    }
+
+    const TArray<FPluginNode>& Nodes = GraphPin->GetNodes();
+    const TArray<int32>& Visible = GraphPin->GetVisibleNodes();
+    if (!Brush.IsValid() || Visible != SourceNodes)
+    {
+        return true;
+    }
+
+    // Movement below one texel would not change the image
+    const float Texel = FMath::Min(Bounds.GetSize().X / ImageWidth, Bounds.GetSize().Y / ImageHeight);
+    const float ToleranceSqr = FMath::Square(Texel);
+    for (int32 k = 0; k < Visible.Num(); ++k)
+    {
+        if (!Nodes.IsValidIndex(Visible[k]) || FVector2D::DistSquared(Nodes[Visible[k]].Position, SourcePositions[k]) > ToleranceSqr)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void SNsSpyglassMinimapWidget::UpdateImage()
+{
+    const TSharedPtr<SNsSpyglassGraphWidget> GraphPin = Graph.Pin();
+    if (!GraphPin.IsValid())
+    {
+        return;
+    }
+
+    const TArray<FPluginNode>& Nodes = GraphPin->GetNodes();
+    SourceNodes = GraphPin->GetVisibleNodes();
+    SourceNodes.RemoveAll([&Nodes](const int32 i) { return !Nodes.IsValidIndex(i); });
+    SourcePositions.SetNumUninitialized(SourceNodes.Num());
+
+    Bounds = FBox2D(ForceInit);
+    for (int32 k = 0; k < SourceNodes.Num(); ++k)
+    {
+        SourcePositions[k] = Nodes[SourceNodes[k]].Position;
+        Bounds += SourcePositions[k];
+    }
+    if (!Bounds.bIsValid)
+    {
+        Bounds = FBox2D(FVector2D(-100.f), FVector2D(100.f));
+    }
+
+    // Pad and grow the short side so the image keeps the aspect ratio of the widget
+    FVector2D Extent = Bounds.GetExtent() * (1.f + BoundsPadding) + FVector2D(50.f);
+    const float Aspect = static_cast<float>(ImageWidth) / ImageHeight;
+    if (Extent.X < Extent.Y * Aspect)
+    {
+        Extent.X = Extent.Y * Aspect;
+    }
+    else
+    {
+        Extent.Y = Extent.X / Aspect;
+    }
+    Bounds = FBox2D(Bounds.GetCenter() - Extent, Bounds.GetCenter() + Extent);
+
+    // Accumulate node colors per texel, the center texel gets full weight and its neighbours a share
+    TArray<FLinearColor> Accum;
+    Accum.Init(FLinearColor::Transparent, ImageWidth * ImageHeight);
+    const FVector2D Scale(ImageWidth / Bounds.GetSize().X, ImageHeight / Bounds.GetSize().Y);
+    for (int32 k = 0; k < SourceNodes.Num(); ++k)
+    {
+        const FVector2D Texel = (SourcePositions[k] - Bounds.Min) * Scale;
+        const int32 X = FMath::Clamp(FMath::FloorToInt(Texel.X), 0, ImageWidth - 1);
+        const int32 Y = FMath::Clamp(FMath::FloorToInt(Texel.Y), 0, ImageHeight - 1);
+        const FLinearColor Color = Nodes[SourceNodes[k]].Color;
+
+        for (int32 dy = -1; dy <= 1; ++dy)
+        {
+            for (int32 dx = -1; dx <= 1; ++dx)
+            {
+                if (X + dx < 0 || X + dx >= ImageWidth || Y + dy < 0 || Y + dy >= ImageHeight)
+                {
+                    continue;
+                }
+
+                const float Weight = dx == 0 && dy == 0 ? 1.f : (dx == 0 || dy == 0 ? 0.35f : 0.15f);
+                FLinearColor& Cell = Accum[(Y + dy) * ImageWidth + X + dx];
+                Cell.R += Color.R * Weight;
+                Cell.G += Color.G * Weight;
+                Cell.B += Color.B * Weight;
+                Cell.A += Weight;
+            }
+        }
+    }
+
+    TArray<uint8> Bytes;
+    Bytes.SetNumUninitialized(ImageWidth * ImageHeight * 4);
+    for (int32 i = 0; i < Accum.Num(); ++i)
+    {
+        const FLinearColor& Cell = Accum[i];
+        const float Density = 1.f - FMath::Exp(-Cell.A * DensityGain);
+        const FLinearColor Mean = Cell.A > 0.f ? FLinearColor(Cell.R / Cell.A, Cell.G / Cell.A, Cell.B / Cell.A, Density) : FLinearColor::Transparent;
+        const FColor Pixel = FLinearColor::LerpUsingHSV(Mean, FLinearColor::White, 0.25f * Density).CopyWithNewOpacity(Density).ToFColor(true);
+
+        // Renderer resources are BGRA
+        Bytes[i * 4 + 0] = Pixel.B;
+        Bytes[i * 4 + 1] = Pixel.G;
+        Bytes[i * 4 + 2] = Pixel.R;
+        Bytes[i * 4 + 3] = Pixel.A;
+    }
+
+    // A new name per image, the renderer keeps resources by name and the old brush releases its own
+    const FName ResourceName(*FString::Printf(TEXT("NsSpyglassMinimap_%p_%u"), this, ++ImageGeneration));
+    Brush = FSlateDynamicImageBrush::CreateWithImageData(ResourceName, FVector2D(ImageWidth, ImageHeight), Bytes);
+}
+
+void SNsSpyglassMinimapWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+    CheckElapsed += InDeltaTime;
+    if (CheckElapsed < CheckInterval)
+    {
+        return;
+    }
+    CheckElapsed = 0.f;
+
+    if (NeedsUpdate())
+    {
+        UpdateImage();
+    }
+}
+
+FVector2D SNsSpyglassMinimapWidget::GraphToLocal(const FVector2D& GraphPos, const FVector2D& LocalSize) const
+{
+    return (GraphPos - Bounds.Min) / Bounds.GetSize() * LocalSize;
+}
+
+FVector2D SNsSpyglassMinimapWidget::LocalToGraph(const FVector2D& LocalPos, const FVector2D& LocalSize) const
+{
+    return Bounds.Min + LocalPos / LocalSize * Bounds.GetSize();
+}
+
+int32 SNsSpyglassMinimapWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+    const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+
+    FSlateDrawElement::MakeBox(
+        OutDrawElements,
+        LayerId,
+        AllottedGeometry.ToPaintGeometry(),
+        FCoreStyle::Get().GetBrush("WhiteBrush"),
+        ESlateDrawEffect::None,
+        BackgroundColor
+    );
+
+    const TSharedPtr<SNsSpyglassGraphWidget> GraphPin = Graph.Pin();
+    if (!Brush.IsValid() || !GraphPin.IsValid())
+    {
+        return LayerId + 1;
+    }
+
+    FSlateDrawElement::MakeBox(
+        OutDrawElements,
+        LayerId + 1,
+        AllottedGeometry.ToPaintGeometry(),
+        Brush.Get(),
+        ESlateDrawEffect::None,
+        FLinearColor::White
+    );
+
+    // Graph view area, from screen = Center + ViewOffset + Position * Zoom
+    const FVector2D ViewSize = GraphPin->GetViewSize();
+    const float Zoom = GraphPin->GetZoomAmount();
+    const FVector2D ViewMin = (-ViewSize * 0.5f - GraphPin->GetViewOffset()) / Zoom;
+    const FVector2D ViewMax = (ViewSize * 0.5f - GraphPin->GetViewOffset()) / Zoom;
+
+    const FVector2D Min = GraphToLocal(ViewMin, LocalSize);
+    const FVector2D Max = GraphToLocal(ViewMax, LocalSize);
+    const FVector2D ClampedMin(FMath::Clamp(Min.X, 0.f, LocalSize.X), FMath::Clamp(Min.Y, 0.f, LocalSize.Y));
+    const FVector2D ClampedMax(FMath::Clamp(Max.X, 0.f, LocalSize.X), FMath::Clamp(Max.Y, 0.f, LocalSize.Y));
+
+    TArray<FVector2D> Outline{
+        ClampedMin,
+        FVector2D(ClampedMax.X, ClampedMin.Y),
+        ClampedMax,
+        FVector2D(ClampedMin.X, ClampedMax.Y),
+        ClampedMin
+    };
+    FSlateDrawElement::MakeLines(OutDrawElements, LayerId + 2, AllottedGeometry.ToPaintGeometry(), Outline, ESlateDrawEffect::None, ViewportColor, true, 1.f);
+
+    return LayerId + 3;
+}
+
+void SNsSpyglassMinimapWidget::CenterGraphAt(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) const
+{
+    const TSharedPtr<SNsSpyglassGraphWidget> GraphPin = Graph.Pin();
+    if (!GraphPin.IsValid() || !Brush.IsValid())
+    {
+        return;
+    }
+
+    const FVector2D LocalPos = MyGeometry.AbsoluteToLocal(MouseEvent.GetScreenSpacePosition());
+    GraphPin->CenterViewOn(LocalToGraph(LocalPos, MyGeometry.GetLocalSize()), GraphPin->GetZoomAmount());
+}
+
+FReply SNsSpyglassMinimapWidget::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton)
+    {
+        return FReply::Unhandled();
+    }
+
+    bIsDragging = true;
+    CenterGraphAt(MyGeometry, MouseEvent);
+    return FReply::Handled().CaptureMouse(SharedThis(this));
+}
+
+FReply SNsSpyglassMinimapWidget::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (MouseEvent.GetEffectingButton() != EKeys::LeftMouseButton || !bIsDragging)
+    {
+        return FReply::Unhandled();
+    }
+
+    bIsDragging = false;
+    return FReply::Handled().ReleaseMouseCapture();
+}
+
+FReply SNsSpyglassMinimapWidget::OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    // Keep double-clicks from reaching the graph, where they would leave focus mode
+    return FReply::Handled();
+}
+
+FReply SNsSpyglassMinimapWidget::OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    if (!bIsDragging)
+    {
+        return FReply::Unhandled();
+    }
+
+    CenterGraphAt(MyGeometry, MouseEvent);
+    return FReply::Handled();
+}
+
+FReply SNsSpyglassMinimapWidget::OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+{
+    const TSharedPtr<SNsSpyglassGraphWidget> GraphPin = Graph.Pin();
+    if (!GraphPin.IsValid())
+    {
+        return FReply::Unhandled();
+    }
+
+    // Zoom around the center of the graph view, the point the viewport rectangle is drawn around
+    const float Zoom = GraphPin->GetZoomAmount();
+    GraphPin->CenterViewOn(-GraphPin->GetViewOffset() / Zoom, Zoom * FMath::Pow(1.1f, MouseEvent.GetWheelDelta()));
+    return FReply::Handled();
+}
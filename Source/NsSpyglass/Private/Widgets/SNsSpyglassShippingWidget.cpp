@@ -0,0 +1,108 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Widgets/SNsSpyglassShippingWidget.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/STextComboBox.h"
+#include "Widgets/Text/STextBlock.h"
+
+void SNsSpyglassShippingWidget::Construct(const FArguments& InArgs)
+{
+    for (int32 i = 0; i < static_cast<int32>(ENsSpyglassShipTarget::Num); ++i)
+    {
+        TargetOptions.Add(MakeShared<FString>(FNsSpyglassShippingFilter::GetTargetName(static_cast<ENsSpyglassShipTarget>(i))));
+    }
+
+    // The platform the editor runs on is picked first
+    Platform = FPlatformMisc::GetUBTPlatform();
+    PlatformOptions.Add(MakeShared<FString>(Platform));
+    for (const FString& Known : FNsSpyglassShippingFilter::GetKnownPlatforms())
+    {
+        if (Known != Platform)
+        {
+            PlatformOptions.Add(MakeShared<FString>(Known));
+        }
+    }
+
+    ChildSlot
+    [
+        SNew(SVerticalBox)
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SNew(SCheckBox)
+            .IsChecked_Lambda([this]()
+            {
+                return bEnabled ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+            })
+            .OnCheckStateChanged_Lambda([this](ECheckBoxState NewState)
+            {
+                bEnabled = NewState == ECheckBoxState::Checked;
+                NotifyViewChanged();
+            })
+            [
+                SNew(STextBlock).Text(FText::FromString("Shipping View"))
+            ]
+        ]
+        + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,2,0,0))
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot().FillWidth(1.f)
+            [
+                SNew(STextComboBox)
+                .OptionsSource(&TargetOptions)
+                .InitiallySelectedItem(TargetOptions[0])
+                .IsEnabled_Lambda([this]() { return bEnabled; })
+                .OnSelectionChanged_Lambda([this](TSharedPtr<FString> Selected, ESelectInfo::Type)
+                {
+                    const int32 Index = TargetOptions.IndexOfByKey(Selected);
+                    if (Index != INDEX_NONE)
+                    {
+                        Target = static_cast<ENsSpyglassShipTarget>(Index);
+                        NotifyViewChanged();
+                    }
+                })
+            ]
+            + SHorizontalBox::Slot().FillWidth(1.f).Padding(FMargin(4,0,0,0))
+            [
+                SNew(STextComboBox)
+                .OptionsSource(&PlatformOptions)
+                .InitiallySelectedItem(PlatformOptions[0])
+                .IsEnabled_Lambda([this]() { return bEnabled; })
+                .OnSelectionChanged_Lambda([this](TSharedPtr<FString> Selected, ESelectInfo::Type)
+                {
+                    if (Selected.IsValid())
+                    {
+                        Platform = *Selected;
+                        NotifyViewChanged();
+                    }
+                })
+            ]
+        ]
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SAssignNew(StatusText, STextBlock)
+        ]
+    ];
+}
+
+void SNsSpyglassShippingWidget::SetResult(const FNsSpyglassShippingResult* InResult)
+{
+    if (InResult)
+    {
+        StatusText->SetText(FText::FromString(FString::Printf(TEXT("%d plugins ship (%d pulled in), %d modules (%d on demand)"),
+            InResult->NumPlugins, InResult->NumPulledIn, InResult->NumModules, InResult->NumOnDemandModules)));
+    }
+    else
+    {
+        StatusText->SetText(FText());
+    }
+}
+
+void SNsSpyglassShippingWidget::SetOnViewChanged(FOnViewChanged InDelegate)
+{
+    OnViewChanged = InDelegate;
+}
+
+void SNsSpyglassShippingWidget::NotifyViewChanged() const
+{
+    OnViewChanged.ExecuteIfBound(bEnabled, Target, Platform);
+}
@@ -0,0 +1,182 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Widgets/SNsSpyglassSnapshotWidget.h"
+#include "DesktopPlatformModule.h"
+#include "Framework/Application/SlateApplication.h"
+#include "HAL/FileManager.h"
+#include "IDesktopPlatform.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Text/STextBlock.h"
+
+/** File dialog filter for snapshots. */
+static const TCHAR* SnapshotFileTypes = TEXT("Spyglass Snapshot (*.nsgraph)|*.nsgraph");
+
+void SNsSpyglassSnapshotWidget::Construct(const FArguments& InArgs)
+{
+    ChildSlot
+    [
+        SNew(SVerticalBox)
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot().AutoWidth()
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Save Snapshot"))
+                .IsEnabled_Lambda([this]()
+                {
+                    return !bShowingDiff;
+                })
+                .OnClicked(this, &SNsSpyglassSnapshotWidget::OnSaveClicked)
+            ]
+            + SHorizontalBox::Slot().AutoWidth().Padding(FMargin(4,0,0,0))
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Compare..."))
+                .ToolTipText(FText::FromString("Select two snapshots to compare them, or one to compare it with the live graph"))
+                .OnClicked(this, &SNsSpyglassSnapshotWidget::OnCompareClicked)
+            ]
+            + SHorizontalBox::Slot().AutoWidth().Padding(FMargin(4,0,0,0))
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Live Graph"))
+                .IsEnabled_Lambda([this]()
+                {
+                    return bShowingDiff;
+                })
+                .OnClicked(this, &SNsSpyglassSnapshotWidget::OnLiveClicked)
+            ]
+        ]
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SAssignNew(StatusText, STextBlock)
+            .AutoWrapText(true)
+        ]
+    ];
+}
+
+void SNsSpyglassSnapshotWidget::SetOnSaveRequested(FOnSaveRequested InDelegate)
+{
+    OnSaveRequested = InDelegate;
+}
+
+void SNsSpyglassSnapshotWidget::SetOnDiffReady(FOnDiffReady InDelegate)
+{
+    OnDiffReady = InDelegate;
+}
+
+void SNsSpyglassSnapshotWidget::SetOnLiveRequested(FOnLiveRequested InDelegate)
+{
+    OnLiveRequested = InDelegate;
+}
+
+FString SNsSpyglassSnapshotWidget::GetSnapshotDirectory()
+{
+    return FPaths::ProjectSavedDir() / TEXT("Spyglass") / TEXT("Snapshots");
+}
+
+FReply SNsSpyglassSnapshotWidget::OnSaveClicked()
+{
+    IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+    if (!DesktopPlatform || !OnSaveRequested.IsBound())
+    {
+        return FReply::Handled();
+    }
+
+    IFileManager::Get().MakeDirectory(*GetSnapshotDirectory(), true);
+
+    TArray<FString> Files;
+    const FString DefaultFile = FString::Printf(TEXT("PluginGraph-%s.nsgraph"), *FDateTime::Now().ToString());
+    if (DesktopPlatform->SaveFileDialog(FSlateApplication::Get().FindBestParentWindowHandleForDialogs(AsShared()),
+        TEXT("Save Spyglass Snapshot"), GetSnapshotDirectory(), DefaultFile, SnapshotFileTypes, EFileDialogFlags::None, Files) && Files.Num() > 0)
+    {
+        const bool bSaved = OnSaveRequested.Execute(Files[0]);
+        StatusText->SetText(FText::FromString(bSaved
+            ? FString::Printf(TEXT("Saved %s"), *FPaths::GetCleanFilename(Files[0]))
+            : FString::Printf(TEXT("Could not write %s"), *Files[0])));
+    }
+
+    return FReply::Handled();
+}
+
+FReply SNsSpyglassSnapshotWidget::OnCompareClicked()
+{
+    IDesktopPlatform* DesktopPlatform = FDesktopPlatformModule::Get();
+    if (!DesktopPlatform)
+    {
+        return FReply::Handled();
+    }
+
+    TArray<FString> Files;
+    if (!DesktopPlatform->OpenFileDialog(FSlateApplication::Get().FindBestParentWindowHandleForDialogs(AsShared()),
+        TEXT("Select Snapshots To Compare"), GetSnapshotDirectory(), FString(), SnapshotFileTypes, EFileDialogFlags::Multiple, Files))
+    {
+        return FReply::Handled();
+    }
+
+    if (Files.Num() == 1)
+    {
+        // Compare against the live graph through a scratch snapshot so both sides use the same format
+        if (bShowingDiff)
+        {
+            OnLiveRequested.ExecuteIfBound();
+            bShowingDiff = false;
+        }
+
+        const FString LivePath = FPaths::ProjectIntermediateDir() / TEXT("Spyglass") / TEXT("Live.nsgraph");
+        if (!OnSaveRequested.IsBound() || !OnSaveRequested.Execute(LivePath))
+        {
+            StatusText->SetText(FText::FromString(TEXT("Could not snapshot the live graph")));
+            return FReply::Handled();
+        }
+        Compare(Files[0], LivePath);
+    }
+    else if (Files.Num() == 2)
+    {
+        // The older file is the baseline
+        if (IFileManager::Get().GetTimeStamp(*Files[0]) > IFileManager::Get().GetTimeStamp(*Files[1]))
+        {
+            Files.Swap(0, 1);
+        }
+        Compare(Files[0], Files[1]);
+    }
+    else
+    {
+        StatusText->SetText(FText::FromString(TEXT("Select one or two snapshots")));
+    }
+
+    return FReply::Handled();
+}
+
+FReply SNsSpyglassSnapshotWidget::OnLiveClicked()
+{
+    bShowingDiff = false;
+    StatusText->SetText(FText());
+    OnLiveRequested.ExecuteIfBound();
+    return FReply::Handled();
+}
+
+void SNsSpyglassSnapshotWidget::Compare(const FString& OldPath, const FString& NewPath)
+{
+    FNsSpyglassSnapshotView Old;
+    FNsSpyglassSnapshotView New;
+    FString Error;
+    if (!Old.Open(OldPath, Error) || !New.Open(NewPath, Error))
+    {
+        StatusText->SetText(FText::FromString(Error));
+        return;
+    }
+
+    FNsSpyglassGraphDiff Diff;
+    FNsSpyglassSnapshot::Diff(Old, New, Diff);
+
+    bShowingDiff = true;
+    OnDiffReady.ExecuteIfBound(Diff);
+
+    StatusText->SetText(FText::FromString(FString::Printf(TEXT("%s -> %s\n+%d -%d ~%d plugins, +%d -%d edges (%.2f ms)"),
+        *FPaths::GetBaseFilename(OldPath), *FPaths::GetBaseFilename(NewPath),
+        Diff.NumAddedNodes, Diff.NumRemovedNodes, Diff.NumChangedNodes, Diff.NumAddedEdges, Diff.NumRemovedEdges,
+        Diff.DiffSeconds * 1000.0)));
+}
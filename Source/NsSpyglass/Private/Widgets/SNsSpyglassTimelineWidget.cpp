@@ -0,0 +1,252 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Widgets/SNsSpyglassTimelineWidget.h"
+#include "Async/Async.h"
+#include "Misc/Paths.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSlider.h"
+#include "Widgets/Text/STextBlock.h"
+
+SNsSpyglassTimelineWidget::~SNsSpyglassTimelineWidget()
+{
+    if (LoadState.IsValid())
+    {
+        LoadState->bCancel = true;
+    }
+}
+
+void SNsSpyglassTimelineWidget::Construct(const FArguments& InArgs)
+{
+    ChildSlot
+    [
+        SNew(SVerticalBox)
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot().FillWidth(1.f)
+            [
+                SAssignNew(FromText, SEditableTextBox)
+                .HintText(FText::FromString("From (oldest)"))
+                .ToolTipText(FText::FromString("Oldest commit of the range, as a full id, branch or tag. Empty walks back as far as the commit limit"))
+            ]
+            + SHorizontalBox::Slot().FillWidth(1.f).Padding(FMargin(4,0,0,0))
+            [
+                SAssignNew(ToText, SEditableTextBox)
+                .Text(FText::FromString("HEAD"))
+                .ToolTipText(FText::FromString("Newest commit of the range"))
+            ]
+        ]
+        + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,2,0,0))
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot().AutoWidth()
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Load History"))
+                .ToolTipText(FText::FromString("Read the descriptors of every commit in the range straight from the git object store"))
+                .IsEnabled_Lambda([this]()
+                {
+                    return !LoadState.IsValid();
+                })
+                .OnClicked(this, &SNsSpyglassTimelineWidget::OnLoadClicked)
+            ]
+            + SHorizontalBox::Slot().AutoWidth().Padding(FMargin(4,0,0,0))
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Live Graph"))
+                .IsEnabled_Lambda([this]()
+                {
+                    return History.IsValid();
+                })
+                .OnClicked(this, &SNsSpyglassTimelineWidget::OnLiveClicked)
+            ]
+        ]
+        + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,2,0,0))
+        [
+            SNew(SHorizontalBox)
+            .Visibility_Lambda([this]()
+            {
+                return History.IsValid() ? EVisibility::Visible : EVisibility::Collapsed;
+            })
+            + SHorizontalBox::Slot().AutoWidth()
+            [
+                SNew(SButton)
+                .Text(FText::FromString("<"))
+                .OnClicked(this, &SNsSpyglassTimelineWidget::OnStepClicked, -1)
+            ]
+            + SHorizontalBox::Slot().FillWidth(1.f).VAlign(VAlign_Center).Padding(FMargin(4,0))
+            [
+                SNew(SSlider)
+                .Value_Lambda([this]()
+                {
+                    return History.IsValid() && History->Commits.Num() > 1 ? static_cast<float>(Commit) / static_cast<float>(History->Commits.Num() - 1) : 0.f;
+                })
+                .OnValueChanged_Lambda([this](const float Value)
+                {
+                    if (History.IsValid())
+                    {
+                        SelectCommit(FMath::RoundToInt(Value * static_cast<float>(History->Commits.Num() - 1)));
+                    }
+                })
+                // While held, the graph only applies the commits it passes and catches up on release
+                .OnMouseCaptureBegin_Lambda([this]()
+                {
+                    OnScrubbingChanged.ExecuteIfBound(true);
+                })
+                .OnMouseCaptureEnd_Lambda([this]()
+                {
+                    OnScrubbingChanged.ExecuteIfBound(false);
+                })
+                .OnControllerCaptureBegin_Lambda([this]()
+                {
+                    OnScrubbingChanged.ExecuteIfBound(true);
+                })
+                .OnControllerCaptureEnd_Lambda([this]()
+                {
+                    OnScrubbingChanged.ExecuteIfBound(false);
+                })
+            ]
+            + SHorizontalBox::Slot().AutoWidth()
+            [
+                SNew(SButton)
+                .Text(FText::FromString(">"))
+                .OnClicked(this, &SNsSpyglassTimelineWidget::OnStepClicked, 1)
+            ]
+        ]
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SAssignNew(CommitText, STextBlock)
+            .AutoWrapText(true)
+        ]
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SNew(STextBlock)
+            .AutoWrapText(true)
+            .Text_Lambda([this]()
+            {
+                // The finished status is set once, only a running load needs refreshing
+                return LoadState.IsValid()
+                    ? FText::FromString(FString::Printf(TEXT("Reading history... %d commits"), LoadState->Progress.load(std::memory_order_relaxed)))
+                    : Status;
+            })
+        ]
+    ];
+}
+
+void SNsSpyglassTimelineWidget::SetOnHistoryLoaded(FOnHistoryLoaded InDelegate)
+{
+    OnHistoryLoaded = InDelegate;
+}
+
+void SNsSpyglassTimelineWidget::SetOnCommitSelected(FOnCommitSelected InDelegate)
+{
+    OnCommitSelected = InDelegate;
+}
+
+void SNsSpyglassTimelineWidget::SetOnLiveRequested(FOnLiveRequested InDelegate)
+{
+    OnLiveRequested = InDelegate;
+}
+
+void SNsSpyglassTimelineWidget::SetOnScrubbingChanged(FOnScrubbingChanged InDelegate)
+{
+    OnScrubbingChanged = InDelegate;
+}
+
+FReply SNsSpyglassTimelineWidget::OnLoadClicked()
+{
+    FNsSpyglassGitHistory::FParams Params;
+    Params.RepositoryDir = FPaths::ProjectDir();
+    Params.FromRevision = FromText->GetText().ToString();
+    Params.ToRevision = ToText->GetText().ToString();
+
+    LoadState = MakeShared<FLoadState, ESPMode::ThreadSafe>();
+
+    // Reading thousands of commits is quick but not frame quick, keep it off the game thread
+    TWeakPtr<SNsSpyglassTimelineWidget> WeakThis = SharedThis(this);
+    Async(EAsyncExecution::ThreadPool, [WeakThis, Params, State = LoadState]()
+    {
+        TSharedPtr<FNsSpyglassHistory, ESPMode::ThreadSafe> Loaded = MakeShared<FNsSpyglassHistory, ESPMode::ThreadSafe>();
+        FString Error;
+        if (!FNsSpyglassGitHistory::Load(Params, *Loaded, Error, &State->Progress, &State->bCancel))
+        {
+            Loaded.Reset();
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, State, Loaded, Error]()
+        {
+            const TSharedPtr<SNsSpyglassTimelineWidget> This = WeakThis.Pin();
+            if (This.IsValid() && This->LoadState == State)
+            {
+                This->LoadState.Reset();
+                This->HandleLoaded(Loaded, Error);
+            }
+        });
+    });
+
+    return FReply::Handled();
+}
+
+void SNsSpyglassTimelineWidget::HandleLoaded(FNsSpyglassHistoryPtr Loaded, const FString& Error)
+{
+    if (!Loaded.IsValid() || Loaded->Commits.Num() == 0)
+    {
+        Status = FText::FromString(Error.IsEmpty() ? FString(TEXT("No commits in the range")) : Error);
+        return;
+    }
+
+    History = Loaded;
+    Commit = 0;
+    OnHistoryLoaded.ExecuteIfBound(History);
+
+    const int32 NumLocal = History->IsLocal.CountSetBits();
+    Status = FText::FromString(FString::Printf(TEXT("%d commits, %d plugins (%d in the repository), %d ops, %d descriptor blobs parsed (%.2f s)"),
+        History->Commits.Num(), History->NodeNames.Num(), NumLocal, History->Ops.Num(), History->NumParsedBlobs, History->LoadSeconds));
+    DescribeCommit();
+}
+
+FReply SNsSpyglassTimelineWidget::OnLiveClicked()
+{
+    History.Reset();
+    Commit = 0;
+    CommitText->SetText(FText());
+    Status = FText();
+    OnLiveRequested.ExecuteIfBound();
+    return FReply::Handled();
+}
+
+FReply SNsSpyglassTimelineWidget::OnStepClicked(const int32 Step)
+{
+    if (History.IsValid())
+    {
+        SelectCommit(Commit + Step);
+    }
+    return FReply::Handled();
+}
+
+void SNsSpyglassTimelineWidget::SelectCommit(const int32 InCommit)
+{
+    const int32 NewCommit = FMath::Clamp(InCommit, 0, History->Commits.Num() - 1);
+    if (NewCommit != Commit)
+    {
+        Commit = NewCommit;
+        OnCommitSelected.ExecuteIfBound(Commit);
+        DescribeCommit();
+    }
+}
+
+void SNsSpyglassTimelineWidget::DescribeCommit()
+{
+    int32 Counts[4] = {};
+    for (const uint64 Op : History->GetOps(Commit))
+    {
+        ++Counts[static_cast<int32>(FNsSpyglassHistory::GetOpType(Op))];
+    }
+
+    const FNsSpyglassHistoryCommit& Info = History->Commits[Commit];
+    CommitText->SetText(FText::FromString(FString::Printf(TEXT("%d/%d  %s  %s  %s\n%s\n+%d -%d plugins, +%d -%d edges"),
+        Commit + 1, History->Commits.Num(), *Info.Hash.Left(10), *Info.Time.ToString(TEXT("%Y-%m-%d")), *Info.Author, *Info.Summary,
+        Counts[static_cast<int32>(ENsSpyglassHistoryOp::AddNode)], Counts[static_cast<int32>(ENsSpyglassHistoryOp::RemoveNode)],
+        Counts[static_cast<int32>(ENsSpyglassHistoryOp::AddEdge)], Counts[static_cast<int32>(ENsSpyglassHistoryOp::RemoveEdge)])));
+}
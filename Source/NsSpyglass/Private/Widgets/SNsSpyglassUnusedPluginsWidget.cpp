@@ -0,0 +1,126 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Widgets/SNsSpyglassUnusedPluginsWidget.h"
+#include "HAL/PlatformApplicationMisc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+void SNsSpyglassUnusedPluginsWidget::Construct(const FArguments& InArgs)
+{
+    ChildSlot
+    [
+        SNew(SVerticalBox)
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot().AutoWidth()
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Find Unused Plugins"))
+                .OnClicked(this, &SNsSpyglassUnusedPluginsWidget::OnFindClicked)
+            ]
+            + SHorizontalBox::Slot().AutoWidth().Padding(FMargin(4,0,0,0))
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Copy .uproject Entries"))
+                .IsEnabled_Lambda([this]()
+                {
+                    return Result.IsValid() && Result->Candidates.Num() > 0;
+                })
+                .OnClicked(this, &SNsSpyglassUnusedPluginsWidget::OnCopyClicked)
+            ]
+        ]
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SAssignNew(StatusText, STextBlock)
+        ]
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SNew(SBox)
+            .MaxDesiredHeight(150.f)
+            [
+                SAssignNew(ListView, SListView<TSharedPtr<FNsSpyglassUnusedPlugin>>)
+                .ListItemsSource(&Entries)
+                .SelectionMode(ESelectionMode::None)
+                .OnGenerateRow(this, &SNsSpyglassUnusedPluginsWidget::OnGenerateRow)
+            ]
+        ]
+    ];
+}
+
+void SNsSpyglassUnusedPluginsWidget::SetResult(FNsSpyglassUnusedResultPtr InResult)
+{
+    Result = InResult;
+    Entries.Reset();
+
+    if (Result.IsValid())
+    {
+        int64 TotalBytes = 0;
+        for (const FNsSpyglassUnusedPlugin& Candidate : Result->Candidates)
+        {
+            Entries.Add(MakeShared<FNsSpyglassUnusedPlugin>(Candidate));
+            TotalBytes += Candidate.BinaryBytes;
+        }
+
+        StatusText->SetText(FText::FromString(FString::Printf(TEXT("%d unused plugins, %.1f MB of binaries%s"),
+            Result->Candidates.Num(),
+            static_cast<double>(TotalBytes) / (1024.0 * 1024.0),
+            Result->bCheckedContent ? TEXT("") : TEXT(" (content not checked)"))));
+    }
+    else
+    {
+        StatusText->SetText(FText());
+    }
+
+    ListView->RequestListRefresh();
+}
+
+void SNsSpyglassUnusedPluginsWidget::SetSearching()
+{
+    StatusText->SetText(FText::FromString("Searching..."));
+}
+
+void SNsSpyglassUnusedPluginsWidget::SetOnFindRequested(FOnFindRequested InDelegate)
+{
+    OnFindRequested = InDelegate;
+}
+
+TSharedRef<ITableRow> SNsSpyglassUnusedPluginsWidget::OnGenerateRow(TSharedPtr<FNsSpyglassUnusedPlugin> Item, const TSharedRef<STableViewBase>& OwnerTable) const
+{
+    const FString Details = FString::Printf(TEXT("%d modules, %.1f MB"), Item->NumModules, static_cast<double>(Item->BinaryBytes) / (1024.0 * 1024.0));
+
+    return SNew(STableRow<TSharedPtr<FNsSpyglassUnusedPlugin>>, OwnerTable)
+    [
+        SNew(SHorizontalBox)
+        + SHorizontalBox::Slot().FillWidth(1.f)
+        [
+            SNew(STextBlock).Text(FText::FromString(Item->Name))
+        ]
+        + SHorizontalBox::Slot().AutoWidth()
+        [
+            SNew(STextBlock).ColorAndOpacity(FLinearColor::Gray).Text(FText::FromString(Details))
+        ]
+    ];
+}
+
+FReply SNsSpyglassUnusedPluginsWidget::OnFindClicked()
+{
+    SetSearching();
+    OnFindRequested.ExecuteIfBound();
+    return FReply::Handled();
+}
+
+FReply SNsSpyglassUnusedPluginsWidget::OnCopyClicked() const
+{
+    if (Result.IsValid())
+    {
+        const FString ProjectEntries = FNsSpyglassUnusedPluginFinder::MakeProjectPluginEntries(*Result);
+        FPlatformApplicationMisc::ClipboardCopy(*ProjectEntries);
+        FFileHelper::SaveStringToFile(ProjectEntries, *(FPaths::ProjectSavedDir() / TEXT("Spyglass") / TEXT("UnusedPlugins.json")));
+    }
+    return FReply::Handled();
+}
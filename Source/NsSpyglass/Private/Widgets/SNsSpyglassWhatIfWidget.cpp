@@ -0,0 +1,180 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#include "Widgets/SNsSpyglassWhatIfWidget.h"
+#include "HAL/PlatformApplicationMisc.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+/** Bytes per megabyte for the size columns. */
+static constexpr double BytesPerMegabyte = 1024.0 * 1024.0;
+
+void SNsSpyglassWhatIfWidget::Construct(const FArguments& InArgs)
+{
+    ChildSlot
+    [
+        SNew(SVerticalBox)
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SNew(SCheckBox)
+            .IsChecked_Lambda([this]()
+            {
+                return bEnabled ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+            })
+            .OnCheckStateChanged_Lambda([this](ECheckBoxState NewState)
+            {
+                bEnabled = NewState == ECheckBoxState::Checked;
+                OnModeChanged.ExecuteIfBound(bEnabled);
+            })
+            [
+                SNew(STextBlock).Text(FText::FromString("What-If Mode (click nodes to disable)"))
+            ]
+        ]
+        + SVerticalBox::Slot().AutoHeight().Padding(FMargin(0,2,0,0))
+        [
+            SNew(SHorizontalBox)
+            + SHorizontalBox::Slot().AutoWidth()
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Disable Filtered"))
+                .IsEnabled_Lambda([this]() { return bEnabled; })
+                .OnClicked_Lambda([this]()
+                {
+                    OnDisableFilteredRequested.ExecuteIfBound();
+                    return FReply::Handled();
+                })
+            ]
+            + SHorizontalBox::Slot().AutoWidth().Padding(FMargin(4,0,0,0))
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Reset"))
+                .IsEnabled_Lambda([this]() { return bEnabled; })
+                .OnClicked_Lambda([this]()
+                {
+                    OnResetRequested.ExecuteIfBound();
+                    return FReply::Handled();
+                })
+            ]
+            + SHorizontalBox::Slot().AutoWidth().Padding(FMargin(4,0,0,0))
+            [
+                SNew(SButton)
+                .Text(FText::FromString("Copy .uproject Entries"))
+                .IsEnabled_Lambda([this]()
+                {
+                    return Result.IsValid() && Result->Entries.Num() > 0;
+                })
+                .OnClicked(this, &SNsSpyglassWhatIfWidget::OnCopyClicked)
+            ]
+        ]
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SAssignNew(StatusText, STextBlock)
+            .AutoWrapText(true)
+        ]
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SNew(SBox)
+            .MaxDesiredHeight(150.f)
+            [
+                SAssignNew(ListView, SListView<TSharedPtr<FNsSpyglassWhatIfEntry>>)
+                .ListItemsSource(&Entries)
+                .SelectionMode(ESelectionMode::None)
+                .OnGenerateRow(this, &SNsSpyglassWhatIfWidget::OnGenerateRow)
+            ]
+        ]
+    ];
+}
+
+void SNsSpyglassWhatIfWidget::SetResult(FNsSpyglassWhatIfResultPtr InResult)
+{
+    Result = InResult;
+    Entries.Reset();
+
+    if (Result.IsValid())
+    {
+        int32 Counts[4] = {};
+        for (const FNsSpyglassWhatIfEntry& Entry : Result->Entries)
+        {
+            Entries.Add(MakeShared<FNsSpyglassWhatIfEntry>(Entry));
+            ++Counts[static_cast<int32>(Entry.State)];
+        }
+
+        FString Status = FString::Printf(TEXT("%d disabled, %d broken, %d orphaned. Saves %d modules"),
+            Counts[static_cast<int32>(ENsSpyglassWhatIfState::Disabled)],
+            Counts[static_cast<int32>(ENsSpyglassWhatIfState::Broken)],
+            Counts[static_cast<int32>(ENsSpyglassWhatIfState::Orphaned)],
+            Result->RemovedModules);
+        if (Result->bSizesKnown)
+        {
+            Status += FString::Printf(TEXT(", %.1f MB"), static_cast<double>(Result->RemovedBytes) / BytesPerMegabyte);
+        }
+        if (Result->OrphanedModules > 0)
+        {
+            Status += Result->bSizesKnown
+                ? FString::Printf(TEXT(", orphans could free %d modules, %.1f MB more"), Result->OrphanedModules, static_cast<double>(Result->OrphanedBytes) / BytesPerMegabyte)
+                : FString::Printf(TEXT(", orphans could free %d modules more"), Result->OrphanedModules);
+        }
+        if (!Result->bSizesKnown)
+        {
+            Status += TEXT(" (measuring binaries...)");
+        }
+        StatusText->SetText(FText::FromString(Status));
+    }
+    else
+    {
+        StatusText->SetText(FText());
+    }
+
+    ListView->RequestListRefresh();
+}
+
+void SNsSpyglassWhatIfWidget::SetOnModeChanged(FOnModeChanged InDelegate)
+{
+    OnModeChanged = InDelegate;
+}
+
+void SNsSpyglassWhatIfWidget::SetOnDisableFilteredRequested(FOnScenarioRequested InDelegate)
+{
+    OnDisableFilteredRequested = InDelegate;
+}
+
+void SNsSpyglassWhatIfWidget::SetOnResetRequested(FOnScenarioRequested InDelegate)
+{
+    OnResetRequested = InDelegate;
+}
+
+TSharedRef<ITableRow> SNsSpyglassWhatIfWidget::OnGenerateRow(TSharedPtr<FNsSpyglassWhatIfEntry> Item, const TSharedRef<STableViewBase>& OwnerTable) const
+{
+    const TCHAR* StateName = Item->State == ENsSpyglassWhatIfState::Disabled ? TEXT("disabled")
+        : Item->State == ENsSpyglassWhatIfState::Broken ? TEXT("broken")
+        : TEXT("orphaned");
+    const FString Details = FString::Printf(TEXT("%s, %d modules, %.1f MB"), StateName, Item->NumModules, static_cast<double>(Item->BinaryBytes) / BytesPerMegabyte);
+
+    return SNew(STableRow<TSharedPtr<FNsSpyglassWhatIfEntry>>, OwnerTable)
+    [
+        SNew(SHorizontalBox)
+        + SHorizontalBox::Slot().FillWidth(1.f)
+        [
+            SNew(STextBlock).Text(FText::FromString(Item->Name))
+        ]
+        + SHorizontalBox::Slot().AutoWidth()
+        [
+            SNew(STextBlock).ColorAndOpacity(FLinearColor::Gray).Text(FText::FromString(Details))
+        ]
+    ];
+}
+
+FReply SNsSpyglassWhatIfWidget::OnCopyClicked() const
+{
+    if (Result.IsValid())
+    {
+        const FString ProjectEntries = FNsSpyglassWhatIf::MakeProjectPluginEntries(*Result);
+        FPlatformApplicationMisc::ClipboardCopy(*ProjectEntries);
+        FFileHelper::SaveStringToFile(ProjectEntries, *(FPaths::ProjectSavedDir() / TEXT("Spyglass") / TEXT("WhatIfPlugins.json")));
+    }
+    return FReply::Handled();
+}
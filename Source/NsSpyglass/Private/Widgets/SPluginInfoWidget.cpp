@@ -2,12 +2,23 @@
 
 #include "Widgets/SPluginInfoWidget.h"
 #include "Framework/Application/SlateApplication.h"
+#include "Graph/NsSpyglassGraphSubsystem.h"
 #include "Interfaces/IPluginManager.h"
 #include "Widgets/Input/SHyperlink.h"
-#include "Widgets/Layout/SScrollBox.h"
+#include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SSeparator.h"
 #include "Widgets/Text/STextBlock.h"
 
+/** Time the hover has to rest on a node before the panel follows it. */
+static constexpr float HoverDebounceSeconds = 0.06f;
+
+/** Module label colors by host type. */
+static const FLinearColor RuntimeModuleColor(0.2f, 0.6f, 1.f);
+static const FLinearColor EditorModuleColor(1.f, 1.f, 0.1f);
+
+/** Color of the secondary text in list rows. */
+static const FLinearColor RowDetailColor(0.6f, 0.6f, 0.6f);
+
 void SPluginInfoWidget::Construct(const FArguments& InArgs)
 {
     ChildSlot
@@ -15,104 +26,255 @@ void SPluginInfoWidget::Construct(const FArguments& InArgs)
         SNew(SBox)
         .MinDesiredWidth(300)
         [
-            SNew(SScrollBox)
-            + SScrollBox::Slot()
+            SNew(SVerticalBox)
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                SAssignNew(NameText, STextBlock)
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(0.f, 2.f)
+            [
+                SAssignNew(DescriptionText, STextBlock).WrapTextAt(250.f)
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(0.f, 2.f)
+            [
+                SAssignNew(AuthorText, STextBlock)
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(0.f, 2.f)
             [
-                SNew(SVerticalBox)
-                + SVerticalBox::Slot().AutoHeight()
-                [
-                    SAssignNew(NameText, STextBlock)
-                ]
-                + SVerticalBox::Slot().AutoHeight().Padding(0.f, 2.f)
-                [
-                    SAssignNew(DescriptionText, STextBlock).WrapTextAt(250.f)
-                ]
-                + SVerticalBox::Slot().AutoHeight().Padding(0.f, 2.f)
-                [
-                    SAssignNew(AuthorText, STextBlock)
-                ]
-                + SVerticalBox::Slot().AutoHeight().Padding(0.f, 2.f)
-                [
-                    SAssignNew(DocsLink, SHyperlink)
-                    .Text(FText::FromString("Documentation"))
-                    .OnNavigate(this, &SPluginInfoWidget::OnDocsClicked)
-                ]
-                + SVerticalBox::Slot().AutoHeight().Padding(0.f, 5.f)
-                [
-                    SNew(SSeparator)
-                ]
-                + SVerticalBox::Slot().AutoHeight()
-                [
-                    SNew(STextBlock).Text(FText::FromString("Modules:"))
-                ]
-                + SVerticalBox::Slot().AutoHeight()
-                [
-                    SAssignNew(ModulesBox, SVerticalBox)
-                ]
-                + SVerticalBox::Slot().AutoHeight().Padding(0.f, 5.f)
-                [
-                    SNew(SSeparator)
-                ]
-                + SVerticalBox::Slot().AutoHeight()
-                [
-                    SNew(STextBlock).Text(FText::FromString("Depends on:"))
-                ]
-                + SVerticalBox::Slot().AutoHeight()
-                [
-                    SAssignNew(DependenciesBox, SVerticalBox)
-                ]
+                SAssignNew(DocsLink, SHyperlink)
+                .Text(FText::FromString("Documentation"))
+                .OnNavigate(this, &SPluginInfoWidget::OnDocsClicked)
+            ]
+            + SVerticalBox::Slot().AutoHeight().Padding(0.f, 2.f)
+            [
+                SAssignNew(CountsText, STextBlock).WrapTextAt(250.f)
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                MakeSection(TEXT("Modules:"), EPluginInfoSection::Modules)
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                MakeSection(TEXT("Depends on:"), EPluginInfoSection::Dependencies)
+            ]
+            + SVerticalBox::Slot().AutoHeight()
+            [
+                MakeSection(TEXT("Depended on by:"), EPluginInfoSection::Dependents)
             ]
         ]
     ];
 
-    SetPlugin(nullptr);
+    ApplyPlugin();
+}
+
+TSharedRef<SWidget> SPluginInfoWidget::MakeSection(const FString& Title, const EPluginInfoSection Section)
+{
+    const int32 SectionIndex = static_cast<int32>(Section);
+
+    return SNew(SVerticalBox)
+        + SVerticalBox::Slot().AutoHeight().Padding(0.f, 5.f)
+        [
+            SNew(SSeparator)
+        ]
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SNew(STextBlock).Text(FText::FromString(Title))
+        ]
+        + SVerticalBox::Slot().AutoHeight()
+        [
+            SNew(SBox)
+            .MaxDesiredHeight(160.f)
+            [
+                SAssignNew(SectionLists[SectionIndex], SListView<FRowItem>)
+                .ListItemsSource(&SectionItems[SectionIndex])
+                .SelectionMode(ESelectionMode::None)
+                .OnGenerateRow(this, &SPluginInfoWidget::GenerateRow, Section)
+            ]
+        ];
 }
 
 void SPluginInfoWidget::SetPlugin(TSharedPtr<IPlugin> InPlugin)
 {
-    CurrentPlugin = InPlugin;
+    PendingPlugin = InPlugin;
+    PendingDelay = PendingPlugin == CurrentPlugin ? -1.f : HoverDebounceSeconds;
+}
+
+void SPluginInfoWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+    if (PendingDelay >= 0.f)
+    {
+        PendingDelay -= InDeltaTime;
+        if (PendingDelay < 0.f)
+        {
+            ApplyPlugin();
+        }
+    }
+}
+
+void SPluginInfoWidget::ApplyPlugin()
+{
+    CurrentPlugin = PendingPlugin;
+    PendingDelay = -1.f;
 
     if (!CurrentPlugin)
     {
+        CurrentModel.Reset();
         NameText->SetText(FText::FromString("Hover a node"));
         DescriptionText->SetText(FText());
         AuthorText->SetText(FText());
+        CountsText->SetText(FText());
         DocsLink->SetVisibility(EVisibility::Collapsed);
-        ModulesBox->ClearChildren();
-        DependenciesBox->ClearChildren();
+        for (int32 Section = 0; Section < static_cast<int32>(EPluginInfoSection::Num); ++Section)
+        {
+            SetRowCount(static_cast<EPluginInfoSection>(Section), 0);
+        }
         return;
     }
 
-    const FPluginDescriptor& Desc = CurrentPlugin->GetDescriptor();
+    CurrentModel = GetViewModel(CurrentPlugin.ToSharedRef());
 
-    NameText->SetText(FText::FromString(CurrentPlugin->GetFriendlyName()));
-    DescriptionText->SetText(FText::FromString(Desc.Description));
-    AuthorText->SetText(FText::FromString(Desc.CreatedBy));
+    NameText->SetText(CurrentModel->Name);
+    DescriptionText->SetText(CurrentModel->Description);
+    AuthorText->SetText(CurrentModel->Author);
+    CountsText->SetText(CurrentModel->Counts);
 
-    DocsURL = Desc.DocsURL;
+    DocsURL = CurrentModel->DocsURL;
     DocsLink->SetVisibility(DocsURL.IsEmpty() ? EVisibility::Collapsed : EVisibility::Visible);
 
-    ModulesBox->ClearChildren();
+    for (int32 Section = 0; Section < static_cast<int32>(EPluginInfoSection::Num); ++Section)
+    {
+        SetRowCount(static_cast<EPluginInfoSection>(Section), CurrentModel->Rows[Section].Num());
+    }
+}
+
+TSharedRef<const FPluginInfoViewModel> SPluginInfoWidget::GetViewModel(const TSharedRef<IPlugin>& Plugin)
+{
+    const FNsSpyglassGraphModelRef Graph = UNsSpyglassGraphSubsystem::Get().GetModel();
+    if (Graph->Version != ViewModelVersion)
+    {
+        ViewModels.Reset();
+        ViewModelVersion = Graph->Version;
+    }
+
+    if (const TSharedRef<const FPluginInfoViewModel>* Cached = ViewModels.Find(Plugin->GetName()))
+    {
+        return *Cached;
+    }
+
+    const FPluginDescriptor& Desc = Plugin->GetDescriptor();
+    TSharedRef<FPluginInfoViewModel> Model = MakeShared<FPluginInfoViewModel>();
+    Model->Name = FText::FromString(Plugin->GetFriendlyName());
+    Model->Description = FText::FromString(Desc.Description);
+    Model->Author = FText::FromString(Desc.CreatedBy);
+    Model->DocsURL = Desc.DocsURL;
+
+    TArray<FPluginInfoRow>& Modules = Model->Rows[static_cast<int32>(EPluginInfoSection::Modules)];
     for (const FModuleDescriptor& Mod : Desc.Modules)
     {
-        FLinearColor Color = (Mod.Type == EHostType::Runtime) ? FLinearColor(0.2f, 0.6f, 1.f) : FLinearColor(1.f, 1.f, 0.1f);
-        ModulesBox->AddSlot().AutoHeight()
-        [
-            SNew(STextBlock).ColorAndOpacity(Color).Text(FText::FromName(Mod.Name))
-        ];
+        FPluginInfoRow& Row = Modules.AddDefaulted_GetRef();
+        Row.Label = FText::FromName(Mod.Name);
+        Row.Detail = FText::FromString(FString::Printf(TEXT("%s, %s"), EHostType::ToString(Mod.Type), ELoadingPhase::ToString(Mod.LoadingPhase)));
+        Row.Color = (Mod.Type == EHostType::Runtime) ? RuntimeModuleColor : EditorModuleColor;
     }
 
-    DependenciesBox->ClearChildren();
-    for (const FPluginReferenceDescriptor& Ref : Desc.Plugins)
+    TArray<FPluginInfoRow>& Dependencies = Model->Rows[static_cast<int32>(EPluginInfoSection::Dependencies)];
+    TArray<FPluginInfoRow>& Dependents = Model->Rows[static_cast<int32>(EPluginInfoSection::Dependents)];
+
+    const int32 Node = Graph->Query->FindNode(Plugin->GetName());
+    if (Node != INDEX_NONE)
     {
-        if (Ref.bEnabled)
+        const FPluginNode& GraphNode = Graph->Nodes[Node];
+        for (int32 Dependency : GraphNode.Dependencies)
         {
-            DependenciesBox->AddSlot().AutoHeight()
-            [
-                SNew(STextBlock).Text(FText::FromString(Ref.Name))
-            ];
+            Dependencies.AddDefaulted_GetRef().Label = FText::FromString(Graph->Nodes[Dependency].Name);
         }
+        for (int32 Dependent : GraphNode.Dependents)
+        {
+            Dependents.AddDefaulted_GetRef().Label = FText::FromString(Graph->Nodes[Dependent].Name);
+        }
+
+        Model->Counts = FText::FromString(FString::Printf(TEXT("Requires %d plugins, %d depend on it (transitive)"),
+            Graph->Query->GetTransitiveDependencyCount(Node), Graph->Query->GetTransitiveDependentCount(Node)));
+    }
+    else
+    {
+        // Plugins only present in a snapshot have no live counterpart, fall back to the descriptor
+        for (const FPluginReferenceDescriptor& Ref : Desc.Plugins)
+        {
+            if (Ref.bEnabled)
+            {
+                Dependencies.AddDefaulted_GetRef().Label = FText::FromString(Ref.Name);
+            }
+        }
+        Model->Counts = FText::FromString("Not part of the live graph");
+    }
+
+    ViewModels.Add(Plugin->GetName(), Model);
+    return Model;
+}
+
+void SPluginInfoWidget::SetRowCount(const EPluginInfoSection Section, const int32 Num)
+{
+    while (RowSlots.Num() < Num)
+    {
+        RowSlots.Add(MakeShared<int32>(RowSlots.Num()));
+    }
+
+    TArray<FRowItem>& Items = SectionItems[static_cast<int32>(Section)];
+    if (Items.Num() == Num)
+    {
+        // Same slots as before, the rows rebind to the new view model on their own
+        return;
+    }
+
+    Items.Reset(Num);
+    Items.Append(RowSlots.GetData(), Num);
+    SectionLists[static_cast<int32>(Section)]->RequestListRefresh();
+}
+
+const FPluginInfoRow* SPluginInfoWidget::GetRow(const EPluginInfoSection Section, const int32 Index) const
+{
+    if (!CurrentModel.IsValid())
+    {
+        return nullptr;
     }
+
+    const TArray<FPluginInfoRow>& Rows = CurrentModel->Rows[static_cast<int32>(Section)];
+    return Rows.IsValidIndex(Index) ? &Rows[Index] : nullptr;
+}
+
+TSharedRef<ITableRow> SPluginInfoWidget::GenerateRow(FRowItem Item, const TSharedRef<STableViewBase>& OwnerTable, const EPluginInfoSection Section)
+{
+    const int32 Index = *Item;
+
+    return SNew(STableRow<FRowItem>, OwnerTable)
+    [
+        SNew(SHorizontalBox)
+        + SHorizontalBox::Slot().AutoWidth()
+        [
+            SNew(STextBlock)
+            .Text_Lambda([this, Section, Index]()
+            {
+                const FPluginInfoRow* Row = GetRow(Section, Index);
+                return Row ? Row->Label : FText::GetEmpty();
+            })
+            .ColorAndOpacity_Lambda([this, Section, Index]()
+            {
+                const FPluginInfoRow* Row = GetRow(Section, Index);
+                return FSlateColor(Row ? Row->Color : FLinearColor::White);
+            })
+        ]
+        + SHorizontalBox::Slot().FillWidth(1.f).HAlign(HAlign_Right).Padding(8.f, 0.f, 0.f, 0.f)
+        [
+            SNew(STextBlock)
+            .ColorAndOpacity(RowDetailColor)
+            .Text_Lambda([this, Section, Index]()
+            {
+                const FPluginInfoRow* Row = GetRow(Section, Index);
+                return Row ? Row->Detail : FText::GetEmpty();
+            })
+        ]
+    ];
 }
 
 void SPluginInfoWidget::OnDocsClicked() const
@@ -122,4 +284,3 @@ void SPluginInfoWidget::OnDocsClicked() const
         FPlatformProcess::LaunchURL(*DocsURL, nullptr, nullptr);
     }
 }
-
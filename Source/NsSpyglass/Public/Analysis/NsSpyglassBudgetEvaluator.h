@@ -0,0 +1,79 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+class UNsSpyglassBudgetSettings;
+struct FNsSpyglassBudgetGroup;
+struct FNsSpyglassReachability;
+
+/** One budget that was exceeded. */
+struct FNsSpyglassBudgetViolation
+{
+    /** Budget identifier, e.g. MaxTransitiveDependencies or ForbiddenEdge. */
+    FString Rule;
+
+    /** Plugin the violation is attributed to, empty for global budgets. */
+    FString Plugin;
+
+    /** Human readable explanation. */
+    FString Detail;
+
+    /** Measured value. */
+    int32 Actual = 0;
+
+    /** Configured limit. */
+    int32 Limit = 0;
+};
+
+/** Result of evaluating all budgets against one graph. */
+struct FNsSpyglassBudgetReport
+{
+    /** Number of enabled plugins. */
+    int32 NumPlugins = 0;
+
+    /** Modules declared by enabled plugins. */
+    int32 NumEnabledModules = 0;
+
+    /** Longest dependency chain. */
+    int32 MaxDepth = 0;
+
+    /** Number of circular dependencies. */
+    int32 NumCycles = 0;
+
+    /** Per plugin transitive dependency counts, parallel to the evaluated nodes. */
+    TArray<int32> TransitiveDependencies;
+
+    /** Plugin names, parallel to TransitiveDependencies. */
+    TArray<FString> PluginNames;
+
+    /** Budgets that were exceeded. */
+    TArray<FNsSpyglassBudgetViolation> Violations;
+
+    /** Time spent evaluating, excluding graph construction. */
+    double EvaluationSeconds = 0.0;
+
+    /** Whether every budget holds. */
+    bool Passed() const { return Violations.Num() == 0; }
+
+    /** Machine readable report. */
+    FString ToJson() const;
+};
+
+/**
+ * Evaluates UNsSpyglassBudgetSettings against the plugin graph.
+ */
+class FNsSpyglassBudgetEvaluator
+{
+
+// Functions
+public:
+
+    /** Check every configured budget. */
+    static void Evaluate(const TArray<FPluginNode>& Nodes, const UNsSpyglassBudgetSettings& Settings, FNsSpyglassBudgetReport& OutReport);
+
+    /** Whether a node belongs to a budget group. */
+    static bool MatchesGroup(const FPluginNode& Node, const FNsSpyglassBudgetGroup& Group);
+};
@@ -0,0 +1,142 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/NsSpyglassGatherJob.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/** Compile time of one module, summed over its translation units. */
+struct FNsSpyglassModuleTiming
+{
+    /** Module name, as the directory UBT compiles it into. */
+    FName Module;
+
+    /** Seconds spent in the compiler. */
+    double Seconds = 0.0;
+
+    /** Number of translation units traced. */
+    int32 NumFiles = 0;
+};
+
+/** Compile time attributed to plugins. */
+struct FNsSpyglassBuildTimingResult
+{
+    /** Hash of the node names the per node arrays refer to. */
+    uint32 PluginSetHash = 0;
+
+    /** Every traced module, plugin or not, slowest first. */
+    TArray<FNsSpyglassModuleTiming> Modules;
+
+    /** Per node, seconds spent compiling the plugin's own modules. */
+    TArray<double> ExclusiveSeconds;
+
+    /** Per node, its own seconds plus those of every plugin it depends on, directly or transitively. */
+    TArray<double> InclusiveSeconds;
+
+    /** Largest value of each array, for normalizing heat. */
+    double MaxExclusive = 0.0;
+    double MaxInclusive = 0.0;
+
+    /** Node with the most exclusive compile time. */
+    int32 HottestNode = INDEX_NONE;
+
+    /** Trace files found, and how many of them had to be parsed rather than read from the cache. */
+    int32 NumTraces = 0;
+    int32 NumParsed = 0;
+
+    /** Wall time spent gathering. */
+    double GatherSeconds = 0.0;
+};
+
+using FNsSpyglassBuildTimingResultPtr = TSharedPtr<const FNsSpyglassBuildTimingResult, ESPMode::ThreadSafe>;
+
+/**
+ * Attributes compile time from local build traces to plugins.
+ * Reads the clang -ftime-trace files UBT leaves next to the object files in the Intermediate directories of the
+ * project, the engine and every plugin. Each trace is scanned as a stream, so a large one never sits in memory,
+ * and traces are parsed in parallel. Per trace results are cached on disk by path, size and timestamp, so only
+ * traces written by a newer build are parsed again.
+ */
+class FNsSpyglassBuildTimings
+{
+
+// Functions
+public:
+
+    /** Shared instance used by every viewer. */
+    static FNsSpyglassBuildTimings& Get();
+
+    /**
+     * Start an asynchronous gather for the given nodes unless a result for them exists.
+     * Forcing rescans the directories for newer traces, the previous result stays available meanwhile.
+     * Must be called on the game thread.
+     */
+    void Request(const TArray<FPluginNode>& Nodes, bool bForce = false);
+
+    /** Latest finished result, may belong to another plugin set. */
+    FNsSpyglassBuildTimingResultPtr GetResult() const { return Job.GetResult(); }
+
+    /** Whether a gather is in flight. */
+    bool IsGathering() const { return Job.IsGathering(); }
+
+    /** Parse progress in the range 0..1. */
+    float GetProgress() const { return Job.GetProgress(); }
+
+    /** Cancel pending work. */
+    void Shutdown();
+
+private:
+
+    FNsSpyglassBuildTimings();
+
+    /** Input captured on the game thread for the worker. */
+    struct FGatherInput
+    {
+        /** Nodes the result is attributed to. */
+        TArray<FPluginNode> Nodes;
+
+        /** Module name to the node declaring it. */
+        TMap<FName, int32> ModuleToNode;
+
+        /** Intermediate build directories to search. */
+        TArray<FString> Directories;
+
+        /** Hash of the node names. */
+        uint32 PluginSetHash = 0;
+    };
+
+    /** What one trace file contributed, as stored in the cache. */
+    struct FTraceEntry
+    {
+        FString Path;
+        FDateTime Timestamp;
+        int64 Size = 0;
+
+        /** Module the translation unit belongs to. */
+        FString Module;
+
+        /** Compiler seconds, negative when the file held no trace events. */
+        double Seconds = -1.0;
+
+        friend FArchive& operator<<(FArchive& Ar, FTraceEntry& Entry)
+        {
+            return Ar << Entry.Path << Entry.Timestamp << Entry.Size << Entry.Module << Entry.Seconds;
+        }
+    };
+
+    /** Capture everything the worker needs from the nodes. */
+    static void MakeInput(const TArray<FPluginNode>& Nodes, FGatherInput& OutInput);
+
+    /** Find traces, parse the ones not cached and attribute the totals. Runs on a worker. */
+    void Gather(const FGatherInput& Input, FNsSpyglassBuildTimingResult& OutResult, FNsSpyglassGatherProgress& Progress);
+
+// Variables
+private:
+
+    /** Running and finished gathers. */
+    TNsSpyglassGatherJob<FGatherInput, FNsSpyglassBuildTimingResult> Job;
+
+    /** Per trace results of earlier gathers. */
+    TNsSpyglassFileCache<FTraceEntry> TraceCache;
+};
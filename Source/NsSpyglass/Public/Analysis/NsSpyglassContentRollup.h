@@ -0,0 +1,148 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/NsSpyglassGatherJob.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+#include <atomic>
+
+struct FAssetData;
+
+/** Package references from one plugin's content into another plugin's content. */
+struct FNsSpyglassContentEdge
+{
+    /** Node index of the referencing plugin. */
+    int32 From = INDEX_NONE;
+
+    /** Node index of the referenced plugin. */
+    int32 To = INDEX_NONE;
+
+    /** Number of hard package references. */
+    int32 HardReferences = 0;
+
+    /** Number of soft package references. */
+    int32 SoftReferences = 0;
+
+    /** Whether the descriptor of From lists To in its Plugins array. */
+    bool bDeclared = false;
+};
+
+/** Aggregated plugin-to-plugin content references. */
+struct FNsSpyglassContentResult
+{
+    /** Hash of the node names the edge indices refer to. */
+    uint32 PluginSetHash = 0;
+
+    /** Number of packages inspected. */
+    int32 NumPackages = 0;
+
+    /** Weighted edges between plugins. */
+    TArray<FNsSpyglassContentEdge> Edges;
+
+    /** Per node, references into its content from project packages under /Game. */
+    TArray<int32> ProjectReferences;
+
+    /** Wall time spent gathering. */
+    double GatherSeconds = 0.0;
+
+    /** Number of edges that exist in content but not in the descriptors. */
+    int32 NumUndeclared() const;
+};
+
+using FNsSpyglassContentResultPtr = TSharedPtr<const FNsSpyglassContentResult, ESPMode::ThreadSafe>;
+
+/**
+ * Rolls Asset Registry package dependencies up into plugin-to-plugin edges.
+ * Gathering runs on worker threads and the last result is cached until content changes.
+ */
+class FNsSpyglassContentRollup
+{
+
+// Functions
+public:
+
+    /** Shared instance used by every viewer. */
+    static FNsSpyglassContentRollup& Get();
+
+    /** Hash identifying a node array by plugin names. */
+    static uint32 ComputePluginSetHash(const TArray<FPluginNode>& Nodes);
+
+    /** Gather synchronously on the calling thread. Used by commandlets. */
+    static void GatherBlocking(const TArray<FPluginNode>& Nodes, FNsSpyglassContentResult& OutResult);
+
+    /**
+     * Start an asynchronous gather for the given nodes unless a valid cached result exists.
+     * Must be called on the game thread.
+     */
+    void Request(const TArray<FPluginNode>& Nodes, bool bForce = false);
+
+    /** Latest finished result, may belong to another plugin set. */
+    FNsSpyglassContentResultPtr GetResult() const { return Job.GetResult(); }
+
+    /** Whether a gather is in flight. */
+    bool IsGathering() const { return Job.IsGathering(); }
+
+    /** Gather progress in the range 0..1. */
+    float GetProgress() const { return Job.GetProgress(); }
+
+    /** Incremented every time a new result is published. */
+    uint32 GetResultVersion() const { return Job.GetResultVersion(); }
+
+    /** Cancel pending work and unbind from the Asset Registry. */
+    void Shutdown();
+
+private:
+
+    FNsSpyglassContentRollup();
+
+    /** Input captured on the game thread for the worker. */
+    struct FGatherInput
+    {
+        /** Mount root name to node index for plugins that can hold content. */
+        TMap<FName, int32> RootToNode;
+
+        /** Declared dependency pairs packed as (From << 32) | To. */
+        TSet<uint64> Declared;
+
+        /** Hash of the node names. */
+        uint32 PluginSetHash = 0;
+
+        /** Number of nodes, also used as the owner index of project packages. */
+        int32 NumNodes = 0;
+    };
+
+    /** Capture everything the worker needs from the nodes. */
+    static void MakeInput(const TArray<FPluginNode>& Nodes, FGatherInput& OutInput);
+
+    /** Enumerate packages and aggregate their dependencies in parallel. */
+    static void Gather(const FGatherInput& Input, FNsSpyglassContentResult& OutResult, std::atomic<int32>* Processed, std::atomic<int32>* Total, const std::atomic<bool>* Cancel);
+
+    /** Whether the registry finished its initial scan. Waits for it otherwise. */
+    bool CanStartGather();
+
+    /** Resume a gather that waited for the initial registry scan. */
+    void OnRegistryFilesLoaded();
+
+    /** Mark the cached result as stale when content changes. */
+    void OnAssetChanged(const FAssetData& AssetData);
+    void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+
+    /** Bind to Asset Registry change notifications. */
+    void BindRegistryEvents();
+
+// Variables
+private:
+
+    /** Running and finished gathers. */
+    TNsSpyglassGatherJob<FGatherInput, FNsSpyglassContentResult> Job;
+
+    /** Whether content changed since the cached result was built. */
+    bool bDirty = false;
+
+    /** Whether a gather is waiting for the initial registry scan. */
+    bool bWaitingForRegistry = false;
+
+    /** Whether registry delegates are bound. */
+    bool bBoundToRegistry = false;
+};
@@ -0,0 +1,51 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Counts heap allocations made by the graph view's per-frame work.
+ * While enabled, the global allocator is wrapped in a proxy that forwards every call unchanged and counts the
+ * Malloc and Realloc calls a thread makes inside an FCountScope. Disabling puts the wrapped allocator back; the
+ * proxy never changes a pointer, so memory allocated through it is freed the same way either side of the swap.
+ * Allocations made inside an FSlateScope, where Slate copies draw element data into its element list, are counted
+ * apart, since the view cannot avoid them.
+ * Every frame both counts of the previous one are published as the "Frame Allocations" and "Slate Element
+ * Allocations" stats of the Spyglass group.
+ */
+class FNsSpyglassFrameAllocations
+{
+
+// Functions
+public:
+
+    /** Install or remove the counting proxy. Must be called on the game thread. */
+    static void SetEnabled(bool bEnable);
+
+    /** Whether allocations are being counted. */
+    static bool IsEnabled();
+
+    /** Close the frame and publish its counts. Runs on the core ticker while enabled, tests call it directly. */
+    static void EndFrame();
+
+    /** Allocations counted during the last frame. */
+    static uint32 GetLastFrameCount();
+
+    /** Allocations Slate made for the view's draw elements during the last frame. */
+    static uint32 GetLastFrameSlateAllocations();
+
+    /** Counts the calling thread's allocations while alive. Scopes nest. */
+    struct FCountScope
+    {
+        FCountScope();
+        ~FCountScope();
+    };
+
+    /** Counts the calling thread's allocations as Slate's while alive, around draw element calls. */
+    struct FSlateScope
+    {
+        FSlateScope();
+        ~FSlateScope();
+    };
+};
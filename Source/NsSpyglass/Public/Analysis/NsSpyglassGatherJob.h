@@ -0,0 +1,299 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Async.h"
+#include "Async/Future.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include <atomic>
+
+/** Progress and cancellation shared between a gather job and its worker. */
+struct FNsSpyglassGatherProgress
+{
+    /** Work items finished and expected, written by the worker. */
+    std::atomic<int32> Done{0};
+    std::atomic<int32> Total{0};
+
+    /** Set to stop the worker early. */
+    std::atomic<bool> bCancel{false};
+
+    /** Done over Total in the range 0..1. */
+    float Get() const
+    {
+        const int32 NumTotal = Total.load(std::memory_order_relaxed);
+        return NumTotal > 0 ? FMath::Clamp(static_cast<float>(Done.load(std::memory_order_relaxed)) / static_cast<float>(NumTotal), 0.f, 1.f) : 0.f;
+    }
+
+    bool IsCancelled() const { return bCancel.load(std::memory_order_relaxed); }
+};
+
+/**
+ * Runs one analysis of a plugin set on the thread pool and publishes its result on the game thread.
+ * Input is captured on the game thread and carries the PluginSetHash of the nodes, the result carries the same
+ * hash and a GatherSeconds field. At most one gather runs at a time. A request arriving meanwhile waits as the
+ * pending input and replaces any older pending one, so a burst of rebuilds gathers only the first and the last set.
+ */
+template <typename InputType, typename ResultType>
+class TNsSpyglassGatherJob
+{
+
+// Functions
+public:
+
+    using FInputPtr = TSharedPtr<InputType, ESPMode::ThreadSafe>;
+    using FResultPtr = TSharedPtr<const ResultType, ESPMode::ThreadSafe>;
+
+    /** Work done on the worker. Must poll the progress for cancellation. */
+    using FGatherFunction = TFunction<void(const InputType&, ResultType&, FNsSpyglassGatherProgress&)>;
+
+    /** Decides on the game thread whether the pending input may start now. One that says no calls Start later. */
+    using FCanStartFunction = TFunction<bool()>;
+
+    explicit TNsSpyglassGatherJob(FGatherFunction InGather, FCanStartFunction InCanStart = nullptr)
+        : GatherFunction(MoveTemp(InGather))
+        , CanStartFunction(MoveTemp(InCanStart))
+    {
+    }
+
+    /** Whether a request for the plugin set is already answered by the published result, or by a queued or running gather. */
+    bool Covers(const uint32 PluginSetHash, const bool bForce) const
+    {
+        if (!bForce && CachedResult.IsValid() && CachedResult->PluginSetHash == PluginSetHash)
+        {
+            return true;
+        }
+        return IsGathering() && (PendingInput.IsValid() ? PendingInput->PluginSetHash : RunningHash) == PluginSetHash;
+    }
+
+    /** Queue input, replacing older pending input, and start it unless a gather runs. Game thread only. */
+    void Request(FInputPtr Input)
+    {
+        check(IsInGameThread());
+        PendingInput = MoveTemp(Input);
+        Start();
+    }
+
+    /** Launch the worker for the pending input if none runs and the job may start. Game thread only. */
+    void Start()
+    {
+        if (bRunning || !PendingInput.IsValid() || (CanStartFunction && !CanStartFunction()))
+        {
+            return;
+        }
+
+        FInputPtr Input = MoveTemp(PendingInput);
+        bRunning = true;
+        RunningHash = Input->PluginSetHash;
+        Progress.bCancel = false;
+        Progress.Done = 0;
+        Progress.Total = 0;
+
+        GatherFuture = Async(EAsyncExecution::ThreadPool, [this, Input]()
+        {
+            TSharedPtr<ResultType, ESPMode::ThreadSafe> Result = MakeShared<ResultType, ESPMode::ThreadSafe>();
+
+            const double StartTime = FPlatformTime::Seconds();
+            GatherFunction(*Input, *Result, Progress);
+            Result->GatherSeconds = FPlatformTime::Seconds() - StartTime;
+
+            if (Progress.IsCancelled())
+            {
+                return;
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [this, Result]()
+            {
+                if (Progress.IsCancelled())
+                {
+                    return;
+                }
+
+                CachedResult = Result;
+                ++ResultVersion;
+                bRunning = false;
+
+                // Another plugin set was requested while this one was running
+                Start();
+            });
+        });
+    }
+
+    /** Latest finished result, may belong to another plugin set. */
+    FResultPtr GetResult() const { return CachedResult; }
+
+    /** Incremented every time a new result is published. */
+    uint32 GetResultVersion() const { return ResultVersion; }
+
+    /** Whether a gather runs or waits to start. */
+    bool IsGathering() const { return bRunning || PendingInput.IsValid(); }
+
+    /** Progress of the running gather in the range 0..1. */
+    float GetProgress() const { return Progress.Get(); }
+
+    /** Cancel and wait for the worker, and drop pending input. */
+    void Shutdown()
+    {
+        Progress.bCancel = true;
+        if (GatherFuture.IsValid())
+        {
+            GatherFuture.Wait();
+        }
+
+        bRunning = false;
+        PendingInput.Reset();
+    }
+
+// Variables
+private:
+
+    FGatherFunction GatherFunction;
+    FCanStartFunction CanStartFunction;
+
+    /** Last finished result. */
+    FResultPtr CachedResult;
+
+    /** Input waiting for the running gather to finish, or for the job to be allowed to start. */
+    FInputPtr PendingInput;
+
+    /** Worker future, kept so shutdown can wait for it. */
+    TFuture<void> GatherFuture;
+
+    /** Shared with the worker. */
+    FNsSpyglassGatherProgress Progress;
+
+    /** Whether a worker runs, and for which plugin set. */
+    bool bRunning = false;
+    uint32 RunningHash = 0;
+
+    /** Published result counter. */
+    uint32 ResultVersion = 0;
+};
+
+/**
+ * Per file results of an analysis, kept in Saved/Spyglass across sessions.
+ * Entries are keyed by path and reused while the file keeps its size and timestamp, so only files written since
+ * the last gather are read again. Entries of files another plugin set gathered are kept for when it comes back,
+ * only deleted files drop out. EntryType needs Path, Timestamp and Size members and an archive operator.
+ * Only the gather worker touches it, which never runs twice at once.
+ */
+template <typename EntryType>
+class TNsSpyglassFileCache
+{
+
+// Functions
+public:
+
+    TNsSpyglassFileCache(const TCHAR* InFileName, const uint32 InMagic, const uint32 InVersion)
+        : FileName(InFileName)
+        , Magic(InMagic)
+        , Version(InVersion)
+    {
+    }
+
+    /** Read the cache file the first time it is called. A missing, stale or damaged file leaves the cache empty. */
+    void LoadOnce()
+    {
+        if (bLoaded)
+        {
+            return;
+        }
+        bLoaded = true;
+
+        TArray<uint8> Buffer;
+        if (!FFileHelper::LoadFileToArray(Buffer, *GetPath(), FILEREAD_Silent))
+        {
+            return;
+        }
+
+        FMemoryReader Reader(Buffer);
+        uint32 FileMagic = 0;
+        uint32 FileVersion = 0;
+        Reader << FileMagic << FileVersion;
+        if (FileMagic != Magic || FileVersion != Version)
+        {
+            return;
+        }
+
+        TArray<EntryType> Loaded;
+        Reader << Loaded;
+        if (Reader.IsError())
+        {
+            return;
+        }
+
+        Entries.Reserve(Loaded.Num());
+        for (EntryType& Entry : Loaded)
+        {
+            FString Path = Entry.Path;
+            Entries.Add(MoveTemp(Path), MoveTemp(Entry));
+        }
+    }
+
+    /** Entry of a file still matching its size and timestamp, null when the file has to be read. */
+    const EntryType* Find(const FString& Path, const FDateTime& Timestamp, const int64 Size) const
+    {
+        const EntryType* Cached = Entries.Find(Path);
+        return Cached && Cached->Timestamp == Timestamp && Cached->Size == Size ? Cached : nullptr;
+    }
+
+    /** Add or replace the entry of a file the running gather listed. */
+    void Add(const EntryType& Entry)
+    {
+        Entries.Add(Entry.Path, Entry);
+        Listed.Add(Entry.Path);
+    }
+
+    /** Drop entries of files that no longer exist. Files listed since the last call are known to, only the rest are checked. */
+    void RemoveMissing()
+    {
+        IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+        for (auto It = Entries.CreateIterator(); It; ++It)
+        {
+            if (!Listed.Contains(It.Key()) && !PlatformFile.FileExists(*It.Key()))
+            {
+                It.RemoveCurrent();
+            }
+        }
+        Listed.Reset();
+    }
+
+    /** Write the cache file. */
+    void Save() const
+    {
+        TArray<EntryType> Saved;
+        Entries.GenerateValueArray(Saved);
+
+        TArray<uint8> Buffer;
+        FMemoryWriter Writer(Buffer);
+        uint32 FileMagic = Magic;
+        uint32 FileVersion = Version;
+        Writer << FileMagic << FileVersion << Saved;
+
+        FFileHelper::SaveArrayToFile(Buffer, *GetPath());
+    }
+
+private:
+
+    FString GetPath() const
+    {
+        return FPaths::ProjectSavedDir() / TEXT("Spyglass") / FileName;
+    }
+
+// Variables
+private:
+
+    const TCHAR* FileName;
+    uint32 Magic;
+    uint32 Version;
+
+    TMap<FString, EntryType> Entries;
+    bool bLoaded = false;
+
+    /** Paths added since the last RemoveMissing. */
+    TSet<FString> Listed;
+};
@@ -0,0 +1,142 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/NsSpyglassGatherJob.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/** #include directives from one plugin's source into headers of another plugin. */
+struct FNsSpyglassIncludeEdge
+{
+    /** Node index of the including plugin. */
+    int32 From = INDEX_NONE;
+
+    /** Node index of the plugin owning the included headers. */
+    int32 To = INDEX_NONE;
+
+    /** Number of resolved include directives. */
+    int32 NumIncludes = 0;
+
+    /** Modules on both sides of the first include found, e.g. to name it in a report. */
+    FName FromModule;
+    FName ToModule;
+
+    /** First including file and the include as written in it. */
+    FString ExampleFile;
+    FString ExampleInclude;
+
+    /** Whether the descriptor of From lists To in its Plugins array. */
+    bool bDeclared = false;
+};
+
+/** Plugin-to-plugin source coupling found by scanning includes. */
+struct FNsSpyglassIncludeResult
+{
+    /** Hash of the node names the edge indices refer to. */
+    uint32 PluginSetHash = 0;
+
+    /** Weighted edges between plugins, most includes first. */
+    TArray<FNsSpyglassIncludeEdge> Edges;
+
+    /** Source files found, and how many of them had to be scanned rather than read from the cache. */
+    int32 NumFiles = 0;
+    int32 NumScanned = 0;
+
+    /** Include directives seen, and how many of them resolved to a header of another plugin. */
+    int32 NumIncludes = 0;
+    int32 NumResolved = 0;
+
+    /** Wall time spent gathering. */
+    double GatherSeconds = 0.0;
+
+    /** Number of edges that exist in source but not in the descriptors. */
+    int32 NumUndeclared() const;
+};
+
+using FNsSpyglassIncludeResultPtr = TSharedPtr<const FNsSpyglassIncludeResult, ESPMode::ThreadSafe>;
+
+/**
+ * Finds C++ coupling between plugins that descriptor references miss.
+ * Walks the Source directory of every plugin in parallel, memory-maps each source file and pulls out its #include
+ * directives with a scan that tests eight bytes per step for a '#'. Includes are resolved against the headers of
+ * the Public, Classes and Internal directories of every plugin module, the way UBT adds them to include paths.
+ * Directives per file are cached on disk by path, size and timestamp, so a rescan only opens changed files.
+ * Preprocessor state is not evaluated: includes inside #if 0 or block comments count like any other.
+ */
+class FNsSpyglassIncludeScanner
+{
+
+// Functions
+public:
+
+    /** Shared instance used by every viewer. */
+    static FNsSpyglassIncludeScanner& Get();
+
+    /**
+     * Start an asynchronous gather for the given nodes unless a result for them exists.
+     * Forcing rescans the source trees for changed files, the previous result stays available meanwhile.
+     * Must be called on the game thread.
+     */
+    void Request(const TArray<FPluginNode>& Nodes, bool bForce = false);
+
+    /** Latest finished result, may belong to another plugin set. */
+    FNsSpyglassIncludeResultPtr GetResult() const { return Job.GetResult(); }
+
+    /** Whether a gather is in flight. */
+    bool IsGathering() const { return Job.IsGathering(); }
+
+    /** Scan progress in the range 0..1. */
+    float GetProgress() const { return Job.GetProgress(); }
+
+    /** Cancel pending work. */
+    void Shutdown();
+
+private:
+
+    FNsSpyglassIncludeScanner();
+
+    /** Input captured on the game thread for the worker. */
+    struct FGatherInput
+    {
+        /** Per node, the plugin's Source directory, empty for plugins without code. */
+        TArray<FString> SourceDirs;
+
+        /** Declared dependency pairs packed as (From << 32) | To. */
+        TSet<uint64> Declared;
+
+        /** Hash of the node names. */
+        uint32 PluginSetHash = 0;
+    };
+
+    /** Includes of one source file, as stored in the cache. */
+    struct FSourceEntry
+    {
+        FString Path;
+        FDateTime Timestamp;
+        int64 Size = 0;
+
+        /** Include paths as written, without quotes or angle brackets. */
+        TArray<FString> Includes;
+
+        friend FArchive& operator<<(FArchive& Ar, FSourceEntry& Entry)
+        {
+            return Ar << Entry.Path << Entry.Timestamp << Entry.Size << Entry.Includes;
+        }
+    };
+
+    /** Capture everything the worker needs from the nodes. */
+    static void MakeInput(const TArray<FPluginNode>& Nodes, FGatherInput& OutInput);
+
+    /** Find sources, scan the ones not cached and resolve their includes. Runs on a worker. */
+    void Gather(const FGatherInput& Input, FNsSpyglassIncludeResult& OutResult, FNsSpyglassGatherProgress& Progress);
+
+// Variables
+private:
+
+    /** Running and finished gathers. */
+    TNsSpyglassGatherJob<FGatherInput, FNsSpyglassIncludeResult> Job;
+
+    /** Per file includes of earlier gathers. */
+    TNsSpyglassFileCache<FSourceEntry> SourceCache;
+};
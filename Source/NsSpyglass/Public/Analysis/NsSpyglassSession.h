@@ -0,0 +1,113 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Kind of a recorded session event. */
+enum class ENsSpyglassSessionEventType : uint8
+{
+    MouseDown,
+    MouseUp,
+    MouseMove,
+    DoubleClick,
+    Wheel,
+
+    /** Search text changed, carried in Text. */
+    Filter,
+
+    /** Layout mode changed, carried in Button. */
+    LayoutMode,
+
+    /** Layout settings changed, carried in Settings. */
+    Settings
+};
+
+/** Layout settings a session depends on. */
+struct FNsSpyglassSessionSettings
+{
+    float Repulsion = 0.f;
+    float CenterForce = 0.f;
+    float AttractionScale = 0.f;
+    int32 FocusHops = 0;
+    uint8 FocusDirection = 0;
+    bool bBundleEdges = false;
+
+    /** Read the current editor settings. */
+    static FNsSpyglassSessionSettings Capture();
+
+    /** Write these values into the editor settings without saving them. */
+    void Apply() const;
+
+    bool operator==(const FNsSpyglassSessionSettings& Other) const;
+    bool operator!=(const FNsSpyglassSessionSettings& Other) const { return !(*this == Other); }
+
+    friend FArchive& operator<<(FArchive& Ar, FNsSpyglassSessionSettings& Settings);
+};
+
+/** One input event, applied before the frame it was recorded in is ticked. */
+struct FNsSpyglassSessionEvent
+{
+    /** Frame index the event arrived in. */
+    uint32 Frame = 0;
+
+    ENsSpyglassSessionEventType Type = ENsSpyglassSessionEventType::MouseMove;
+
+    /** Cursor in local view space. */
+    FVector2f Position = FVector2f::ZeroVector;
+
+    /** 0 for the left and 1 for the right mouse button, or the layout mode. */
+    uint8 Button = 0;
+
+    float WheelDelta = 0.f;
+
+    FString Text;
+
+    FNsSpyglassSessionSettings Settings;
+
+    friend FArchive& operator<<(FArchive& Ar, FNsSpyglassSessionEvent& Event);
+};
+
+/**
+ * Everything needed to re-run a graph view deterministically: the graph and its layout as a snapshot,
+ * the random seed, settings, view state, input events and the delta of every frame.
+ * Sessions are recorded from the graph view and replayed with Spyglass.Replay.
+ */
+struct FNsSpyglassSession
+{
+    /** File identifier and format version. */
+    static constexpr uint32 Magic = 0x5353534E; // "NSSS"
+    static constexpr uint32 Version = 1;
+
+    /** Graph and starting layout in the snapshot format. */
+    TArray<uint8> Snapshot;
+
+    /** Seed of the view's random stream. */
+    int32 Seed = 0;
+
+    /** Settings when recording started. */
+    FNsSpyglassSessionSettings Settings;
+
+    /** View state when recording started. */
+    FVector2D ViewSize = FVector2D::ZeroVector;
+    float ViewScale = 1.f;
+    FVector2D ViewOffset = FVector2D::ZeroVector;
+    float ZoomAmount = 1.f;
+    uint8 LayoutMode = 0;
+    FString FilterText;
+
+    /** Delta time of every recorded frame. */
+    TArray<float> FrameDeltas;
+
+    /** Input in arrival order. */
+    TArray<FNsSpyglassSessionEvent> Events;
+
+    /** Write the session to disk. */
+    bool Save(const FString& FilePath) const;
+
+    /** Read a session. Returns false and fills OutError when the file is missing or malformed. */
+    bool Load(const FString& FilePath, FString& OutError);
+
+    /** Default folder for recorded sessions and replay reports. */
+    static FString GetDefaultDirectory();
+};
@@ -0,0 +1,89 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/NsSpyglassSession.h"
+#include "Containers/Ticker.h"
+#include "Input/HittestGrid.h"
+
+class SNsSpyglassGraphWidget;
+class SWindow;
+class FSlateWindowElementList;
+
+/** Measured cost of one replayed frame. */
+struct FNsSpyglassReplayFrame
+{
+    /** Recorded delta the frame was ticked with. */
+    float DeltaTime = 0.f;
+
+    /** Whole tick, and the force solver within it. */
+    double TickMs = 0.0;
+    double SolverMs = 0.0;
+
+    /** Building the draw elements. */
+    double PaintMs = 0.0;
+};
+
+/**
+ * Re-runs a recorded session on a graph view that is never shown.
+ * Every editor frame replays one recorded frame: the events recorded before it are dispatched to the view,
+ * which is then ticked with the recorded delta and painted into an element list that is never rendered.
+ * Background work started by the view, like layered layouts and edge bundling, completes between frames as it would live.
+ * When all frames ran, per-frame timings are written to a CSV next to the session and summarized in the log.
+ */
+class FNsSpyglassSessionReplay
+{
+
+// Functions
+public:
+
+    /** Start replaying a session file. Only one replay runs at a time. */
+    static bool Start(const FString& SessionPath, FString& OutError);
+
+    /** Whether a replay is running. */
+    static bool IsRunning();
+
+    /** Destructor */
+    ~FNsSpyglassSessionReplay();
+
+private:
+
+    /** Replay the next frame. Returns false once the session ended. */
+    bool Step(float DeltaTime);
+
+    /** Send one recorded event to the view. */
+    void Dispatch(const FNsSpyglassSessionEvent& Event);
+
+    /** Write the CSV, log the summary and restore the editor settings. */
+    void Finish();
+
+// Variables
+private:
+
+    /** Replayed session and where it came from. */
+    FNsSpyglassSession Session;
+    FString SessionPath;
+
+    /** Offscreen view and the window its elements are attributed to. */
+    TSharedPtr<SNsSpyglassGraphWidget> Widget;
+    TSharedPtr<SWindow> Window;
+    TUniquePtr<FSlateWindowElementList> Elements;
+    FHittestGrid HittestGrid;
+
+    /** Next frame and next event to replay. */
+    int32 Frame = 0;
+    int32 NextEvent = 0;
+
+    /** Simulated time passed to the view. */
+    double CurrentTime = 0.0;
+
+    /** Results so far. */
+    TArray<FNsSpyglassReplayFrame> Frames;
+
+    /** Editor settings before the replay applied the recorded ones. */
+    FNsSpyglassSessionSettings SavedSettings;
+
+    /** Core ticker registration. */
+    FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,67 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+struct FNsSpyglassContentResult;
+
+/** Enabled plugin that nothing appears to use. */
+struct FNsSpyglassUnusedPlugin
+{
+    /** Node index in the graph the analysis ran on. */
+    int32 Node = INDEX_NONE;
+
+    /** Plugin name as used in the .uproject Plugins array. */
+    FString Name;
+
+    /** Number of modules the plugin declares. */
+    int32 NumModules = 0;
+
+    /** Size of the module binaries found on disk. */
+    int64 BinaryBytes = 0;
+};
+
+/** Result of an unused plugin search, sorted by estimated savings. */
+struct FNsSpyglassUnusedResult
+{
+    /** Hash of the node names the indices refer to. */
+    uint32 PluginSetHash = 0;
+
+    /** Candidates, largest savings first. */
+    TArray<FNsSpyglassUnusedPlugin> Candidates;
+
+    /** Whether content references were taken into account. */
+    bool bCheckedContent = false;
+
+    /** Whether the given node is a candidate. */
+    bool Contains(int32 Node) const;
+};
+
+using FNsSpyglassUnusedResultPtr = TSharedPtr<const FNsSpyglassUnusedResult, ESPMode::ThreadSafe>;
+
+/**
+ * Finds enabled plugins with no dependents, no referenced content and no modules referenced by build rules.
+ * Reads descriptors and Build.cs files only, so it is safe to run on a worker thread.
+ */
+class FNsSpyglassUnusedPluginFinder
+{
+
+// Functions
+public:
+
+    /** Run the analysis. Content may be null when no rollup is available. */
+    static void Find(const TArray<FPluginNode>& Nodes, const FNsSpyglassContentResult* Content, FNsSpyglassUnusedResult& OutResult);
+
+    /** Format candidates as .uproject plugin entries that disable them. */
+    static FString MakeProjectPluginEntries(const FNsSpyglassUnusedResult& Result);
+
+    /** Sum the on-disk size of a plugin's module binaries. */
+    static int64 GetBinarySize(const IPlugin& Plugin);
+
+private:
+
+    /** Mark plugins whose modules are named by other modules' Build.cs or Target.cs files or descriptors. */
+    static void FindReferencedModules(const TArray<FPluginNode>& Nodes, TBitArray<>& OutReferenced);
+};
@@ -0,0 +1,148 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/** What a what-if scenario does to one plugin. */
+enum class ENsSpyglassWhatIfState : uint8
+{
+    /** Stays enabled and is still needed. */
+    Enabled,
+
+    /** Turned off by the user. */
+    Disabled,
+
+    /** Depends on a disabled plugin, directly or transitively, so it has to be disabled too. */
+    Broken,
+
+    /** Still loads, but every plugin that depended on it is gone. */
+    Orphaned
+};
+
+/** Plugin affected by a scenario. */
+struct FNsSpyglassWhatIfEntry
+{
+    /** Node index in the graph the scenario runs on. */
+    int32 Node = INDEX_NONE;
+
+    /** Plugin name as used in the .uproject Plugins array. */
+    FString Name;
+
+    ENsSpyglassWhatIfState State = ENsSpyglassWhatIfState::Enabled;
+
+    /** Number of modules the plugin declares. */
+    int32 NumModules = 0;
+
+    /** Size of the module binaries found on disk. */
+    int64 BinaryBytes = 0;
+};
+
+/** Outcome of a scenario, copied out for display and export. */
+struct FNsSpyglassWhatIfResult
+{
+    /** Disabled, broken and orphaned plugins in that order, largest savings first within each. */
+    TArray<FNsSpyglassWhatIfEntry> Entries;
+
+    /** Savings of the disabled and broken plugins, which the proposal turns off. */
+    int32 RemovedModules = 0;
+    int64 RemovedBytes = 0;
+
+    /** Further savings if the orphaned plugins were turned off as well. */
+    int32 OrphanedModules = 0;
+    int64 OrphanedBytes = 0;
+
+    /** Whether binary sizes were measured yet. Until then the byte counts are zero. */
+    bool bSizesKnown = false;
+};
+
+using FNsSpyglassWhatIfResultPtr = TSharedPtr<const FNsSpyglassWhatIfResult, ESPMode::ThreadSafe>;
+
+/**
+ * Incrementally evaluates disabling plugins.
+ * Works on the condensation of the dependency graph, since disabling any member of a cycle takes the whole cycle down.
+ * Every component counts its dependencies that are off and its dependents that are still needed. A toggle only
+ * walks the components whose state actually flips, so each change costs time proportional to what it affects
+ * rather than to the graph, and a running total of the savings is kept along the way.
+ */
+class FNsSpyglassWhatIf
+{
+
+// Functions
+public:
+
+    /** Start a scenario on the given nodes with everything enabled. */
+    void Initialize(const TArray<FPluginNode>& Nodes);
+
+    /** Measure the binaries of every node. Reads the disk, so it is meant for a worker thread. */
+    static void MeasureBinaries(const TArray<FPluginNode>& Nodes, TArray<int64>& OutBytes);
+
+    /** Use measured binary sizes, one per node, for the savings. */
+    void SetBinarySizes(const TArray<int64>& Bytes);
+
+    /** Disable or re-enable plugins and update every affected state. */
+    void SetDisabled(TConstArrayView<int32> NodeIndices, bool bDisabled);
+
+    /** Whether the user disabled the node. */
+    bool IsDisabled(int32 Node) const;
+
+    /** Current state of a node. */
+    ENsSpyglassWhatIfState GetState(int32 Node) const;
+
+    /** Number of nodes the user disabled. */
+    int32 GetNumDisabled() const { return NumDisabled; }
+
+    /** Copy the affected plugins and savings out. */
+    void MakeResult(FNsSpyglassWhatIfResult& OutResult) const;
+
+    /** Format the proposal as .uproject plugin entries that disable every disabled and broken plugin. */
+    static FString MakeProjectPluginEntries(const FNsSpyglassWhatIfResult& Result);
+
+private:
+
+    /** Whether a component is turned off, and whether it is still needed by an enabled plugin or the project. */
+    bool IsOff(int32 Component) const { return DisabledMembers[Component] > 0 || MissingDependencies[Component] > 0; }
+    bool IsKept(int32 Component) const { return !IsOff(Component) && !IsOrphaned(Component); }
+    bool IsOrphaned(int32 Component) const { return !IsOff(Component) && Dependents[Component].Num() > 0 && NeededBy[Component] == 0; }
+
+    /** Adjust the counters of the neighbours of components whose state flipped, until nothing flips anymore. */
+    void Propagate(TArray<int32>& Pending);
+
+// Variables
+private:
+
+    /** Per node data. */
+    TArray<FString> Names;
+    TArray<int32> ComponentOf;
+    TArray<int32> NodeModules;
+    TArray<int64> NodeBytes;
+    TBitArray<> Disabled;
+
+    /** Members and condensed edges of every component. */
+    TArray<TArray<int32>> Members;
+    TArray<TArray<int32>> Dependencies;
+    TArray<TArray<int32>> Dependents;
+
+    /** Module count and binary size of every component. */
+    TArray<int32> ComponentModules;
+    TArray<int64> ComponentBytes;
+
+    /** Disabled members, dependencies that are off, and dependents that are kept, per component. */
+    TArray<int32> DisabledMembers;
+    TArray<int32> MissingDependencies;
+    TArray<int32> NeededBy;
+
+    /** State of every component as last propagated. */
+    TBitArray<> OffState;
+    TBitArray<> KeptState;
+    TBitArray<> OrphanState;
+
+    /** Running totals. */
+    int32 NumDisabled = 0;
+    int32 RemovedModules = 0;
+    int64 RemovedBytes = 0;
+    int32 OrphanedModules = 0;
+    int64 OrphanedBytes = 0;
+    bool bSizesKnown = false;
+};
@@ -0,0 +1,28 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "NsSpyglassBudgetCommandlet.generated.h"
+
+/**
+ * Headless dependency budget gate for CI.
+ * Usage: UnrealEditor-Cmd <Project> -run=NsSpyglassBudget [-Report=<File.json>] -nullrhi -unattended
+ * Returns 0 when every budget in UNsSpyglassBudgetSettings holds, 1 when one is exceeded and 2 on errors.
+ */
+UCLASS()
+class UNsSpyglassBudgetCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+// Functions
+public:
+
+    /** Constructor */
+    UNsSpyglassBudgetCommandlet();
+
+    //~ Begin UCommandlet Interface
+    virtual int32 Main(const FString& Params) override;
+    //~ End UCommandlet Interface
+};
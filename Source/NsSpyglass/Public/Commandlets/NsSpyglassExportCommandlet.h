@@ -0,0 +1,27 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "NsSpyglassExportCommandlet.generated.h"
+
+/**
+ * Headless export of the plugin dependency graph.
+ * Usage: UnrealEditor-Cmd <Project> -run=NsSpyglassExport [-Output=<File.json>] [-FailOnCycles] [-Content] [-Snapshot=<File.nsgraph>]
+ */
+UCLASS()
+class UNsSpyglassExportCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+// Functions
+public:
+
+    /** Constructor */
+    UNsSpyglassExportCommandlet();
+
+    //~ Begin UCommandlet Interface
+    virtual int32 Main(const FString& Params) override;
+    //~ End UCommandlet Interface
+};
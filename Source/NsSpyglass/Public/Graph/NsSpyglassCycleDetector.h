@@ -0,0 +1,72 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/**
+ * Strongly connected components of the directed dependency graph.
+ * Only components with more than one node (or a self reference) are reported as cycles.
+ */
+struct FNsSpyglassCycleInfo
+{
+    /** Component id for every node. */
+    TArray<int32> ComponentOf;
+
+    /** Index into Cycles for every node, or INDEX_NONE when the node is not part of a cycle. */
+    TArray<int32> CycleOf;
+
+    /** Members of every non-trivial component. */
+    TArray<TArray<int32>> Cycles;
+
+    /** Number of components found, including trivial ones. */
+    int32 NumComponents = 0;
+
+    /** Clear all data and size the per-node arrays. */
+    void Reset(int32 NumNodes);
+
+    /** Cycle the given node belongs to, INDEX_NONE when none or when the node is out of range. */
+    int32 GetCycle(int32 Node) const
+    {
+        return CycleOf.IsValidIndex(Node) ? CycleOf[Node] : INDEX_NONE;
+    }
+
+    /** Whether the given node belongs to a cycle. */
+    bool IsInCycle(int32 Node) const
+    {
+        return GetCycle(Node) != INDEX_NONE;
+    }
+
+    /** Whether the directed edge From -> To closes a cycle. */
+    bool IsCyclicEdge(int32 From, int32 To) const
+    {
+        return IsInCycle(From) && CycleOf.IsValidIndex(To) && CycleOf[From] == CycleOf[To];
+    }
+};
+
+/**
+ * Linear-time cycle detection over FPluginNode::Dependencies.
+ * Uses an iterative Tarjan pass so deep module or asset graphs cannot overflow the call stack.
+ */
+class FNsSpyglassCycleDetector
+{
+
+// Functions
+public:
+
+    /** Compute all strongly connected components in O(V + E). */
+    static void Compute(const TArray<FPluginNode>& Nodes, FNsSpyglassCycleInfo& OutInfo);
+
+    /**
+     * Update components after the edge From -> To was added to Nodes.
+     * Only the nodes reachable from To are visited, so inserting edges into an acyclic region stays cheap.
+     * Returns true when the edge created or grew a cycle.
+     */
+    static bool AddEdge(const TArray<FPluginNode>& Nodes, int32 From, int32 To, FNsSpyglassCycleInfo& InOutInfo);
+
+private:
+
+    /** Remove a cycle entry and fix up the index of the entry swapped into its slot. */
+    static void RemoveCycle(FNsSpyglassCycleInfo& InOutInfo, int32 CycleIndex);
+};
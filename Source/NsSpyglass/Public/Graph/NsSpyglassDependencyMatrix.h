@@ -0,0 +1,93 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassCycleDetector.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/**
+ * Dependency structure matrix of the plugin graph.
+ * Rows and columns share one order: strongly connected components in topological order, dependencies first,
+ * with the members of a component kept together. A row has a mark in the column of every plugin it depends on,
+ * so acyclic dependencies all fall below the diagonal and only cycles, drawn as blocks on it, reach above.
+ * Marks are kept as a pyramid of sparse rows. Level L groups 2^L by 2^L cells into blocks that count the edges
+ * inside them, so a view can draw any zoom level by visiting only the blocks on screen.
+ */
+class FNsSpyglassDependencyMatrix
+{
+
+// Functions
+public:
+
+    /** Order the nodes and build every level. Pure function of its inputs, safe on any thread. */
+    void Build(const TArray<FPluginNode>& Nodes, const FNsSpyglassCycleInfo& CycleInfo);
+
+    /** Number of rows and columns. */
+    int32 Num() const { return Order.Num(); }
+
+    /** Node shown at a row or column, and the row or column of a node. */
+    int32 GetNode(const int32 Position) const { return Order[Position]; }
+    int32 GetPosition(const int32 Node) const { return PositionOf[Node]; }
+
+    /** First position and size of every component with more than one member, in position order. */
+    const TArray<FIntPoint>& GetCycleBlocks() const { return CycleBlocks; }
+
+    /** Number of levels. The last one has a single block. */
+    int32 GetNumLevels() const { return Levels.Num(); }
+
+    /** Largest edge count of one block of a level. */
+    int32 GetMaxCount(const int32 Level) const { return Levels[Level].MaxCount; }
+
+    /** Whether the plugin at Row depends on the plugin at Column. */
+    bool HasEdge(int32 Row, int32 Column) const;
+
+    /**
+     * Visit the non-empty blocks of a level inside a range of block rows and block columns, ends exclusive.
+     * Visit receives the block row, block column and edge count. Cost is proportional to the blocks in range.
+     */
+    template <typename FunctorType>
+    void ForEachBlock(const int32 Level, const int32 RowBegin, const int32 RowEnd, const int32 ColumnBegin, const int32 ColumnEnd, FunctorType&& Visit) const
+    {
+        const FLevel& Blocks = Levels[Level];
+        const int32 NumRows = Blocks.RowStart.Num() - 1;
+        for (int32 Row = FMath::Max(RowBegin, 0); Row < FMath::Min(RowEnd, NumRows); ++Row)
+        {
+            const int32* First = Blocks.Columns.GetData() + Blocks.RowStart[Row];
+            const int32* Last = Blocks.Columns.GetData() + Blocks.RowStart[Row + 1];
+            for (const int32* Column = LowerBound(First, Last, ColumnBegin); Column != Last && *Column < ColumnEnd; ++Column)
+            {
+                Visit(Row, *Column, Blocks.Counts[Column - Blocks.Columns.GetData()]);
+            }
+        }
+    }
+
+private:
+
+    /** First entry of a sorted range not less than Value. */
+    static const int32* LowerBound(const int32* First, const int32* Last, int32 Value);
+
+// Variables
+private:
+
+    /** Sparse rows of one level, stored as offsets into shared column and count arrays. */
+    struct FLevel
+    {
+        TArray<int32> RowStart;
+        TArray<int32> Columns;
+        TArray<int32> Counts;
+        int32 MaxCount = 0;
+    };
+
+    /** Node per position and position per node. */
+    TArray<int32> Order;
+    TArray<int32> PositionOf;
+
+    /** Diagonal blocks of cycles. */
+    TArray<FIntPoint> CycleBlocks;
+
+    /** Level 0 holds single cells, every further level halves the rows and columns. */
+    TArray<FLevel> Levels;
+};
+
+using FNsSpyglassDependencyMatrixPtr = TSharedPtr<const FNsSpyglassDependencyMatrix, ESPMode::ThreadSafe>;
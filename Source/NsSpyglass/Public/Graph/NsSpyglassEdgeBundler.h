@@ -0,0 +1,37 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Edges subdivided into bundled polylines. */
+struct FNsSpyglassEdgeBundles
+{
+    /** Polyline of every edge, PointsPerEdge consecutive points each, in graph space. */
+    TArray<FVector2D> Points;
+
+    /** Points per polyline, endpoints included. */
+    int32 PointsPerEdge = 0;
+
+    /** Source (X) and target (Y) node of every polyline. */
+    TArray<FIntPoint> Edges;
+
+    /** Seconds spent bundling. */
+    double BundleSeconds = 0.0;
+};
+
+/**
+ * Force-directed edge bundling (Holten and van Wijk, 2009).
+ * Every edge becomes a chain of subdivision points held together by springs and attracted to the matching points
+ * of compatible edges, i.e. edges of similar angle, length and position. Subdivisions double over a few cycles
+ * while the step size shrinks. The edges are independent within an iteration and are processed in parallel.
+ */
+class FNsSpyglassEdgeBundler
+{
+
+// Functions
+public:
+
+    /** Bundle the given edges between the given node positions. Pure function, safe on any thread. */
+    static void Compute(const TArray<FVector2D>& Positions, const TArray<FIntPoint>& Edges, FNsSpyglassEdgeBundles& OutBundles);
+};
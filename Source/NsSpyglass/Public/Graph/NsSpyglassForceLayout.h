@@ -0,0 +1,41 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/** Parameters of one ForceAtlas2 step. */
+struct FNsSpyglassForceParams
+{
+    /** Pairwise repulsion, already scaled for the view. */
+    float Repulsion = 0.f;
+
+    /** Pull toward the origin. */
+    float Gravity = 0.f;
+
+    /** Spring strength of stretched edges. */
+    float EdgeStrength = 1.f;
+
+    /** Time scale of the integration. Raised while the user drags a node. */
+    float SimSpeed = 40.f;
+};
+
+/**
+ * Force-directed layout shared by the graph subsystem and views that lay out a private node set.
+ */
+class FNsSpyglassForceLayout
+{
+
+// Functions
+public:
+
+    /**
+     * Advance the layout by one step. Only nodes in Active take part, ActiveMask holds the same set.
+     * The root and fixed nodes push and pull others but do not move.
+     */
+    static void Step(TArray<FPluginNode>& Nodes, TConstArrayView<int32> Active, const TBitArray<>& ActiveMask, int32 RootIndex, const FNsSpyglassForceParams& Params, float DeltaTime);
+
+    /** Clamp a vector to a maximum length. */
+    static FVector2D ClampToMaxSize2D(const FVector2D& V, float MaxSize);
+};
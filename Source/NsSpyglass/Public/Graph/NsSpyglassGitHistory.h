@@ -0,0 +1,116 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/** Kind of change recorded by FNsSpyglassHistory. */
+enum class ENsSpyglassHistoryOp : uint8
+{
+    AddNode,
+    RemoveNode,
+    AddEdge,
+    RemoveEdge
+};
+
+/** One commit of a loaded history. */
+struct FNsSpyglassHistoryCommit
+{
+    /** Full hexadecimal commit id. */
+    FString Hash;
+
+    /** First line of the message. */
+    FString Summary;
+
+    /** Author name. */
+    FString Author;
+
+    /** Commit time. */
+    FDateTime Time;
+};
+
+/**
+ * Plugin graph over a range of commits, stored as deltas.
+ * Every plugin seen anywhere in the range gets one node id. Commit 0 holds the ops that build its graph from
+ * nothing, every later commit only the ops that turn its parent's graph into its own. Ops are packed into one
+ * 64-bit word each, so a history of thousands of commits weighs little more than the changes it records.
+ */
+struct FNsSpyglassHistory
+{
+    /** Plugin name per node id. */
+    TArray<FString> NodeNames;
+
+    /** Per node id, whether a descriptor of the plugin lives in the repository, rather than only references to it. */
+    TBitArray<> IsLocal;
+
+    /** Commits, oldest first. */
+    TArray<FNsSpyglassHistoryCommit> Commits;
+
+    /** Ops of commit i are Ops[OpStart[i] .. OpStart[i + 1]). Node ops come before edge ops, node removals last. */
+    TArray<int32> OpStart;
+    TArray<uint64> Ops;
+
+    /** Repository the history was read from. */
+    FString RepositoryDir;
+
+    /** Descriptor blobs parsed, every other one was a repeat of a blob seen before. */
+    int32 NumParsedBlobs = 0;
+
+    /** Wall time spent loading. */
+    double LoadSeconds = 0.0;
+
+    /** Ops of one commit. */
+    TConstArrayView<uint64> GetOps(const int32 Commit) const
+    {
+        return TConstArrayView<uint64>(Ops.GetData() + OpStart[Commit], OpStart[Commit + 1] - OpStart[Commit]);
+    }
+
+    /** Pack and unpack an op. Node ops leave To unused. */
+    static uint64 PackOp(ENsSpyglassHistoryOp Type, int32 From, int32 To = 0)
+    {
+        return (static_cast<uint64>(Type) << 62) | (static_cast<uint64>(static_cast<uint32>(From) & 0x7fffffff) << 31) | (static_cast<uint32>(To) & 0x7fffffff);
+    }
+
+    static ENsSpyglassHistoryOp GetOpType(const uint64 Op) { return static_cast<ENsSpyglassHistoryOp>(Op >> 62); }
+    static int32 GetOpFrom(const uint64 Op) { return static_cast<int32>((Op >> 31) & 0x7fffffff); }
+    static int32 GetOpTo(const uint64 Op) { return static_cast<int32>(Op & 0x7fffffff); }
+};
+
+using FNsSpyglassHistoryPtr = TSharedPtr<const FNsSpyglassHistory, ESPMode::ThreadSafe>;
+
+/**
+ * Reads the plugin graph history of a repository straight from its git object store, without a checkout.
+ * Loose objects and pack files are both read, packs through memory-mapped indexes with delta chains resolved
+ * against a cache of recent bases. The first-parent chain is walked oldest first and each commit's tree is diffed
+ * against its parent's, descending only into subtrees whose id changed, so a commit that touched no descriptor
+ * costs a handful of tree reads. .uplugin and .uproject blobs are parsed once per blob id.
+ */
+class FNsSpyglassGitHistory
+{
+
+// Functions
+public:
+
+    /** What to load. */
+    struct FParams
+    {
+        /** Directory inside the working tree, or the .git directory itself. */
+        FString RepositoryDir;
+
+        /** Oldest commit to include, empty to go back as far as MaxCommits allows. */
+        FString FromRevision;
+
+        /** Newest commit. A full id or a name under refs/, e.g. HEAD, a branch or a tag. */
+        FString ToRevision = TEXT("HEAD");
+
+        /** Upper bound on the commits walked. */
+        int32 MaxCommits = 5000;
+    };
+
+    /**
+     * Load a history. Safe on any thread. Returns false and fills OutError when the repository or a revision
+     * cannot be read. Progress counts commits walked, Cancel stops early with an error.
+     */
+    static bool Load(const FParams& Params, FNsSpyglassHistory& OutHistory, FString& OutError, std::atomic<int32>* Progress = nullptr, const std::atomic<bool>* Cancel = nullptr);
+};
@@ -0,0 +1,23 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/**
+ * Builds the plugin dependency graph from the plugin manager.
+ * Shared by the graph widget and the headless commandlets so both see the same nodes and edges.
+ */
+class FNsSpyglassGraphBuilder
+{
+
+// Functions
+public:
+
+    /** Populate OutNodes with one node per enabled plugin and fill in links, dependencies and dependents. */
+    static void BuildPluginNodes(TArray<FPluginNode>& OutNodes);
+
+    /** Same for a given plugin list. Only reads the descriptors, so it may run on any thread. */
+    static void BuildPluginNodes(const TArray<TSharedRef<IPlugin>>& Plugins, TArray<FPluginNode>& OutNodes);
+};
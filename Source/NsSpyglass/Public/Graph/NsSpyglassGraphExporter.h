@@ -0,0 +1,26 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+struct FNsSpyglassContentResult;
+struct FNsSpyglassCycleInfo;
+
+/**
+ * Serializes the dependency graph and its analysis results to JSON.
+ * Used by the export commandlet so the same data is available outside the editor UI.
+ */
+class FNsSpyglassGraphExporter
+{
+
+// Functions
+public:
+
+    /** Write nodes, directed edges, detected cycles and optional content references as a JSON document. */
+    static FString ToJson(const TArray<FPluginNode>& Nodes, const FNsSpyglassCycleInfo& CycleInfo, const FNsSpyglassContentResult* Content = nullptr);
+
+    /** Write the JSON document to disk. Returns false when the file could not be saved. */
+    static bool SaveJson(const FString& FilePath, const TArray<FPluginNode>& Nodes, const FNsSpyglassCycleInfo& CycleInfo, const FNsSpyglassContentResult* Content = nullptr);
+};
@@ -0,0 +1,110 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+#include "Graph/NsSpyglassReachability.h"
+
+/** Edge direction followed by neighbourhood queries. */
+enum class ENsSpyglassQueryDirection : uint8
+{
+    /** Follow dependencies. */
+    Down,
+
+    /** Follow dependents. */
+    Up,
+
+    /** Follow both. */
+    Both
+};
+
+/**
+ * Read-only queries over one plugin graph.
+ * Adjacency is flattened into CSR arrays and the transitive closure is computed up front,
+ * so reachability answers in O(1) and path searches only expand nodes that can still reach the target.
+ */
+class FNsSpyglassGraphQuery
+{
+
+// Functions
+public:
+
+    /** Index the given nodes. The query keeps no reference to them. */
+    explicit FNsSpyglassGraphQuery(const TArray<FPluginNode>& Nodes);
+
+    /** Number of indexed nodes. */
+    int32 NumNodes() const { return Names.Num(); }
+
+    /** Node name. */
+    const FString& GetName(int32 Node) const { return Names[Node]; }
+
+    /** Node index by plugin name, case insensitive. INDEX_NONE when unknown. */
+    int32 FindNode(const FString& Name) const;
+
+    /** Whether From depends on To, directly or transitively. */
+    bool DependsOn(int32 From, int32 To) const { return Reachability.DependsOn(From, To); }
+
+    /** Shortest dependency chain From -> ... -> To. Returns false when To is not a dependency of From. */
+    bool FindShortestPath(int32 From, int32 To, TArray<int32>& OutPath) const;
+
+    /**
+     * Simple dependency chains From -> ... -> To, shortest first.
+     * Chains are enumerated one length at a time, so the first MaxPaths returned are the shortest ones. The search
+     * stops after MaxPaths chains or MaxVisits node expansions, whichever comes first, and returns the number found.
+     */
+    int32 FindAllPaths(int32 From, int32 To, int32 MaxPaths, TArray<TArray<int32>>& OutPaths, int32 MaxVisits = 1000000) const;
+
+    /** Nodes within K edges of Node, excluding Node itself, ordered by distance. OutDistances receives the hop count of each. */
+    void GetNeighbourhood(int32 Node, int32 K, ENsSpyglassQueryDirection Direction, TArray<int32>& OutNodes, TArray<int32>* OutDistances = nullptr) const;
+
+    /** Every plugin that depends on Node, directly or transitively. */
+    void GetTransitiveDependents(int32 Node, TArray<int32>& OutNodes) const;
+
+    /** Number of plugins Node depends on, directly or transitively. */
+    int32 GetTransitiveDependencyCount(int32 Node) const { return Reachability.TransitiveDependencies[Node]; }
+
+    /** Number of plugins that depend on Node, directly or transitively. */
+    int32 GetTransitiveDependentCount(int32 Node) const { return Reachability.TransitiveDependents[Node]; }
+
+    /** Nodes ordered so dependencies come before their dependents. Members of a cycle are adjacent. */
+    const TArray<int32>& GetTopologicalOrder() const { return TopologicalOrder; }
+
+    /** Closure the query was built on. */
+    const FNsSpyglassReachability& GetReachability() const { return Reachability; }
+
+    /** Shared query over the enabled plugins. In the editor this is the graph subsystem's query, elsewhere it is rebuilt when the plugin set changes. */
+    static TSharedRef<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> GetLive();
+
+    /** Drop the shared query so the next GetLive rebuilds it. */
+    static void InvalidateLive();
+
+private:
+
+    /** Outgoing or incoming CSR row of a node. */
+    TConstArrayView<int32> GetRow(const TArray<int32>& Offsets, const TArray<int32>& Columns, int32 Node) const
+    {
+        return TConstArrayView<int32>(Columns.GetData() + Offsets[Node], Offsets[Node + 1] - Offsets[Node]);
+    }
+
+// Variables
+private:
+
+    /** Node names and a lookup by name. */
+    TArray<FString> Names;
+    TMap<FString, int32> NameToNode;
+
+    /** Dependencies in CSR form. */
+    TArray<int32> DependencyOffsets;
+    TArray<int32> DependencyColumns;
+
+    /** Dependents in CSR form. */
+    TArray<int32> DependentOffsets;
+    TArray<int32> DependentColumns;
+
+    /** Transitive closure and per node counts. */
+    FNsSpyglassReachability Reachability;
+
+    /** Dependencies first. */
+    TArray<int32> TopologicalOrder;
+};
@@ -0,0 +1,163 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorSubsystem.h"
+#include "Graph/NsSpyglassCycleDetector.h"
+#include "Graph/NsSpyglassForceLayout.h"
+#include "Graph/NsSpyglassGraphQuery.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+#include "TickableEditorObject.h"
+#include "NsSpyglassGraphSubsystem.generated.h"
+
+/** One build of the plugin graph. Never modified after it is published, so any thread may read it. */
+struct FNsSpyglassGraphModel
+{
+    /** Nodes with links, dependencies and their position at build time. */
+    TArray<FPluginNode> Nodes;
+
+    /** Strongly connected components of the nodes. */
+    FNsSpyglassCycleInfo CycleInfo;
+
+    /** Query index over the nodes. */
+    TSharedPtr<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query;
+
+    /** Hash of the node names, used to validate cached analysis results. */
+    uint32 PluginSetHash = 0;
+
+    /** Increases with every published model, batches included. */
+    uint32 Version = 0;
+
+    /** Build the model belongs to. Later batches of one build keep the node order and only add nodes. */
+    uint32 BuildId = 0;
+
+    /** Whether this is the last batch of its build and holds every plugin. */
+    bool bComplete = false;
+};
+
+/** Node positions after one simulation step. */
+struct FNsSpyglassGraphLayout
+{
+    /** Position per node of the model the layout was computed for. */
+    TArray<FVector2D> Positions;
+
+    /** Version of that model. */
+    uint32 ModelVersion = 0;
+};
+
+using FNsSpyglassGraphModelRef = TSharedRef<const FNsSpyglassGraphModel, ESPMode::ThreadSafe>;
+using FNsSpyglassGraphLayoutRef = TSharedRef<const FNsSpyglassGraphLayout, ESPMode::ThreadSafe>;
+
+/**
+ * Owns the plugin graph and its layout for the whole editor.
+ * The graph is built once and simulated once no matter how many views or tools read it. Both are published as
+ * immutable snapshots: a reader takes a reference and keeps a consistent view for as long as it holds it, while
+ * updates build a new snapshot and swap it in. Layout buffers are recycled once no reader holds them anymore.
+ * Builds run on a worker and arrive in batches of doubling size, most connected plugins first. Every batch is a
+ * complete model of its nodes, so the layout starts simulating the first ones while the rest are still built.
+ */
+UCLASS()
+class UNsSpyglassGraphSubsystem : public UEditorSubsystem, public FTickableEditorObject
+{
+    GENERATED_BODY()
+
+// Functions
+public:
+
+    /** Subsystem of the running editor. */
+    static UNsSpyglassGraphSubsystem& Get();
+
+    //~ Begin UEditorSubsystem Interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    //~ End UEditorSubsystem Interface
+
+    /** Current graph. Safe to call from any thread. */
+    FNsSpyglassGraphModelRef GetModel() const;
+
+    /** Current layout. Safe to call from any thread. Positions match GetModel() when the versions agree. */
+    FNsSpyglassGraphLayoutRef GetLayout() const;
+
+    /** Scan the plugins again on a worker and publish the new graph batch by batch. */
+    void Rebuild();
+
+    /** Whether the latest build is still publishing batches. */
+    bool IsBuilding() const;
+
+    /**
+     * Smallest batch of the current build with more than NumNodes nodes, the current model when there is none.
+     * Readers still on an older build get the first batch of the current one. Game thread only.
+     */
+    FNsSpyglassGraphModelRef GetNextBatch(uint32 BuildId, int32 NumNodes) const;
+
+    /** Fired on the game thread after a new model was published. */
+    FSimpleMulticastDelegate& OnModelChanged() { return ModelChanged; }
+
+    /** Views register while open, the layout is only simulated while at least one is. */
+    void AddViewer();
+    void RemoveViewer();
+
+    /** Move a node and hold it in place while pinned. Used while a view drags the node. */
+    void SetNodePinned(int32 NodeIndex, const FVector2D& Position, bool bPinned);
+
+    /** Push overlapping nodes apart now and publish the result. */
+    void RemoveOverlaps();
+
+    //~ Begin FTickableEditorObject Interface
+    virtual void Tick(float DeltaTime) override;
+    virtual bool IsTickable() const override { return NumViewers > 0; }
+    virtual TStatId GetStatId() const override;
+    //~ End FTickableEditorObject Interface
+
+private:
+
+    /** Copy the simulated positions into a layout snapshot and publish it. */
+    void PublishLayout();
+
+    /** Place the nodes a batch added, measure them and publish the batch as the current model. */
+    void PublishBatch(const TSharedRef<FNsSpyglassGraphModel, ESPMode::ThreadSafe>& NewModel);
+
+// Variables
+private:
+
+    /** Guards the published references only. Readers hold it just long enough to copy one. */
+    mutable FRWLock SnapshotLock;
+
+    /** Published snapshots. */
+    TSharedPtr<const FNsSpyglassGraphModel, ESPMode::ThreadSafe> Model;
+    TSharedPtr<FNsSpyglassGraphLayout, ESPMode::ThreadSafe> Layout;
+
+    /** Every batch of the current build so far, smallest first. Lets a view opened late catch up gradually. */
+    TArray<FNsSpyglassGraphModelRef> Batches;
+
+    /** Previously published layout, reused for the next step once readers released it. */
+    TSharedPtr<FNsSpyglassGraphLayout, ESPMode::ThreadSafe> SpareLayout;
+
+    /** Working copy of the nodes stepped by the solver. Game thread only. */
+    TArray<FPluginNode> SimNodes;
+
+    /** Every node index, and the same set as a mask, passed to the solver. */
+    TArray<int32> SimOrder;
+    TBitArray<> SimMask;
+
+    /** Whether the simulation settled and stopped stepping, and for how long nodes have been slow. */
+    bool bSettled = false;
+    float SettleTime = 0.f;
+
+    /** Forces of the last step. Changing them wakes a settled simulation. */
+    FNsSpyglassForceParams LastParams;
+
+    /** Number of open views and of nodes currently held by one. */
+    int32 NumViewers = 0;
+    int32 NumPinned = 0;
+
+    /** Version assigned to the next model. */
+    uint32 NextVersion = 1;
+
+    /** Id of the latest build. Batches of older builds are dropped when they arrive. */
+    uint32 BuildGeneration = 0;
+
+    /** Model change notification. */
+    FSimpleMulticastDelegate ModelChanged;
+};
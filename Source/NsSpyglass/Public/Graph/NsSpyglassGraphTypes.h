@@ -0,0 +1,47 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IPluginManager.h"
+
+/**
+ * Node information used by the force-directed graph
+ */
+struct FPluginNode
+{
+    /** Display name of the plugin. */
+    FString Name;
+
+    /** Current position relative to the center of the view. */
+    FVector2D Position = FVector2D::ZeroVector;
+
+    /** Indices of linked plugins used by the layout. */
+    TArray<int32> Links;
+
+    /** Directed dependencies for this plugin. */
+    TArray<int32> Dependencies;
+
+    /** Plugins that directly depend on this one. */
+    TArray<int32> Dependents;
+
+    /** Whether this plugin comes from the engine. */
+    bool bIsEngine = false;
+
+    /** Color assigned to this node's group. */
+    FLinearColor Color = FLinearColor(1.f, 1.f, 1.f, 0.1f);
+
+    /** When true, the node will remain stationary during simulation. */
+    bool bFixed = false;
+
+    /** Node velocity */
+    FVector2D Velocity = FVector2D::ZeroVector;
+
+    // Intro animation
+    bool  bActive = true;         // participates in solver + rendering
+    float AppearDelay = 0.f;      // seconds before appearing
+    float AppearAlpha = 1.f;      // 0..1 fade value
+
+    /** Plugin reference used for detailed information. */
+    TSharedPtr<IPlugin> Plugin;
+};
@@ -0,0 +1,25 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/**
+ * Layered (Sugiyama) layout of the dependency graph.
+ * Cycles are broken by dropping DFS back edges, layers follow the longest dependency chain so plugins sit below
+ * everything they depend on, edges spanning several layers are routed through dummy vertices, barycenter sweeps
+ * reduce crossings and a final pass centers every vertex over its neighbours without overlaps.
+ */
+class FNsSpyglassLayeredLayout
+{
+
+// Functions
+public:
+
+    /**
+     * Lay out the nodes listed in Subset, ignoring edges to nodes outside it.
+     * OutPositions is sized like Nodes, only entries of Subset are written. Pure function, safe on any thread.
+     */
+    static void Compute(const TArray<FPluginNode>& Nodes, const TArray<int32>& Subset, TArray<FVector2D>& OutPositions);
+};
@@ -0,0 +1,26 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/**
+ * Removes overlaps between node boxes after a layout settled.
+ * The graph view scales labels down to fit inside their node, so every box is the node circle plus a margin.
+ * Boxes are bucketed into a uniform grid of their size, so each node is only tested against the nodes of its own
+ * and adjacent cells. Overlapping pairs are pushed apart along the axis that needs the smaller move,
+ * and the pass repeats until no overlap is left. With bounded density every pass is linear in the node count.
+ */
+class FNsSpyglassOverlapRemoval
+{
+
+// Functions
+public:
+
+    /**
+     * Separate the nodes in Subset. Fixed nodes and the root stay in place.
+     * Returns the number of overlaps left after MaxIterations passes, zero on success.
+     */
+    static int32 Resolve(TArray<FPluginNode>& Nodes, TConstArrayView<int32> Subset, int32 RootIndex, int32 MaxIterations = 32);
+};
@@ -0,0 +1,27 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/**
+ * Radial layout around a root plugin.
+ * A breadth-first search from the root puts every plugin on the ring of its hop distance. Each ring is ordered by
+ * the mean direction of its parents on the ring inside it, which keeps subtrees together and edges short, and is
+ * then spread evenly around the circle. Positions are computed directly in linear time plus a sort per ring,
+ * so even huge graphs lay out instantly without a simulation.
+ */
+class FNsSpyglassRadialLayout
+{
+
+// Functions
+public:
+
+    /**
+     * Lay out the nodes listed in Subset around Root, following dependencies, dependents or both.
+     * Nodes of the subset the search does not reach go on one more ring outside the others.
+     * OutPositions is sized like Nodes, only entries of Subset are written. Pure function, safe on any thread.
+     */
+    static void Compute(const TArray<FPluginNode>& Nodes, const TArray<int32>& Subset, int32 Root, bool bDependencies, bool bDependents, TArray<FVector2D>& OutPositions);
+};
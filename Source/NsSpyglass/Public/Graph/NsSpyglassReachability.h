@@ -0,0 +1,38 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassCycleDetector.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/**
+ * Transitive closure of the dependency graph, computed once over the condensation DAG.
+ * Reach sets are stored per component as bit arrays, so the closure costs O(C * V / 32) words.
+ */
+struct FNsSpyglassReachability
+{
+    /** Components the closure was built on. Ids are in reverse topological order. */
+    FNsSpyglassCycleInfo Components;
+
+    /** Nodes reachable from every component. Cyclic components include their own members. */
+    TArray<TBitArray<>> ComponentReach;
+
+    /** Number of plugins each node depends on, directly or transitively. */
+    TArray<int32> TransitiveDependencies;
+
+    /** Number of plugins that depend on each node, directly or transitively. */
+    TArray<int32> TransitiveDependents;
+
+    /** Length of the longest dependency chain starting at each node. */
+    TArray<int32> Depth;
+
+    /** Build the closure for the given nodes. */
+    static void Compute(const TArray<FPluginNode>& Nodes, FNsSpyglassReachability& OutReachability);
+
+    /** Whether From depends on To, directly or transitively. */
+    bool DependsOn(int32 From, int32 To) const;
+
+    /** Longest dependency chain in the graph. */
+    int32 GetMaxDepth() const;
+};
@@ -0,0 +1,52 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/**
+ * Case insensitive substring search over plugin metadata.
+ * Names, friendly names, categories, authors and module names are indexed by every substring of up to three
+ * characters. Short terms are answered by a single posting list, longer ones intersect their trigrams and confirm
+ * the few remaining candidates with a substring check.
+ */
+class FNsSpyglassSearchIndex
+{
+
+// Functions
+public:
+
+    /** Index the given nodes, replacing any previous content. */
+    void Build(const TArray<FPluginNode>& Nodes);
+
+    /** Number of indexed nodes. */
+    int32 NumNodes() const { return Documents.Num(); }
+
+    /**
+     * Nodes matching every whitespace separated term of the query. An empty query matches everything.
+     * When the query extends the previous one only the previous matches are checked, so typing stays incremental.
+     */
+    void Search(const FString& Query, TBitArray<>& OutMatches);
+
+private:
+
+    /** Pack up to three lowercase characters into a posting key. */
+    static uint64 MakeGramKey(const TCHAR* Chars, int32 Len);
+
+    /** Keep only the nodes in OutMatches that contain the lowercase term. */
+    void FilterByTerm(const FString& Term, TBitArray<>& InOutMatches) const;
+
+// Variables
+private:
+
+    /** Lowercase searchable text per node, fields separated by a newline. */
+    TArray<FString> Documents;
+
+    /** Sorted node lists per one, two and three character substring. */
+    TMap<uint64, TArray<int32>> Grams;
+
+    /** Last query and its result, reused while the user keeps typing. */
+    FString LastQuery;
+    TBitArray<> LastMatches;
+};
@@ -0,0 +1,109 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+/** Build target a shipping view is evaluated for. */
+enum class ENsSpyglassShipTarget : uint8
+{
+    Game,
+    Client,
+    Server,
+    Editor,
+
+    Num
+};
+
+/** Plugins and modules that ship for one target and platform. */
+struct FNsSpyglassShippingResult
+{
+    /** Per node, whether the plugin ships. */
+    TBitArray<> Ships;
+
+    /** Shipping plugins, and how many of them are only there because a shipping plugin depends on them. */
+    int32 NumPlugins = 0;
+    int32 NumPulledIn = 0;
+
+    /** Modules compiled into the target, and how many of them are only loaded on demand. */
+    int32 NumModules = 0;
+    int32 NumOnDemandModules = 0;
+};
+
+/**
+ * Works out which plugins a target ships on a platform.
+ * A plugin ships when the project enables it for the target and platform, or when a shipping plugin depends on it
+ * through a reference enabled for both, and it supports the platform and has a module compiled into the target or
+ * is content only. Module host types, target and platform lists are evaluated against every target and known
+ * platform once when the nodes change, so switching the view only combines bit masks and walks the references.
+ */
+class FNsSpyglassShippingFilter
+{
+
+// Functions
+public:
+
+    /** UBT names of the platforms offered for the view. */
+    static const TArray<FString>& GetKnownPlatforms();
+
+    /** Display name of a target. */
+    static const TCHAR* GetTargetName(ENsSpyglassShipTarget Target);
+
+    /** Index the given nodes, replacing any previous content. */
+    void Build(const TArray<FPluginNode>& Nodes);
+
+    /** Number of indexed nodes. */
+    int32 NumNodes() const { return NodePlatforms.Num(); }
+
+    /** Evaluate the view for a target and a platform by UBT name. */
+    void Evaluate(ENsSpyglassShipTarget Target, const FString& Platform, FNsSpyglassShippingResult& OutResult) const;
+
+private:
+
+    static constexpr int32 NumTargets = static_cast<int32>(ENsSpyglassShipTarget::Num);
+
+    /** Platforms per target, one bit per entry of Platforms. */
+    using FTargetMasks = TStaticArray<uint64, NumTargets>;
+
+    /** Module compiled into a plugin. */
+    struct FModuleEntry
+    {
+        int32 Node = INDEX_NONE;
+
+        /** Whether the module has no loading phase and is only loaded on demand. */
+        bool bOnDemand = false;
+
+        /** Platforms the module is compiled on, per target. */
+        FTargetMasks CompiledOn;
+    };
+
+    /** Dependency reference between two plugins. */
+    struct FReferenceEntry
+    {
+        int32 To = INDEX_NONE;
+
+        /** Platforms the reference is enabled on, per target. */
+        FTargetMasks EnabledOn;
+    };
+
+// Variables
+private:
+
+    /** Platforms the masks are built for, the known ones first. At most 64. */
+    TArray<FString> Platforms;
+
+    /** Per node, platforms the plugin supports and platforms the project enables it on per target. */
+    TArray<uint64> NodePlatforms;
+    TArray<FTargetMasks> ProjectEnabledOn;
+
+    /** Per node, whether the plugin has no modules but may hold content. */
+    TBitArray<> ContentOnly;
+
+    /** Modules of every node. */
+    TArray<FModuleEntry> Modules;
+
+    /** References of every node, ReferenceOffsets[i] to ReferenceOffsets[i + 1]. */
+    TArray<FReferenceEntry> References;
+    TArray<int32> ReferenceOffsets;
+};
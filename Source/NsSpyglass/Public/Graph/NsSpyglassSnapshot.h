@@ -0,0 +1,173 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/** Change of a node or edge between two snapshots. */
+enum class ENsSpyglassDiffState : uint8
+{
+    Unchanged,
+    Added,
+    Removed,
+    Changed
+};
+
+/** Bits of FNsSpyglassSnapshotNode::Flags. */
+enum class ENsSpyglassSnapshotNodeFlags : uint32
+{
+    None = 0,
+    Engine = 1 << 0,
+    Cyclic = 1 << 1
+};
+ENUM_CLASS_FLAGS(ENsSpyglassSnapshotNodeFlags);
+
+/** Fixed size node record stored in a snapshot. */
+struct FNsSpyglassSnapshotNode
+{
+    /** String table ids. */
+    uint32 NameId = 0;
+    uint32 CategoryId = 0;
+    uint32 VersionNameId = 0;
+
+    /** ENsSpyglassSnapshotNodeFlags. */
+    uint32 Flags = 0;
+
+    /** Number of modules declared by the plugin. */
+    uint32 NumModules = 0;
+
+    /** Layout position when the snapshot was taken. */
+    float X = 0.f;
+    float Y = 0.f;
+
+    /** Keeps records 32 bytes wide. */
+    uint32 Reserved = 0;
+};
+
+/**
+ * Read-only view of a snapshot file.
+ * The file is memory mapped when the platform supports it, so opening is independent of its size.
+ */
+class FNsSpyglassSnapshotView
+{
+
+// Functions
+public:
+
+    /** Constructor */
+    FNsSpyglassSnapshotView();
+
+    /** Destructor */
+    ~FNsSpyglassSnapshotView();
+
+    /** Map a snapshot file. Returns false and fills OutError when the file is missing or malformed. */
+    bool Open(const FString& FilePath, FString& OutError);
+
+    /** Take ownership of snapshot bytes held in memory, for example inside a recorded session. */
+    bool OpenMemory(TArray64<uint8>&& Bytes, FString& OutError);
+
+    /** Whether a valid snapshot is mapped. */
+    bool IsValid() const { return Data != nullptr; }
+
+    /** Number of nodes. */
+    int32 NumNodes() const;
+
+    /** Number of directed edges. */
+    int32 NumEdges() const;
+
+    /** Node record. */
+    const FNsSpyglassSnapshotNode& GetNode(int32 Index) const;
+
+    /** Dependencies of a node as a CSR row. */
+    TConstArrayView<uint32> GetDependencies(int32 Index) const;
+
+    /** Interned string as UTF-8. */
+    FUtf8StringView GetString(uint32 StringId) const;
+
+    /** Convenience accessor for a node name. */
+    FString GetNodeName(int32 Index) const;
+
+private:
+
+    /** Validate the header and resolve section pointers. */
+    bool Parse(FString& OutError);
+
+// Variables
+private:
+
+    /** Mapped file, when supported. */
+    TUniquePtr<IMappedFileHandle> MappedHandle;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+
+    /** File contents when mapping is not available. */
+    TArray64<uint8> FallbackData;
+
+    /** Start and size of the snapshot bytes. */
+    const uint8* Data = nullptr;
+    int64 DataSize = 0;
+
+    /** Section pointers into Data. */
+    const FNsSpyglassSnapshotNode* NodeRecords = nullptr;
+    const uint32* RowOffsets = nullptr;
+    const uint32* Columns = nullptr;
+    const uint32* StringOffsets = nullptr;
+    const UTF8CHAR* StringData = nullptr;
+    uint32 NumStrings = 0;
+};
+
+/** Union of two snapshots annotated with what changed. */
+struct FNsSpyglassGraphDiff
+{
+    /** Nodes of both snapshots, positioned from the newer one where possible. */
+    TArray<FPluginNode> Nodes;
+
+    /** Change state per node. */
+    TArray<ENsSpyglassDiffState> NodeStates;
+
+    /** Change state of edges that were added or removed, keyed by (From << 32) | To. */
+    TMap<uint64, ENsSpyglassDiffState> EdgeStates;
+
+    /** Summary counts. */
+    int32 NumAddedNodes = 0;
+    int32 NumRemovedNodes = 0;
+    int32 NumChangedNodes = 0;
+    int32 NumAddedEdges = 0;
+    int32 NumRemovedEdges = 0;
+
+    /** Time spent diffing. */
+    double DiffSeconds = 0.0;
+
+    /** Edge lookup helper. */
+    ENsSpyglassDiffState GetEdgeState(int32 From, int32 To) const;
+};
+
+/**
+ * Compact versioned binary snapshots of the dependency graph.
+ * Layout: header, node records, CSR row offsets and columns, string offsets, UTF-8 string data.
+ */
+class FNsSpyglassSnapshot
+{
+
+// Functions
+public:
+
+    /** File identifier and format version. */
+    static constexpr uint32 Magic = 0x4753534E; // "NSSG"
+    static constexpr uint32 Version = 1;
+
+    /** Write the graph, including current layout positions. */
+    static bool Save(const FString& FilePath, const TArray<FPluginNode>& Nodes);
+
+    /** Encode the graph into OutBuffer in the file format. */
+    static void Write(const TArray<FPluginNode>& Nodes, TArray<uint8>& OutBuffer);
+
+    /** Rebuild nodes, positions and adjacency from a snapshot. Plugins are looked up by name and stay null when missing. */
+    static void Read(const FNsSpyglassSnapshotView& View, TArray<FPluginNode>& OutNodes);
+
+    /** Compare two snapshots by node name. Old is the baseline, New the candidate. */
+    static void Diff(const FNsSpyglassSnapshotView& Old, const FNsSpyglassSnapshotView& New, FNsSpyglassGraphDiff& OutDiff);
+};
@@ -0,0 +1,52 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "NsSpyglassQueryLibrary.generated.h"
+
+/**
+ * Dependency queries over the enabled plugins for editor scripting.
+ * From Python: unreal.NsSpyglassQueryLibrary.get_why_path("MyGame", "Niagara")
+ */
+UCLASS()
+class UNsSpyglassQueryLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+// Functions
+public:
+
+    /** Whether From depends on To, directly or transitively. */
+    UFUNCTION(BlueprintCallable, Category="Spyglass|Query")
+    static bool DependsOn(const FString& From, const FString& To);
+
+    /** Shortest dependency chain explaining why From depends on To. Empty when it does not. */
+    UFUNCTION(BlueprintCallable, Category="Spyglass|Query")
+    static TArray<FString> GetWhyPath(const FString& From, const FString& To);
+
+    /** Up to MaxPaths simple dependency chains from From to To, formatted as "A -> B -> C", shortest first. */
+    UFUNCTION(BlueprintCallable, Category="Spyglass|Query")
+    static TArray<FString> GetAllWhyPaths(const FString& From, const FString& To, int32 MaxPaths = 16);
+
+    /** Plugins within Hops edges of Plugin, following dependencies, dependents or both. */
+    UFUNCTION(BlueprintCallable, Category="Spyglass|Query")
+    static TArray<FString> GetNeighbourhood(const FString& Plugin, int32 Hops = 1, bool bDependencies = true, bool bDependents = true);
+
+    /** Every plugin that depends on Plugin, directly or transitively. */
+    UFUNCTION(BlueprintCallable, Category="Spyglass|Query")
+    static TArray<FString> GetTransitiveDependents(const FString& Plugin);
+
+    /** Number of plugins that depend on Plugin, directly or transitively. -1 when the plugin is unknown. */
+    UFUNCTION(BlueprintCallable, Category="Spyglass|Query")
+    static int32 GetTransitiveDependentCount(const FString& Plugin);
+
+    /** Number of plugins Plugin depends on, directly or transitively. -1 when the plugin is unknown. */
+    UFUNCTION(BlueprintCallable, Category="Spyglass|Query")
+    static int32 GetTransitiveDependencyCount(const FString& Plugin);
+
+    /** Enabled plugins ordered so dependencies come before their dependents. */
+    UFUNCTION(BlueprintCallable, Category="Spyglass|Query")
+    static TArray<FString> GetTopologicalOrder();
+};
@@ -0,0 +1,116 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "NsSpyglassBudgetSettings.generated.h"
+
+/** Which plugins a budget group selects based on their modules. */
+UENUM()
+enum class ENsSpyglassGroupModuleFilter : uint8
+{
+    /** Match by name only. */
+    Any,
+
+    /** Plugins with at least one module loaded in cooked games: Runtime, RuntimeNoCommandlet, RuntimeAndProgram, CookedOnly, ServerOnly, ClientOnly or ClientOnlyNoCommandlet. */
+    Runtime,
+
+    /** Plugins whose modules are all editor or developer modules. */
+    EditorOnly
+};
+
+/** Named set of plugins that forbidden edges refer to. */
+USTRUCT()
+struct FNsSpyglassBudgetGroup
+{
+    GENERATED_BODY()
+
+    /** Name used by forbidden edges. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget")
+    FName Name;
+
+    /** Plugin name wildcards, e.g. "Ns*". Empty matches every plugin. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget")
+    TArray<FString> PluginPatterns;
+
+    /** Restrict the group by module host type. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget")
+    ENsSpyglassGroupModuleFilter ModuleFilter = ENsSpyglassGroupModuleFilter::Any;
+
+    /** Only plugins that live in the project, not the engine. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget")
+    bool bProjectPluginsOnly = false;
+};
+
+/** Dependencies from one group to another that must not exist. */
+USTRUCT()
+struct FNsSpyglassForbiddenEdge
+{
+    GENERATED_BODY()
+
+    /** Group of the depending plugins. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget")
+    FName FromGroup;
+
+    /** Group of the plugins that must not be depended on. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget")
+    FName ToGroup;
+
+    /** Also fail when the dependency is only transitive. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget")
+    bool bTransitive = false;
+};
+
+/**
+ * Dependency budgets checked by the NsSpyglassBudget commandlet.
+ * Stored in DefaultEditor.ini so the same limits apply on every machine and build agent.
+ */
+UCLASS(Config=Editor, DefaultConfig)
+class UNsSpyglassBudgetSettings : public UDeveloperSettings
+{
+    GENERATED_BODY()
+
+// Functions
+public:
+
+    /** Constructor */
+    UNsSpyglassBudgetSettings();
+
+    /** Get Spyglass Budget Settings */
+    static const UNsSpyglassBudgetSettings* GetSettings();
+
+protected:
+    virtual FName GetContainerName() const override;
+
+// Variables
+public:
+
+    /** Maximum number of plugins any plugin may depend on transitively. 0 disables the check. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget", meta=(ClampMin=0))
+    int32 MaxTransitiveDependencies;
+
+    /** Per plugin overrides of MaxTransitiveDependencies. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget")
+    TMap<FString, int32> TransitiveDependencyOverrides;
+
+    /** Maximum length of any dependency chain. 0 disables the check. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget", meta=(ClampMin=0))
+    int32 MaxDepth;
+
+    /** Maximum number of modules declared by all enabled plugins. 0 disables the check. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget", meta=(ClampMin=0))
+    int32 MaxEnabledModules;
+
+    /** Plugin groups referenced by forbidden edges. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget")
+    TArray<FNsSpyglassBudgetGroup> Groups;
+
+    /** Group dependencies that fail the check. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget")
+    TArray<FNsSpyglassForbiddenEdge> ForbiddenEdges;
+
+    /** Fail when any circular dependency exists. */
+    UPROPERTY(EditAnywhere, Config, Category="Budget")
+    bool bForbidCycles;
+};
@@ -4,6 +4,20 @@
 #include "Engine/DeveloperSettings.h"
 #include "NsSpyglassSettings.generated.h"
 
+/** Which neighbours focus mode keeps. */
+UENUM()
+enum class ENsSpyglassFocusDirection : uint8
+{
+    /** Dependencies and dependents. */
+    Both,
+
+    /** Only plugins the focused plugin depends on. */
+    Dependencies,
+
+    /** Only plugins that depend on the focused plugin. */
+    Dependents
+};
+
 /**
  * Settings that control the force directed layout.
  * Values are persisted per user so tweaks are restored across editor sessions.
@@ -40,4 +54,32 @@ public:
     /** Attraction Scale between nodes */
     UPROPERTY(EditAnywhere, Config, Category="Layout")
     float AttractionScale;
+
+    /** Number of hops around a double-clicked plugin kept in focus mode. */
+    UPROPERTY(EditAnywhere, Config, Category="Focus", meta=(ClampMin=1, ClampMax=8))
+    int32 FocusHops;
+
+    /** Edge direction followed when collecting the focus neighbourhood and the rings of the radial layout. */
+    UPROPERTY(EditAnywhere, Config, Category="Focus")
+    ENsSpyglassFocusDirection FocusDirection;
+
+    /** Bundle similar edges into curves once the layout settles. */
+    UPROPERTY(EditAnywhere, Config, Category="Edges")
+    bool bBundleEdges;
+
+    /** Show an overview of the whole graph in the corner of the view. */
+    UPROPERTY(EditAnywhere, Config, Category="View")
+    bool bShowMinimap;
+
+    /** Replace the graph with a dependency structure matrix, which stays readable for thousands of plugins. */
+    UPROPERTY(EditAnywhere, Config, Category="View")
+    bool bShowMatrix;
+
+    /** Draw the twinkling star backdrop behind the graph. */
+    UPROPERTY(EditAnywhere, Config, Category="View")
+    bool bShowStars;
+
+    /** Stars per screen area, relative to the default backdrop. Lower it on slow machines. */
+    UPROPERTY(EditAnywhere, Config, Category="View", meta=(EditCondition="bShowStars", ClampMin=0.1, ClampMax=4))
+    float StarDensity;
 };
@@ -0,0 +1,59 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+struct FNsSpyglassCycleInfo;
+
+/** Row data for one circular dependency. */
+struct FNsSpyglassCycleEntry
+{
+    /** Index into FNsSpyglassCycleInfo::Cycles. */
+    int32 CycleIndex = INDEX_NONE;
+
+    /** Member names joined for display. */
+    FString Label;
+};
+
+/**
+ * Side panel list of circular dependencies found in the graph.
+ */
+class SNsSpyglassCycleListWidget : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SNsSpyglassCycleListWidget) {}
+    SLATE_END_ARGS()
+
+    /** Delegate fired when a cycle is selected. INDEX_NONE clears the selection. */
+    DECLARE_DELEGATE_OneParam(FOnCycleSelected, int32);
+
+    /** Build the widget. */
+    void Construct(const FArguments& InArgs);
+
+    /** Refresh the list from the latest graph analysis. */
+    void SetCycles(const TArray<FPluginNode>& Nodes, const FNsSpyglassCycleInfo& CycleInfo);
+
+    /** Register a callback for selection changes. */
+    void SetOnCycleSelected(FOnCycleSelected InDelegate);
+
+private:
+    /** Create a row for the list view. */
+    TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FNsSpyglassCycleEntry> Item, const TSharedRef<STableViewBase>& OwnerTable) const;
+
+    /** Forward list selection to the delegate. */
+    void OnSelectionChanged(TSharedPtr<FNsSpyglassCycleEntry> Item, ESelectInfo::Type SelectInfo);
+
+    /** Rows shown in the list. */
+    TArray<TSharedPtr<FNsSpyglassCycleEntry>> Entries;
+
+    /** Widget references for updating. */
+    TSharedPtr<class STextBlock> HeaderText;
+    TSharedPtr<SListView<TSharedPtr<FNsSpyglassCycleEntry>>> ListView;
+
+    /** Delegate for selection updates. */
+    FOnCycleSelected OnCycleSelected;
+};
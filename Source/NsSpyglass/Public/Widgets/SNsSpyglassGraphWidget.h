@@ -3,68 +3,42 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Analysis/NsSpyglassBuildTimings.h"
+#include "Analysis/NsSpyglassContentRollup.h"
+#include "Analysis/NsSpyglassIncludeScanner.h"
+#include "Analysis/NsSpyglassSession.h"
+#include "Analysis/NsSpyglassUnusedPlugins.h"
+#include "Analysis/NsSpyglassWhatIf.h"
+#include "Graph/NsSpyglassCycleDetector.h"
+#include "Graph/NsSpyglassEdgeBundler.h"
+#include "Graph/NsSpyglassGitHistory.h"
+#include "Graph/NsSpyglassGraphQuery.h"
+#include "Graph/NsSpyglassGraphSubsystem.h"
+#include "Graph/NsSpyglassGraphTypes.h"
+#include "Graph/NsSpyglassSearchIndex.h"
+#include "Graph/NsSpyglassShippingFilter.h"
+#include "Graph/NsSpyglassSnapshot.h"
 #include "Interfaces/IPluginManager.h"
+#include "Rendering/RenderingCommon.h"
 #include "Widgets/SCompoundWidget.h"
 
-/**
- * Node information used by the force-directed graph
- */
-struct FPluginNode
+/** How a graph view positions its nodes. */
+enum class ENsSpyglassLayoutMode : uint8
 {
-    /** Display name of the plugin. */
-    FString Name;
-
-    /** Current position relative to the center of the view. */
-    FVector2D Position = FVector2D::ZeroVector;
-
-    /** Indices of linked plugins used by the layout. */
-    TArray<int32> Links;
-
-    /** Directed dependencies for this plugin. */
-    TArray<int32> Dependencies;
-
-    /** Plugins that directly depend on this one. */
-    TArray<int32> Dependents;
+    /** Continuous force simulation, shared with the other views. */
+    Force,
 
-    /** Whether this plugin comes from the engine. */
-    bool bIsEngine = false;
+    /** Layered layout computed once, dependencies above their dependents. */
+    Layered,
 
-    /** Color assigned to this node's group. */
-    FLinearColor Color = FLinearColor(1.f, 1.f, 1.f, 0.1f);
-
-    /** When true, the node will remain stationary during simulation. */
-    bool bFixed = false;
-
-    /** Node velocity */
-    FVector2D Velocity = FVector2D::ZeroVector;
-
-    // Intro animation
-    bool  bActive = true;         // participates in solver + rendering
-    float AppearDelay = 0.f;      // seconds before appearing
-    float AppearAlpha = 1.f;      // 0..1 fade value
-
-    /** Plugin reference used for detailed information. */
-    TSharedPtr<IPlugin> Plugin;
-};
-
-/** Background star used for the parallax backdrop. */
-struct FBackgroundStar
-{
-    /** Position relative to the center of the screen. */
-    FVector2D Position = FVector2D::ZeroVector;
-
-    /** Current opacity of the star. */
-    float Alpha = 0.f;
-
-    /** Desired opacity to interpolate toward. */
-    float TargetAlpha = 0.f;
-
-    /** Speed of the fade interpolation. */
-    float FadeSpeed = 1.f;
+    /** Rings of hop distance around a root plugin, placed directly without a simulation. */
+    Radial
 };
 
 /**
- * Widget that displays all loaded plugins in a force-directed graph
+ * Widget that displays all loaded plugins in a force-directed graph.
+ * The live graph and its layout come from UNsSpyglassGraphSubsystem, so every open view shows the same simulation.
+ * Focus mode, snapshot diffs and history timelines lay out a private copy of the nodes instead.
  */
 class SNsSpyglassGraphWidget : public SCompoundWidget
 {
@@ -75,6 +49,9 @@ public:
     /** Constructor */
     SNsSpyglassGraphWidget();
 
+    /** Unregister from the graph subsystem. */
+    virtual ~SNsSpyglassGraphWidget() override;
+
     SLATE_BEGIN_ARGS(SNsSpyglassGraphWidget) {}
     SLATE_END_ARGS()
 
@@ -87,11 +64,178 @@ public:
     /** Register a callback for hover events. */
     void SetOnNodeHovered(FOnNodeHovered InDelegate);
 
+    /** Delegate fired after the nodes were rebuilt. */
+    DECLARE_DELEGATE(FOnGraphRebuilt);
+
+    /** Register a callback for graph rebuilds. */
+    void SetOnGraphRebuilt(FOnGraphRebuilt InDelegate);
+
+    /** Nodes currently in the graph. */
+    const TArray<FPluginNode>& GetNodes() const { return Nodes; }
+
+    /** Circular dependencies found during the last build. */
+    const FNsSpyglassCycleInfo& GetCycleInfo() const { return CycleInfo; }
+
+    /** Emphasize one cycle in the view. INDEX_NONE clears the selection. */
+    void SetSelectedCycle(int32 CycleIndex);
+
+    /** Toggle the content reference overlay. Starts an Asset Registry gather when needed. */
+    void SetShowContentEdges(bool bShow);
+
+    /** Whether the content reference overlay is visible. */
+    bool IsShowingContentEdges() const { return bShowContentEdges; }
+
+    /** Toggle the source include overlay. Rescans changed source files when turned on. */
+    void SetShowIncludeEdges(bool bShow);
+
+    /** Whether the source include overlay is visible. */
+    bool IsShowingIncludeEdges() const { return bShowIncludeEdges; }
+
+    /** Toggle compile time heat on the nodes. Rescans the build traces when turned on. */
+    void SetShowBuildHeat(bool bShow);
+
+    /** Whether compile time heat is drawn. */
+    bool IsShowingBuildHeat() const { return bShowBuildHeat; }
+
+    /** Heat nodes by their compile time including that of their dependencies, or by their own only. */
+    void SetBuildHeatInclusive(bool bInclusive) { bBuildHeatInclusive = bInclusive; }
+
+    /** Whether heat includes dependencies. */
+    bool IsBuildHeatInclusive() const { return bBuildHeatInclusive; }
+
+    /** Delegate fired when the shipping view changed, with nullptr once it is turned off. */
+    DECLARE_DELEGATE_OneParam(FOnShippingViewChanged, const FNsSpyglassShippingResult*);
+
+    /** Register a callback for shipping view changes. */
+    void SetOnShippingViewChanged(FOnShippingViewChanged InDelegate);
+
+    /** Show only the plugins that ship for a target on a platform, or every plugin again. */
+    void SetShippingView(bool bEnable, ENsSpyglassShipTarget Target, const FString& Platform);
+
+    /** Delegate fired when an unused plugin search finished. */
+    DECLARE_DELEGATE_OneParam(FOnUnusedPluginsFound, FNsSpyglassUnusedResultPtr);
+
+    /** Register a callback for unused plugin results. */
+    void SetOnUnusedPluginsFound(FOnUnusedPluginsFound InDelegate);
+
+    /** Search for unused plugins in the background, gathering content references first. */
+    void FindUnusedPlugins();
+
+    /** Delegate fired when the what-if scenario changed, with null when the mode ended. */
+    DECLARE_DELEGATE_OneParam(FOnWhatIfChanged, FNsSpyglassWhatIfResultPtr);
+
+    /** Register a callback for what-if changes. */
+    void SetOnWhatIfChanged(FOnWhatIfChanged InDelegate);
+
+    /** Start or end the what-if mode, in which clicking a node disables or re-enables it. */
+    void SetWhatIfMode(bool bEnable);
+
+    /** Whether the what-if mode is on. */
+    bool IsWhatIfMode() const { return WhatIf.IsValid(); }
+
+    /** Disable every plugin passing the filter in the what-if scenario. */
+    void DisableVisiblePlugins();
+
+    /** Enable every plugin again in the what-if scenario. */
+    void ResetWhatIf();
+
+    /** Write the current graph and layout to a binary snapshot. */
+    bool SaveSnapshot(const FString& FilePath) const;
+
+    /** Replace the live graph with the union of two snapshots, colored by change. RebuildGraph returns to the live graph. */
+    void ShowDiff(const FNsSpyglassGraphDiff& InDiff);
+
+    /** Whether a snapshot diff is displayed. */
+    bool IsShowingDiff() const { return bShowingDiff; }
+
+    /**
+     * Replace the live graph with every plugin of a history and show its first commit.
+     * SetTimelineCommit scrubs through it, RebuildGraph returns to the live graph.
+     */
+    void ShowTimeline(FNsSpyglassHistoryPtr InHistory);
+
+    /**
+     * Show another commit of the timeline. Plugins and edges that differ fade in or out.
+     * Only the ops in between touch the nodes. The query, cycles, selected path and layered or radial layout are
+     * rebuilt after the step, or once the scrub ends while SetTimelineScrubbing is on.
+     */
+    void SetTimelineCommit(int32 Commit);
+
+    /** Hold back the graph wide updates of SetTimelineCommit while the timeline slider is dragged. */
+    void SetTimelineScrubbing(bool bScrubbing);
+
+    /** Commit of the timeline on screen, INDEX_NONE outside the timeline. */
+    int32 GetTimelineCommit() const { return TimelineCommit; }
+
+    /** Whether a history timeline is displayed. */
+    bool IsShowingTimeline() const { return History.IsValid(); }
+
+    /** Whether a private force layout stopped moving. Views following the shared layout never report it. */
+    bool IsLayoutSettled() const { return bLocalSettled; }
+
+    /** Query index over the current nodes. */
+    TSharedPtr<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> GetQuery() const { return Query; }
+
+    /** Dependency chain between the two selected nodes, empty unless one depends on the other. */
+    const TArray<int32>& GetSelectedPath() const { return SelectedPath; }
+
+    /** Show only plugins whose metadata contains every term. Hidden plugins are not drawn. */
+    void SetFilter(const FString& InFilterText);
+
+    /** Number of plugins passing the filter. */
+    int32 GetNumVisibleNodes() const { return VisibleNodes.Num(); }
+
+    /** Indices of the plugins passing the filter and the focus neighbourhood. */
+    const TArray<int32>& GetVisibleNodes() const { return VisibleNodes; }
+
+    /** Show only the neighbourhood of a node, laid out around it. Other nodes keep their positions and stop simulating. */
+    void EnterFocus(int32 NodeIndex);
+
+    /** Leave focus mode and restore the positions nodes had before entering it. */
+    void ExitFocus();
+
+    /** Node in focus, INDEX_NONE when the whole graph is shown. */
+    int32 GetFocusNode() const { return FocusNode; }
+
+    /** Switch between the shared force simulation and a layered or radial layout of this view. */
+    void SetLayoutMode(ENsSpyglassLayoutMode InMode);
+
+    /** Current layout mode. */
+    ENsSpyglassLayoutMode GetLayoutMode() const { return LayoutMode; }
+
+    /** Lay the radial layout out around another plugin, animating from the current one. */
+    void SetRadialRoot(int32 NodeIndex);
+
+    /** Root of the radial layout and of focus mode, INDEX_NONE before one was picked. */
+    int32 GetRootIndex() const { return RootIndex; }
+
+    /** Push overlapping nodes apart now. */
+    void RemoveOverlaps();
+
+    /**
+     * Start recording a session: the graph, seed, settings, input and frame deltas.
+     * The view leaves focus mode and simulates privately until recording stops, so the session replays exactly.
+     */
+    void StartRecording();
+
+    /** Stop recording and write the session. Returns false when nothing was recorded or the file could not be written. */
+    bool StopRecording(const FString& FilePath);
+
+    /** Whether a session is being recorded. */
+    bool IsRecording() const { return Recording.IsValid(); }
+
+    /** Detach the view from the live graph and restore the starting state of a session. The replay then feeds its input and deltas. */
+    bool BeginReplay(const FNsSpyglassSession& Session, FString& OutError);
+
+    /** Seconds the last tick spent in the force solver. */
+    double GetLastSolverSeconds() const { return LastSolverSeconds; }
+
     //~ Begin SCompoundWidget Interface
     virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
     virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
     virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
     virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
     virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
     virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
     //~ End SCompoundWidget Interface
@@ -99,26 +243,118 @@ public:
     /** Reset pan/zoom to the origin. */
     void RecenterView();
 
-    /** Clear and rebuild all nodes. */
-    void RebuildGraph();
+    /** Pan offset and zoom factor, a graph position P is drawn at ViewSize / 2 + ViewOffset + P * Zoom. */
+    FVector2D GetViewOffset() const { return ViewOffset; }
+    float GetZoomAmount() const { return ZoomAmount; }
+
+    /** Size of the view at the last tick. */
+    FVector2D GetViewSize() const { return LastViewSize; }
 
-    /** Clamp to max size */
-    FVector2D ClampToMaxSize2D(const FVector2D& V, float MaxSize);
+    /** Center the view on a graph position. Zoom is clamped to the range the mouse wheel allows. */
+    void CenterViewOn(const FVector2D& GraphPos, float InZoomAmount);
+
+    /** Return to the live graph and rebuild it for every view. */
+    void RebuildGraph();
 
 
 private:
 
-    /** Create random background stars. */
-    void InitStars(const FVector2D& ViewSize) const;
+    /** Draw the star backdrop as a single batch. Returns the layer to continue on. */
+    int32 PaintStars(const FPaintArgs& Args, const FGeometry& AllottedGeometry, FSlateWindowElementList& OutDrawElements, int32 LayerId) const;
+
+    /** Recompute the transitive dependencies and dependents of the hovered node if the hover or the nodes changed. */
+    void UpdateHoverMasks() const;
+
+    /** Rebuild the label text and measured sizes of every node if the nodes changed. */
+    void UpdateLabels(const FSlateFontInfo& Font) const;
+
+    /** Replace the nodes with those of a shared graph model. */
+    void BuildNodes(const FNsSpyglassGraphModel& Model);
+
+    /** Add the nodes a later batch of the displayed build brought, keeping the view state of the others. */
+    void AppendNodes(const FNsSpyglassGraphModel& Model);
+
+    /** Fade in the nodes from FirstNode on, after the ones still waiting to appear. */
+    void RevealNodes(int32 FirstNode);
+
+    /** Pick up the next batch published by the graph subsystem, at most one per call. */
+    void HandleModelChanged();
+
+    /** Whether node positions follow the shared simulation rather than a private one. */
+    bool UsesSharedLayout() const { return !bShowingDiff && !History.IsValid() && !bReplaying && !Recording.IsValid() && FocusNode == INDEX_NONE && LayoutMode == ENsSpyglassLayoutMode::Force; }
+
+    /** Rebuild the what-if scenario for the current nodes, keeping disabled plugins by name. */
+    void RestartWhatIf(bool bMeasureBinaries);
 
-    /** Populate the node array by scanning loaded plugins. */
-    void BuildNodes(const FVector2D& ViewSize) const;
+    /** Pass the what-if scenario to the side panel. */
+    void NotifyWhatIfChanged();
+
+    /** Blend the visible nodes from their current positions to Targets. */
+    void BeginTransition(TArray<FVector2D>&& Targets);
+
+    /** Compute the layered layout of the visible nodes in the background and blend into it. */
+    void RequestLayeredLayout();
+
+    /** Place the visible nodes in rings around the root and blend into it. Picks the most connected node without a root. */
+    void ApplyRadialLayout();
+
+    /** Lay the visible nodes out again in a layered or radial view after they changed. Does nothing for the force layout. */
+    void RefreshLayout();
 
     /** Return the index of the node under the cursor or INDEX_NONE. */
     int32 HitTestNode(const FVector2D& LocalPos, const FVector2D& ViewSize) const;
 
-    /** Perform a single ForceAtlas2 iteration on the node array.*/
-    void RunForceAtlas2Step(TArray<FPluginNode>& Nodes, int32 RootIndex, float Repulsion, float Gravity, float DeltaTime);
+    /** Recompute the visible node list from FilterText, the focus neighbourhood and the shipping view. */
+    void ApplyFilter() const;
+
+    /** Show or hide one timeline node, updating the visible set for that node only. */
+    void SetTimelineShown(int32 NodeIndex, bool bShown);
+
+    /** Evaluate the shipping view for the current nodes, reindexing them when they changed, and refilter. */
+    void UpdateShippingView();
+
+    /** Forget focus state without restoring positions, used when the nodes are replaced. */
+    void ResetFocus();
+
+    /** Add or remove a node from the selection, keeping at most two, and update the path between them. */
+    void ToggleSelection(int32 NodeIndex);
+
+    /** Clear selected nodes and path. */
+    void ClearSelection();
+
+    /** Find the dependency chain between the two selected nodes again. */
+    void UpdateSelectedPath();
+
+    /**
+     * Apply the ops of a timeline commit to the nodes, or undo them. Added edges update CycleInfo in place while
+     * bInOutCyclesCurrent is set, a removed edge inside a cycle clears it. Nodes switched on are queued in TimelineAppeared.
+     */
+    void ApplyHistoryOps(int32 Commit, bool bUndo, bool& bInOutCyclesCurrent);
+
+    /** Rebuild what SetTimelineCommit deferred: cycles if stale, the query, the selected path and the layout. */
+    void UpdateTimelineGraph();
+
+    /** Fade timeline nodes and edges towards the displayed commit. */
+    void TickTimeline(float DeltaTime);
+
+    /** Leave the timeline, if one is shown. The nodes are replaced by the caller. */
+    void ClearTimeline();
+
+    /** Measure how far nodes moved since the last tick and how long the layout has been still. */
+    void TrackLayoutMotion(float DeltaTime);
+
+    /** Drop stale edge bundles and start bundling once the layout settles. */
+    void UpdateEdgeBundles(float DeltaTime);
+
+    /** Perform a single ForceAtlas2 iteration on the visible nodes of a private layout. */
+    void RunForceAtlas2Step(float DeltaTime);
+
+    /** Bring transient state to a point a session can start from: no intro, transition, velocity or bundles. */
+    void PrepareSession();
+
+    /** Append an input event to the recording, if one runs. */
+    void RecordEvent(ENsSpyglassSessionEventType Type, const FGeometry& MyGeometry, const FPointerEvent& MouseEvent);
+    void RecordEvent(FNsSpyglassSessionEvent&& Event);
 
 // Variables
 private:
@@ -135,6 +371,12 @@ private:
     /** Current zoom factor. */
     mutable float ZoomAmount = 1.f;
 
+    /** Size of the view at the last tick. */
+    FVector2D LastViewSize = FVector2D::ZeroVector;
+
+    /** Local to screen scale of the view at the last tick. */
+    float LastViewScale = 1.f;
+
     /** Whether the user is currently panning the view. */
     mutable bool bIsPanning = false;
 
@@ -150,14 +392,229 @@ private:
     /** Index of the root node in the Nodes array. */
     mutable int32 RootIndex = INDEX_NONE;
 
+    /** Mouse position when the left button went down, used to tell clicks from drags. */
+    FVector2D PressPos = FVector2D::ZeroVector;
+
+    /** Nodes selected by clicking, oldest first. */
+    TArray<int32> SelectedNodes;
+
+    /** Shortest dependency chain between the selected nodes. */
+    TArray<int32> SelectedPath;
+
+    /** Text index over node metadata, rebuilt with the nodes. */
+    mutable FNsSpyglassSearchIndex SearchIndex;
+
+    /** Current search box text. */
+    FString FilterText;
+
+    /** Indices of nodes passing the filter, and the same set as a mask. */
+    mutable TArray<int32> VisibleNodes;
+    mutable TBitArray<> VisibleMask;
+
+    /** Nodes passing every filter but the timeline, so a commit can show or hide single nodes. */
+    mutable TBitArray<> FilterMask;
+
+    /** Focused node and its neighbourhood. */
+    int32 FocusNode = INDEX_NONE;
+    TBitArray<> FocusMask;
+
+    /** Positions and root before focus mode was entered. */
+    TArray<FVector2D> SavedPositions;
+    int32 SavedRootIndex = INDEX_NONE;
+
+    /** Layout transition of focus mode and layout switches, positions blend from start to target while TransitionBlend < 1. */
+    TArray<FVector2D> TransitionStart;
+    TArray<FVector2D> TransitionTarget;
+    float TransitionBlend = 1.f;
+
+    /** How this view positions its nodes. */
+    ENsSpyglassLayoutMode LayoutMode = ENsSpyglassLayoutMode::Force;
+
+    /** Increments with every layered layout request, so only the latest result is applied. */
+    uint32 LayeredGeneration = 0;
+
+    /** Query index rebuilt with the nodes. */
+    mutable TSharedPtr<const FNsSpyglassGraphQuery, ESPMode::ThreadSafe> Query;
+
+
+    /** Whether the private force layout settled and stopped simulating. */
+    mutable bool bLocalSettled = false;
+
+    /** Version of the shared model the nodes were copied from. */
+    mutable uint32 ModelVersion = 0;
+
+    /** Build that model belongs to. Zero when the nodes do not come from the live graph. */
+    uint32 ModelBuildId = 0;
+
+    /** Strongly connected components of the current nodes. */
+    mutable FNsSpyglassCycleInfo CycleInfo;
+
+    /** Cycle emphasized from the side panel. */
+    int32 SelectedCycle = INDEX_NONE;
+
+    /** Hash of the current node names, used to validate cached analysis results. */
+    mutable uint32 PluginSetHash = 0;
+
+    /** Bumped whenever the nodes are replaced or extended, so paint caches know to rebuild. */
+    uint32 NodesRevision = 0;
+
+    /** Whether content reference edges are drawn. */
+    bool bShowContentEdges = false;
+
+    /** Content references matching the current nodes. */
+    FNsSpyglassContentResultPtr ContentResult;
+
+    /** Rollup result version last pulled into ContentResult. */
+    uint32 ContentResultVersion = 0;
+
+    /** Whether source include edges are drawn. */
+    bool bShowIncludeEdges = false;
+
+    /** Source includes matching the current nodes. */
+    FNsSpyglassIncludeResultPtr IncludeResult;
+
+    /** Whether compile time heat is drawn, and whether it includes dependencies. */
+    bool bShowBuildHeat = false;
+    bool bBuildHeatInclusive = true;
+
+    /** Compile times matching the current nodes. */
+    FNsSpyglassBuildTimingResultPtr BuildTimings;
+
+    /** Whether an unused plugin search waits for content references. */
+    bool bUnusedSearchPending = false;
+
+    /** Last unused plugin search for the current nodes. */
+    FNsSpyglassUnusedResultPtr UnusedResult;
+
+    /** Delegate for unused plugin results. */
+    FOnUnusedPluginsFound OnUnusedPluginsFound;
+
+    /** What-if scenario, null outside the what-if mode. */
+    TUniquePtr<FNsSpyglassWhatIf> WhatIf;
+
+    /** Increments whenever the scenario is rebuilt, so stale binary sizes are dropped. */
+    uint32 WhatIfGeneration = 0;
+
+    /** Delegate for what-if changes. */
+    FOnWhatIfChanged OnWhatIfChanged;
+
+    /** Whether only shipping plugins are shown, and for which target and platform. */
+    bool bShippingView = false;
+    ENsSpyglassShipTarget ShipTarget = ENsSpyglassShipTarget::Game;
+    FString ShipPlatform;
+
+    /** Module and reference masks of the current nodes, and the plugin set they were built for. */
+    FNsSpyglassShippingFilter ShippingFilter;
+    uint32 ShippingFilterHash = 0;
+
+    /** Shipping plugins for the current target and platform. */
+    FNsSpyglassShippingResult ShippingResult;
+
+    /** Delegate for shipping view changes. */
+    FOnShippingViewChanged OnShippingViewChanged;
+
+    /** Whether Nodes hold a snapshot diff instead of the live graph. */
+    bool bShowingDiff = false;
+
+    /** Node and edge states of the displayed diff. Its nodes are moved into Nodes. */
+    FNsSpyglassGraphDiff Diff;
+
+    /** Displayed history, null unless the timeline is shown. Node indices are its node ids. */
+    FNsSpyglassHistoryPtr History;
+
+    /** Commit the nodes show. */
+    int32 TimelineCommit = INDEX_NONE;
+
+    /** Per node, whether the plugin exists at the displayed commit, and whether it is still drawn while fading out. */
+    TBitArray<> TimelinePresent;
+    TBitArray<> TimelineShown;
+
+    /** Nodes the applied ops switched on, placed next to a neighbour once the commit is reached. */
+    TArray<int32> TimelineAppeared;
+
+    /** Whether SetTimelineCommit left graph wide updates for UpdateTimelineGraph, and whether cycles are among them. */
+    bool bTimelineDirty = false;
+    bool bTimelineCyclesStale = false;
+
+    /** Whether the timeline slider is being dragged. */
+    bool bTimelineScrubbing = false;
+
+    /** An edge the last scrub added or removed, fading towards its new state. */
+    struct FTimelineEdgeFade
+    {
+        float Alpha = 0.f;
+        bool bAdded = false;
+    };
+
+    /** Fading edges by (From << 32) | To. */
+    TMap<uint64, FTimelineEdgeFade> TimelineEdgeFades;
+
+    /** Bundled polylines for the visible edges, valid while the layout stays near BundleSource. */
+    TSharedPtr<const FNsSpyglassEdgeBundles, ESPMode::ThreadSafe> EdgeBundles;
+
+    /** Positions and visible set the current or running bundling started from. */
+    TArray<FVector2D> BundleSource;
+    TBitArray<> BundleMask;
+
+    /** Whether a bundling job runs, and its generation. Results of older generations are dropped. */
+    bool bBundlePending = false;
+    uint32 BundleGeneration = 0;
+
+    /** Positions of the previous tick and how long the layout has been still. */
+    TArray<FVector2D> PrevPositions;
+    float SettleTime = 0.f;
+
+    /** Session being recorded, null when not recording. */
+    TUniquePtr<FNsSpyglassSession> Recording;
+
+    /** Settings written to the recording last, compared every frame. */
+    FNsSpyglassSessionSettings RecordedSettings;
+
+    /** Whether the nodes come from a replayed session instead of the live graph. */
+    bool bReplaying = false;
+
+    /** Source of all randomness in the view, seeded per session so replays match. */
+    mutable FRandomStream Random;
+
+    /** Solver time of the last tick. */
+    double LastSolverSeconds = 0.0;
+
     /** Delegate for hover updates. */
     FOnNodeHovered OnNodeHovered;
 
-    /** Background stars shown behind the graph. */
-    mutable TArray<FBackgroundStar> Stars;
-
-    /** Cached size for generating star positions. */
-    mutable FVector2D StarsViewSize = FVector2D::ZeroVector;
+    /** Delegate for rebuild notifications. */
+    FOnGraphRebuilt OnGraphRebuilt;
+
+    /** Seed of the star backdrop. Stars are derived from it and the time, nothing else is stored. */
+    uint32 StarSeed = 0;
+
+    /** Reused vertex and index buffers of the star batch. */
+    mutable TArray<FSlateVertex> StarVertices;
+    mutable TArray<SlateIndex> StarIndices;
+
+    /** Edge lines of a frame, one polyline per rounded thickness. Reused so painting does not allocate. */
+    struct FLineBatch
+    {
+        TArray<FVector2D> Points;
+        TArray<FLinearColor> Colors;
+    };
+    mutable TArray<FLineBatch> LineBatches;
+
+    /** Transitive dependencies, including the node itself, and dependents of the hovered node. */
+    mutable TBitArray<> DownstreamMask;
+    mutable TBitArray<> UpstreamMask;
+    mutable int32 HoverMaskNode = INDEX_NONE;
+    mutable uint32 HoverMaskRevision = MAX_uint32;
+
+    /** Label of a node. Long names are shown as their capitals above the full name. */
+    struct FNodeLabel
+    {
+        FString ShortName;
+        FVector2D ShortSize = FVector2D::ZeroVector;
+        FVector2D FullSize = FVector2D::ZeroVector;
+    };
+    mutable TArray<FNodeLabel> Labels;
+    mutable uint32 LabelRevision = MAX_uint32;
 
     /** is the intro running */
     mutable bool  bIntroRunning = false;
@@ -170,5 +627,8 @@ private:
 
     /** intro node fade duration */
     float IntroFade = 0.25f;
+
+    /** Delay given to the next node revealed while the intro runs. */
+    float NextAppearDelay = 0.f;
 };
 
@@ -0,0 +1,101 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassDependencyMatrix.h"
+#include "Graph/NsSpyglassGraphSubsystem.h"
+#include "Interfaces/IPluginManager.h"
+#include "Rendering/RenderingCommon.h"
+#include "Widgets/SLeafWidget.h"
+
+/**
+ * Dependency structure matrix of the live graph, for graphs too large to read as nodes and links.
+ * The matrix is built on a worker whenever the shared model changes. Painting only visits the blocks on screen,
+ * picking the pyramid level whose blocks are at least a few pixels wide, and draws them as one vertex batch,
+ * so the cost of a frame depends on the viewport and not on the number of plugins.
+ * Dragging pans, the mouse wheel zooms around the cursor and a double click fits the matrix into the view.
+ * Hovering a cell names the edge and reports the row's plugin to the info panel.
+ */
+class SNsSpyglassMatrixWidget : public SLeafWidget
+{
+
+// Functions
+public:
+
+    SLATE_BEGIN_ARGS(SNsSpyglassMatrixWidget) {}
+    SLATE_END_ARGS()
+
+    /** Delegate fired with the plugin of the hovered row, or nullptr when the cursor left the matrix. */
+    DECLARE_DELEGATE_OneParam(FOnNodeHovered, TSharedPtr<IPlugin>);
+
+    /** Build the widget. */
+    void Construct(const FArguments& InArgs);
+
+    /** Bind hover updates, usually to the info panel. */
+    void SetOnNodeHovered(FOnNodeHovered InDelegate);
+
+    //~ Begin SWidget Interface
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+    virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+    virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+    virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual void OnMouseLeave(const FPointerEvent& MouseEvent) override;
+    //~ End SWidget Interface
+
+private:
+
+    /** Start building the matrix of the current model on a worker unless one is underway. */
+    void RequestMatrix();
+
+    /** Zoom and pan so the whole matrix fits into a view of the given size. */
+    void FitToView(const FVector2D& ViewSize);
+
+    /** Pyramid level drawn at the current zoom. */
+    int32 GetDrawLevel() const;
+
+    /** Update the hovered cell and tell the info panel when the row changed. */
+    void SetHoveredCell(int32 Row, int32 Column);
+
+    /** Description of the hovered cell or block, empty without one. */
+    FString DescribeHover() const;
+
+// Variables
+private:
+
+    /** Model the matrix was built from and the matrix itself. */
+    TSharedPtr<const FNsSpyglassGraphModel, ESPMode::ThreadSafe> Model;
+    FNsSpyglassDependencyMatrixPtr Matrix;
+
+    /** Whether a build runs on a worker. */
+    bool bBuildPending = false;
+
+    /** Local position of the top left corner of the matrix, and the size of one cell in pixels. */
+    FVector2D ViewOffset = FVector2D::ZeroVector;
+    float CellSize = 8.f;
+
+    /** Whether the next tick fits the matrix into the view, set when a new graph arrives. */
+    bool bFitPending = true;
+
+    /** Size of the view at the last tick. */
+    FVector2D LastViewSize = FVector2D::ZeroVector;
+
+    /** Hovered row and column, INDEX_NONE outside the matrix. */
+    int32 HoveredRow = INDEX_NONE;
+    int32 HoveredColumn = INDEX_NONE;
+
+    /** Panning state. */
+    bool bIsPanning = false;
+    FVector2D LastMousePos = FVector2D::ZeroVector;
+
+    /** Reused vertex and index buffers of the cell batch. */
+    mutable TArray<FSlateVertex> Vertices;
+    mutable TArray<SlateIndex> Indices;
+
+    /** Delegate for hover updates. */
+    FOnNodeHovered OnNodeHovered;
+};
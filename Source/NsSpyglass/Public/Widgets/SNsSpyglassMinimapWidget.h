@@ -0,0 +1,81 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SLeafWidget.h"
+
+class SNsSpyglassGraphWidget;
+struct FSlateDynamicImageBrush;
+
+/**
+ * Overview of the whole graph drawn in a corner of the graph view.
+ * Nodes are splatted into a small density image that is only regenerated when the layout moved by more than a texel,
+ * so drawing the minimap costs one textured box and the viewport outline per frame.
+ * Clicking or dragging centers the graph view on that point, the mouse wheel zooms it.
+ */
+class SNsSpyglassMinimapWidget : public SLeafWidget
+{
+
+// Functions
+public:
+
+    SLATE_BEGIN_ARGS(SNsSpyglassMinimapWidget) {}
+    SLATE_END_ARGS()
+
+    /** Build the widget for the given graph view. */
+    void Construct(const FArguments& InArgs, const TSharedRef<SNsSpyglassGraphWidget>& InGraph);
+
+    //~ Begin SWidget Interface
+    virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+    virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+    virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+    virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseButtonDoubleClick(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseMove(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    virtual FReply OnMouseWheel(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
+    //~ End SWidget Interface
+
+private:
+
+    /** Whether the visible nodes moved, appeared or vanished enough to show in the image. */
+    bool NeedsUpdate() const;
+
+    /** Recompute the bounds and splat the visible nodes into a new image. */
+    void UpdateImage();
+
+    /** Minimap coordinates of a graph space position. */
+    FVector2D GraphToLocal(const FVector2D& GraphPos, const FVector2D& LocalSize) const;
+
+    /** Graph space position under a minimap coordinate. */
+    FVector2D LocalToGraph(const FVector2D& LocalPos, const FVector2D& LocalSize) const;
+
+    /** Center the graph view on the position under the cursor. */
+    void CenterGraphAt(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) const;
+
+// Variables
+private:
+
+    /** Graph view the minimap shows and steers. */
+    TWeakPtr<SNsSpyglassGraphWidget> Graph;
+
+    /** Current density image, null until the first update. */
+    TSharedPtr<FSlateDynamicImageBrush> Brush;
+
+    /** Increments with every image, so each one gets a fresh renderer resource. */
+    uint32 ImageGeneration = 0;
+
+    /** Graph space area covered by the image, padded and fitted to its aspect ratio. */
+    FBox2D Bounds = FBox2D(ForceInit);
+
+    /** Visible nodes and their positions when the image was made. */
+    TArray<int32> SourceNodes;
+    TArray<FVector2D> SourcePositions;
+
+    /** Seconds since the last change check. */
+    float CheckElapsed = 0.f;
+
+    /** Whether the user drags the viewport rectangle. */
+    bool bIsDragging = false;
+};
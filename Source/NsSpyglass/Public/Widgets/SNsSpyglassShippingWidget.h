@@ -0,0 +1,52 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassShippingFilter.h"
+#include "Widgets/SCompoundWidget.h"
+
+class STextComboBox;
+
+/**
+ * Side panel section that restricts the graph to the plugins a target ships on a platform.
+ */
+class SNsSpyglassShippingWidget : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SNsSpyglassShippingWidget) {}
+    SLATE_END_ARGS()
+
+    /** Delegate fired when the view is toggled or another target or platform is picked. */
+    DECLARE_DELEGATE_ThreeParams(FOnViewChanged, bool, ENsSpyglassShipTarget, const FString&);
+
+    /** Build the widget. */
+    void Construct(const FArguments& InArgs);
+
+    /** Show the counts of the current view, or nothing when it is off. */
+    void SetResult(const FNsSpyglassShippingResult* InResult);
+
+    /** Register a callback for view changes. */
+    void SetOnViewChanged(FOnViewChanged InDelegate);
+
+private:
+    /** Pass the current choice on. */
+    void NotifyViewChanged() const;
+
+    /** Whether the view is on. */
+    bool bEnabled = false;
+
+    /** Options of the two pickers. */
+    TArray<TSharedPtr<FString>> TargetOptions;
+    TArray<TSharedPtr<FString>> PlatformOptions;
+
+    /** Current choice. */
+    ENsSpyglassShipTarget Target = ENsSpyglassShipTarget::Game;
+    FString Platform;
+
+    /** Widget references for updating. */
+    TSharedPtr<class STextBlock> StatusText;
+
+    /** Delegate for view changes. */
+    FOnViewChanged OnViewChanged;
+};
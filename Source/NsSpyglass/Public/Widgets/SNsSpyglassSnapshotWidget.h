@@ -0,0 +1,65 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassSnapshot.h"
+#include "Widgets/SCompoundWidget.h"
+
+/**
+ * Side panel section that saves graph snapshots and compares two of them.
+ */
+class SNsSpyglassSnapshotWidget : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SNsSpyglassSnapshotWidget) {}
+    SLATE_END_ARGS()
+
+    /** Delegate asked to write the live graph to a file. */
+    DECLARE_DELEGATE_RetVal_OneParam(bool, FOnSaveRequested, const FString&);
+
+    /** Delegate fired when a diff is ready to display. */
+    DECLARE_DELEGATE_OneParam(FOnDiffReady, const FNsSpyglassGraphDiff&);
+
+    /** Delegate fired when the user returns to the live graph. */
+    DECLARE_DELEGATE(FOnLiveRequested);
+
+    /** Build the widget. */
+    void Construct(const FArguments& InArgs);
+
+    /** Register a callback that saves the live graph. */
+    void SetOnSaveRequested(FOnSaveRequested InDelegate);
+
+    /** Register a callback for finished diffs. */
+    void SetOnDiffReady(FOnDiffReady InDelegate);
+
+    /** Register a callback for leaving the diff. */
+    void SetOnLiveRequested(FOnLiveRequested InDelegate);
+
+    /** Default folder for snapshot files. */
+    static FString GetSnapshotDirectory();
+
+private:
+    /** Save the live graph through a file dialog. */
+    FReply OnSaveClicked();
+
+    /** Pick one or two snapshots and diff them. A single file is compared against the live graph. */
+    FReply OnCompareClicked();
+
+    /** Leave the diff. */
+    FReply OnLiveClicked();
+
+    /** Open both files, diff them and report the result. */
+    void Compare(const FString& OldPath, const FString& NewPath);
+
+    /** Whether a diff is shown. */
+    bool bShowingDiff = false;
+
+    /** Widget references for updating. */
+    TSharedPtr<class STextBlock> StatusText;
+
+    /** Delegates wired to the graph. */
+    FOnSaveRequested OnSaveRequested;
+    FOnDiffReady OnDiffReady;
+    FOnLiveRequested OnLiveRequested;
+};
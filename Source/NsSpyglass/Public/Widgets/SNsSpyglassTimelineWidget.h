@@ -0,0 +1,96 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Graph/NsSpyglassGitHistory.h"
+#include "Widgets/SCompoundWidget.h"
+
+/**
+ * Side panel section that loads the plugin graph history of the project's git repository and scrubs through it.
+ */
+class SNsSpyglassTimelineWidget : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SNsSpyglassTimelineWidget) {}
+    SLATE_END_ARGS()
+
+    /** Delegate fired when a history finished loading. */
+    DECLARE_DELEGATE_OneParam(FOnHistoryLoaded, FNsSpyglassHistoryPtr);
+
+    /** Delegate fired when another commit is picked. */
+    DECLARE_DELEGATE_OneParam(FOnCommitSelected, int32);
+
+    /** Delegate fired when the user returns to the live graph. */
+    DECLARE_DELEGATE(FOnLiveRequested);
+
+    /** Delegate fired when the slider is grabbed, with true, and released, with false. */
+    DECLARE_DELEGATE_OneParam(FOnScrubbingChanged, bool);
+
+    /** Cancel a running load. */
+    virtual ~SNsSpyglassTimelineWidget() override;
+
+    /** Build the widget. */
+    void Construct(const FArguments& InArgs);
+
+    /** Register a callback for loaded histories. */
+    void SetOnHistoryLoaded(FOnHistoryLoaded InDelegate);
+
+    /** Register a callback for scrubbing. */
+    void SetOnCommitSelected(FOnCommitSelected InDelegate);
+
+    /** Register a callback for leaving the timeline. */
+    void SetOnLiveRequested(FOnLiveRequested InDelegate);
+
+    /** Register a callback for the start and end of a slider drag. */
+    void SetOnScrubbingChanged(FOnScrubbingChanged InDelegate);
+
+private:
+    /** Progress and cancellation shared with the loading worker. */
+    struct FLoadState
+    {
+        std::atomic<int32> Progress{0};
+        std::atomic<bool> bCancel{false};
+    };
+
+    /** Read the history of the range in the background. */
+    FReply OnLoadClicked();
+
+    /** Leave the timeline. */
+    FReply OnLiveClicked();
+
+    /** Step one commit back or forward. */
+    FReply OnStepClicked(int32 Step);
+
+    /** Show a commit and describe it. */
+    void SelectCommit(int32 InCommit);
+
+    /** Describe the commit on screen. */
+    void DescribeCommit();
+
+    /** Take a finished load. */
+    void HandleLoaded(FNsSpyglassHistoryPtr Loaded, const FString& Error);
+
+    /** Loaded history, null before a load or after leaving the timeline. */
+    FNsSpyglassHistoryPtr History;
+
+    /** Commit on screen. */
+    int32 Commit = 0;
+
+    /** State of the running load, null when none runs. */
+    TSharedPtr<FLoadState, ESPMode::ThreadSafe> LoadState;
+
+    /** Result of the last load. */
+    FText Status;
+
+    /** Widget references for updating. */
+    TSharedPtr<class SEditableTextBox> FromText;
+    TSharedPtr<class SEditableTextBox> ToText;
+    TSharedPtr<class STextBlock> CommitText;
+
+    /** Delegates wired to the graph. */
+    FOnHistoryLoaded OnHistoryLoaded;
+    FOnCommitSelected OnCommitSelected;
+    FOnLiveRequested OnLiveRequested;
+    FOnScrubbingChanged OnScrubbingChanged;
+};
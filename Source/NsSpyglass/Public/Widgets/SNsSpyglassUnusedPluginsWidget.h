@@ -0,0 +1,56 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/NsSpyglassUnusedPlugins.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+/**
+ * Side panel section listing plugins that nothing references, ranked by estimated savings.
+ */
+class SNsSpyglassUnusedPluginsWidget : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SNsSpyglassUnusedPluginsWidget) {}
+    SLATE_END_ARGS()
+
+    /** Delegate fired when the user asks for a new search. */
+    DECLARE_DELEGATE(FOnFindRequested);
+
+    /** Build the widget. */
+    void Construct(const FArguments& InArgs);
+
+    /** Show a finished search. */
+    void SetResult(FNsSpyglassUnusedResultPtr InResult);
+
+    /** Show that a search is running. */
+    void SetSearching();
+
+    /** Register a callback for search requests. */
+    void SetOnFindRequested(FOnFindRequested InDelegate);
+
+private:
+    /** Create a row for the list view. */
+    TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FNsSpyglassUnusedPlugin> Item, const TSharedRef<STableViewBase>& OwnerTable) const;
+
+    /** Ask the graph for a new search. */
+    FReply OnFindClicked();
+
+    /** Copy the proposed .uproject entries and save them next to the project. */
+    FReply OnCopyClicked() const;
+
+    /** Last finished search. */
+    FNsSpyglassUnusedResultPtr Result;
+
+    /** Rows shown in the list. */
+    TArray<TSharedPtr<FNsSpyglassUnusedPlugin>> Entries;
+
+    /** Widget references for updating. */
+    TSharedPtr<class STextBlock> StatusText;
+    TSharedPtr<SListView<TSharedPtr<FNsSpyglassUnusedPlugin>>> ListView;
+
+    /** Delegate for search requests. */
+    FOnFindRequested OnFindRequested;
+};
@@ -0,0 +1,61 @@
+// Copyright (C) 2025 nulled.softworks. All rights reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Analysis/NsSpyglassWhatIf.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+/**
+ * Side panel section for simulating disabled plugins.
+ * While the mode is on, clicking a node in the graph toggles it, and this section lists what the scenario breaks and orphans.
+ */
+class SNsSpyglassWhatIfWidget : public SCompoundWidget
+{
+public:
+    SLATE_BEGIN_ARGS(SNsSpyglassWhatIfWidget) {}
+    SLATE_END_ARGS()
+
+    /** Delegate fired when the mode is switched on or off. */
+    DECLARE_DELEGATE_OneParam(FOnModeChanged, bool);
+
+    /** Delegate fired for the scenario buttons. */
+    DECLARE_DELEGATE(FOnScenarioRequested);
+
+    /** Build the widget. */
+    void Construct(const FArguments& InArgs);
+
+    /** Show the current scenario, or nothing when the mode is off. */
+    void SetResult(FNsSpyglassWhatIfResultPtr InResult);
+
+    /** Register callbacks for the mode checkbox and the buttons. */
+    void SetOnModeChanged(FOnModeChanged InDelegate);
+    void SetOnDisableFilteredRequested(FOnScenarioRequested InDelegate);
+    void SetOnResetRequested(FOnScenarioRequested InDelegate);
+
+private:
+    /** Create a row for the list view. */
+    TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FNsSpyglassWhatIfEntry> Item, const TSharedRef<STableViewBase>& OwnerTable) const;
+
+    /** Copy the proposed .uproject entries and save them next to the project. */
+    FReply OnCopyClicked() const;
+
+    /** Current scenario. */
+    FNsSpyglassWhatIfResultPtr Result;
+
+    /** Whether the mode is on. */
+    bool bEnabled = false;
+
+    /** Rows shown in the list. */
+    TArray<TSharedPtr<FNsSpyglassWhatIfEntry>> Entries;
+
+    /** Widget references for updating. */
+    TSharedPtr<class STextBlock> StatusText;
+    TSharedPtr<SListView<TSharedPtr<FNsSpyglassWhatIfEntry>>> ListView;
+
+    /** Delegates for the mode and the buttons. */
+    FOnModeChanged OnModeChanged;
+    FOnScenarioRequested OnDisableFilteredRequested;
+    FOnScenarioRequested OnResetRequested;
+};
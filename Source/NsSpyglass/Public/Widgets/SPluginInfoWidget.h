@@ -5,9 +5,55 @@
 #include "CoreMinimal.h"
 #include "Interfaces/IPluginManager.h"
 #include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+/** Lists shown by the info panel. */
+enum class EPluginInfoSection : uint8
+{
+    /** Modules with host type and loading phase. */
+    Modules,
+
+    /** Plugins this one depends on directly. */
+    Dependencies,
+
+    /** Plugins that depend on this one directly. */
+    Dependents,
+
+    Num
+};
+
+/** One line of a list section. */
+struct FPluginInfoRow
+{
+    /** Main text. */
+    FText Label;
+
+    /** Secondary text drawn after the label. */
+    FText Detail;
+
+    /** Label color. */
+    FLinearColor Color = FLinearColor::White;
+};
+
+/** Everything the panel shows for one plugin, formatted once and reused on every later hover. */
+struct FPluginInfoViewModel
+{
+    FText Name;
+    FText Description;
+    FText Author;
+    FString DocsURL;
+
+    /** Transitive dependency and dependent counts. */
+    FText Counts;
+
+    /** Rows per section. */
+    TArray<FPluginInfoRow> Rows[static_cast<int32>(EPluginInfoSection::Num)];
+};
 
 /**
  * Widget that displays information about a plugin.
+ * Hover changes are debounced and view models are cached per plugin. The lists are virtualized and their items are
+ * shared row slots, so showing another plugin rebinds existing rows instead of creating widgets.
  */
 class SPluginInfoWidget : public SCompoundWidget
 {
@@ -18,25 +64,68 @@ public:
     /** Build the widget. */
     void Construct(const FArguments& InArgs);
 
-    /** Set plugin info to display. Pass nullptr to clear. */
+    /** Set plugin info to display once the hover settles. Pass nullptr to clear. */
     void SetPlugin(TSharedPtr<IPlugin> InPlugin);
 
+    //~ Begin SCompoundWidget Interface
+    virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+    //~ End SCompoundWidget Interface
+
 private:
+    /** List item, the index of a row in the current view model. */
+    using FRowItem = TSharedPtr<int32>;
+
     /** Open the documentation URL. */
     void OnDocsClicked() const;
 
+    /** Show PendingPlugin. */
+    void ApplyPlugin();
+
+    /** View model of a plugin, built on first access and dropped when the graph is rebuilt. */
+    TSharedRef<const FPluginInfoViewModel> GetViewModel(const TSharedRef<IPlugin>& Plugin);
+
+    /** Point a section list at the first Num row slots. */
+    void SetRowCount(EPluginInfoSection Section, int32 Num);
+
+    /** Row of the current view model, nullptr when out of range. */
+    const FPluginInfoRow* GetRow(EPluginInfoSection Section, int32 Index) const;
+
+    /** Create a row widget bound to a row slot. */
+    TSharedRef<ITableRow> GenerateRow(FRowItem Item, const TSharedRef<STableViewBase>& OwnerTable, EPluginInfoSection Section);
+
+    /** Heading and virtualized list of one section. */
+    TSharedRef<SWidget> MakeSection(const FString& Title, EPluginInfoSection Section);
+
     /** Current plugin displayed. */
     TSharedPtr<IPlugin> CurrentPlugin;
 
+    /** Plugin to display when the debounce runs out. */
+    TSharedPtr<IPlugin> PendingPlugin;
+
+    /** Seconds left before PendingPlugin is shown, negative when nothing is pending. */
+    float PendingDelay = -1.f;
+
+    /** View model of CurrentPlugin. */
+    TSharedPtr<const FPluginInfoViewModel> CurrentModel;
+
+    /** View models by plugin name and the graph version they were built for. */
+    TMap<FString, TSharedRef<const FPluginInfoViewModel>> ViewModels;
+    uint32 ViewModelVersion = 0;
+
+    /** Row slots shared by all lists. Slot i always shows row i, so rows survive plugin changes. */
+    TArray<FRowItem> RowSlots;
+
+    /** Items and list view per section. */
+    TArray<FRowItem> SectionItems[static_cast<int32>(EPluginInfoSection::Num)];
+    TSharedPtr<SListView<FRowItem>> SectionLists[static_cast<int32>(EPluginInfoSection::Num)];
+
     /** Widget references for updating. */
     TSharedPtr<class STextBlock> NameText;
     TSharedPtr<class STextBlock> DescriptionText;
     TSharedPtr<class STextBlock> AuthorText;
+    TSharedPtr<class STextBlock> CountsText;
     TSharedPtr<class SHyperlink> DocsLink;
-    TSharedPtr<class SVerticalBox> ModulesBox;
-    TSharedPtr<class SVerticalBox> DependenciesBox;
 
     /** URL to open when the docs hyperlink is clicked. */
     FString DocsURL;
 };
-